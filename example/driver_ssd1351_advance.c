@@ -71,6 +71,7 @@ uint8_t ssd1351_advance_init(void)
     DRIVER_SSD1351_LINK_SPI_INIT(&gs_handle, ssd1351_interface_spi_init);
     DRIVER_SSD1351_LINK_SPI_DEINIT(&gs_handle, ssd1351_interface_spi_deinit);
     DRIVER_SSD1351_LINK_SPI_WRITE_COMMAND(&gs_handle, ssd1351_interface_spi_write_cmd);
+    DRIVER_SSD1351_LINK_SPI_WRITE_COMMAND_VECTOR(&gs_handle, ssd1351_interface_spi_write_cmd_vector);
     DRIVER_SSD1351_LINK_COMMAND_DATA_GPIO_INIT(&gs_handle, ssd1351_interface_cmd_data_gpio_init);
     DRIVER_SSD1351_LINK_COMMAND_DATA_GPIO_DEINIT(&gs_handle, ssd1351_interface_cmd_data_gpio_deinit);
     DRIVER_SSD1351_LINK_COMMAND_DATA_GPIO_WRITE(&gs_handle, ssd1351_interface_cmd_data_gpio_write);
@@ -519,7 +520,7 @@ uint8_t ssd1351_advance_rect(uint8_t left, uint8_t top, uint8_t right, uint8_t b
  *            - 1 draw picture failed
  * @note      none
  */
-uint8_t ssd1351_advance_draw_picture(uint8_t left, uint8_t top, uint8_t right, uint8_t bottom, uint32_t *img)
+uint8_t ssd1351_advance_draw_picture(uint8_t left, uint8_t top, uint8_t right, uint8_t bottom, const uint32_t *img)
 {
     /* draw picture */
     if (ssd1351_draw_picture(&gs_handle, left, top, right, bottom, img) != 0)
@@ -544,7 +545,7 @@ uint8_t ssd1351_advance_draw_picture(uint8_t left, uint8_t top, uint8_t right, u
  *            - 1 draw picture 16 bits failed
  * @note      none
  */
-uint8_t ssd1351_advance_draw_picture_16bits(uint8_t left, uint8_t top, uint8_t right, uint8_t bottom, uint16_t *img)
+uint8_t ssd1351_advance_draw_picture_16bits(uint8_t left, uint8_t top, uint8_t right, uint8_t bottom, const uint16_t *img)
 {
     /* draw picture in 16 bits */
     if (ssd1351_draw_picture_16bits(&gs_handle, left, top, right, bottom, img) != 0)
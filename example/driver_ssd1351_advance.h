@@ -176,7 +176,7 @@ uint8_t ssd1351_advance_rect(uint8_t left, uint8_t top, uint8_t right, uint8_t b
  *            - 1 draw picture failed
  * @note      none
  */
-uint8_t ssd1351_advance_draw_picture(uint8_t left, uint8_t top, uint8_t right, uint8_t bottom, uint32_t *img);
+uint8_t ssd1351_advance_draw_picture(uint8_t left, uint8_t top, uint8_t right, uint8_t bottom, const uint32_t *img);
 
 /**
  * @brief     advance example draw a 16 bits picture
@@ -190,7 +190,7 @@ uint8_t ssd1351_advance_draw_picture(uint8_t left, uint8_t top, uint8_t right, u
  *            - 1 draw picture 16 bits failed
  * @note      none
  */
-uint8_t ssd1351_advance_draw_picture_16bits(uint8_t left, uint8_t top, uint8_t right, uint8_t bottom, uint16_t *img);
+uint8_t ssd1351_advance_draw_picture_16bits(uint8_t left, uint8_t top, uint8_t right, uint8_t bottom, const uint16_t *img);
 
 /**
  * @brief     advance example set scroll
@@ -80,6 +80,31 @@ uint8_t ssd1351_interface_spi_deinit(void);
  */
 uint8_t ssd1351_interface_spi_write_cmd(uint8_t *buf, uint16_t len);
 
+/**
+ * @brief     interface spi bus write vector
+ * @param[in] **buf pointer to a segment buffer array
+ * @param[in] *len pointer to a segment length array
+ * @param[in] num segment number
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      all segments must be sent in order, looping over ssd1351_interface_spi_write_cmd is enough
+ */
+uint8_t ssd1351_interface_spi_write_cmd_vector(uint8_t **buf, uint16_t *len, uint16_t num);
+
+/**
+ * @brief     interface spi bus write async
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      start the transfer and return at once, buf is valid until the transfer is done,
+ *            the transfer complete irq must call ssd1351_async_irq_handler with the linked handle
+ *            and never call it before this function returns
+ */
+uint8_t ssd1351_interface_spi_write_cmd_async(uint8_t *buf, uint16_t len);
+
 /**
  * @brief     interface delay ms
  * @param[in] ms time
@@ -75,6 +75,48 @@ uint8_t ssd1351_interface_spi_write_cmd(uint8_t *buf, uint16_t len)
     return 0;
 }
 
+/**
+ * @brief     interface spi bus write vector
+ * @param[in] **buf pointer to a segment buffer array
+ * @param[in] *len pointer to a segment length array
+ * @param[in] num segment number
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      the segments are sent one by one with ssd1351_interface_spi_write_cmd by default,
+ *            replace it with a scatter gather transfer when the bus supports one
+ */
+uint8_t ssd1351_interface_spi_write_cmd_vector(uint8_t **buf, uint16_t *len, uint16_t num)
+{
+    uint16_t i;
+    
+    for (i = 0; i < num; i++)
+    {
+        if (ssd1351_interface_spi_write_cmd(buf[i], len[i]) != 0)
+        {
+            return 1;
+        }
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     interface spi bus write async
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      start a dma or interrupt transfer of buf and return at once,
+ *            call ssd1351_async_irq_handler(&handle, res) from the transfer complete irq,
+ *            res is 0 when the transfer succeeded and 1 when it failed
+ */
+uint8_t ssd1351_interface_spi_write_cmd_async(uint8_t *buf, uint16_t len)
+{
+    return 0;
+}
+
 /**
  * @brief     interface delay ms
  * @param[in] ms time
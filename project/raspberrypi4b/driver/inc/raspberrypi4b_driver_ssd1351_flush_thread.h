@@ -0,0 +1,111 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      raspberrypi4b_driver_ssd1351_flush_thread.h
+ * @brief     raspberrypi4b driver ssd1351 flush thread header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef RASPBERRYPI4B_DRIVER_SSD1351_FLUSH_THREAD_H
+#define RASPBERRYPI4B_DRIVER_SSD1351_FLUSH_THREAD_H
+
+#include "driver_ssd1351.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup ssd1351_flush_thread ssd1351 flush thread function
+ * @brief    ssd1351 double buffered flush thread modules
+ * @{
+ */
+
+/**
+ * @brief     start the flush thread
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @param[in] *buf0 pointer to the first framebuffer
+ * @param[in] *buf1 pointer to the second framebuffer
+ * @param[in] len length of each framebuffer
+ * @param[in] priority SCHED_FIFO priority of the flush thread
+ * @param[in] cpu cpu the flush thread is bound to
+ * @return    status code
+ *            - 0 success
+ *            - 1 start failed
+ * @note      buf0 becomes the back framebuffer of the handle and is copied into buf1
+ *            priority <= 0 keeps the default scheduling policy and cpu < 0 keeps the default affinity
+ *            after start, only the draw functions and ssd1351_flush_thread_swap can be used until stop,
+ *            the draw functions only write the back framebuffer, its cursor and its dirty tiles and
+ *            the flush thread only uses its own snapshot of the handle, which owns the bus until stop
+ */
+uint8_t ssd1351_flush_thread_start(ssd1351_handle_t *handle, uint8_t *buf0, uint8_t *buf1, uint32_t len,
+                                   int32_t priority, int32_t cpu);
+
+/**
+ * @brief     swap the back and front framebuffer
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 swap failed
+ * @note      it waits until the last front framebuffer is sent, then the rendered back framebuffer
+ *            is sent by the flush thread while the next frame is rendered into the other one,
+ *            the handle is snapshotted for the flush thread here while the flush thread is idle
+ */
+uint8_t ssd1351_flush_thread_swap(ssd1351_handle_t *handle);
+
+/**
+ * @brief  wait until the front framebuffer is sent
+ * @return status code
+ *         - 0 success
+ *         - 1 the last flush failed
+ * @note   none
+ */
+uint8_t ssd1351_flush_thread_wait(void);
+
+/**
+ * @brief  stop the flush thread
+ * @return status code
+ *         - 0 success
+ *         - 1 stop failed
+ * @note   the pending front framebuffer is sent before the thread exits
+ *         and the handle takes over the bus state of the flush thread
+ */
+uint8_t ssd1351_flush_thread_stop(void);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
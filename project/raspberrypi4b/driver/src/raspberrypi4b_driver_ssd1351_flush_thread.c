@@ -0,0 +1,320 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      raspberrypi4b_driver_ssd1351_flush_thread.c
+ * @brief     raspberrypi4b driver ssd1351 flush thread source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef _GNU_SOURCE
+    #define _GNU_SOURCE
+#endif
+#include "raspberrypi4b_driver_ssd1351_flush_thread.h"
+#include <errno.h>
+#include <pthread.h>
+#include <sched.h>
+
+/**
+ * @brief flush thread structure definition
+ */
+typedef struct flush_thread_s
+{
+    pthread_t thread;                   /**< flush thread */
+    pthread_mutex_t mutex;              /**< state mutex */
+    pthread_cond_t cond;                /**< state condition */
+    ssd1351_handle_t *handle;           /**< ssd1351 handle of the renderer */
+    ssd1351_handle_t flush;             /**< ssd1351 handle snapshot of the flush thread */
+    uint8_t *buf[2];                    /**< framebuffers */
+    uint8_t back;                       /**< back framebuffer index */
+    uint16_t dirty[16];                 /**< dirty tiles of the front framebuffer */
+    uint8_t pending;                    /**< front framebuffer pending flag */
+    uint8_t stop;                       /**< stop flag */
+    uint8_t res;                        /**< last flush result */
+    uint8_t running;                    /**< running flag */
+} flush_thread_t;
+
+/**
+ * @brief flush thread state definition
+ */
+static flush_thread_t gs_flush = {.running = 0};        /**< flush thread state */
+
+/**
+ * @brief     copy the bus state of a handle
+ * @param[in] *dst pointer to the destination handle
+ * @param[in] *src pointer to the source handle
+ * @note      the bus state is the dc level, the gram window cache and the flush stats,
+ *            the inner buffer is always empty after a flush
+ */
+static void a_flush_thread_copy_bus_state(ssd1351_handle_t *dst, const ssd1351_handle_t *src)
+{
+    dst->dc = src->dc;                                                                                  /* copy dc level */
+    dst->window_valid = src->window_valid;                                                              /* copy window valid flag */
+    dst->ram_mode = src->ram_mode;                                                                      /* copy ram mode */
+    dst->column_start = src->column_start;                                                              /* copy column start */
+    dst->column_end = src->column_end;                                                                  /* copy column end */
+    dst->row_start = src->row_start;                                                                    /* copy row start */
+    dst->row_end = src->row_end;                                                                        /* copy row end */
+    dst->column = src->column;                                                                          /* copy write column */
+    dst->row = src->row;                                                                                /* copy write row */
+    dst->buf_len = src->buf_len;                                                                        /* copy buffer length */
+    dst->stats = src->stats;                                                                            /* copy flush stats */
+}
+
+/**
+ * @brief     flush thread entry
+ * @param[in] *arg pointer to the thread argument
+ * @return    NULL
+ * @note      the front framebuffer is sent without the lock through the snapshot taken in swap,
+ *            the renderer handle is never read here and the renderer only touches the back framebuffer
+ */
+static void *a_flush_thread_run(void *arg)
+{
+    uint8_t res;
+    
+    (void)arg;                                                                                          /* not used */
+    
+    pthread_mutex_lock(&gs_flush.mutex);                                                                /* lock */
+    while (1)                                                                                           /* loop */
+    {
+        while ((gs_flush.pending == 0) && (gs_flush.stop == 0))                                         /* wait for a front framebuffer */
+        {
+            pthread_cond_wait(&gs_flush.cond, &gs_flush.mutex);                                         /* wait */
+        }
+        if (gs_flush.pending == 0)                                                                      /* check pending */
+        {
+            break;                                                                                      /* stop */
+        }
+        pthread_mutex_unlock(&gs_flush.mutex);                                                          /* unlock */
+        res = ssd1351_flush_framebuffer(&gs_flush.flush, gs_flush.buf[gs_flush.back ^ 1],
+                                        gs_flush.dirty);                                                /* send the front framebuffer */
+        pthread_mutex_lock(&gs_flush.mutex);                                                            /* lock */
+        gs_flush.res = res;                                                                             /* save result */
+        gs_flush.pending = 0;                                                                           /* mark the front framebuffer as sent */
+        pthread_cond_broadcast(&gs_flush.cond);                                                         /* wake up the waiters */
+    }
+    pthread_mutex_unlock(&gs_flush.mutex);                                                              /* unlock */
+    
+    return NULL;                                                                                        /* return null */
+}
+
+/**
+ * @brief     start the flush thread
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @param[in] *buf0 pointer to the first framebuffer
+ * @param[in] *buf1 pointer to the second framebuffer
+ * @param[in] len length of each framebuffer
+ * @param[in] priority SCHED_FIFO priority of the flush thread
+ * @param[in] cpu cpu the flush thread is bound to
+ * @return    status code
+ *            - 0 success
+ *            - 1 start failed
+ * @note      buf0 becomes the back framebuffer of the handle and is copied into buf1
+ *            priority <= 0 keeps the default scheduling policy and cpu < 0 keeps the default affinity
+ *            after start, only the draw functions and ssd1351_flush_thread_swap can be used until stop,
+ *            the draw functions only write the back framebuffer, its cursor and its dirty tiles and
+ *            the flush thread only uses its own snapshot of the handle, which owns the bus until stop
+ */
+uint8_t ssd1351_flush_thread_start(ssd1351_handle_t *handle, uint8_t *buf0, uint8_t *buf1, uint32_t len,
+                                   int32_t priority, int32_t cpu)
+{
+    pthread_attr_t attr;
+    struct sched_param param;
+    cpu_set_t set;
+    int res;
+    
+    if ((gs_flush.running != 0) || (handle == NULL) || (buf0 == NULL) || (buf1 == NULL))                /* check the state */
+    {
+        return 1;                                                                                       /* return error */
+    }
+    if (ssd1351_set_framebuffer(handle, buf0, len) != 0)                                                /* attach the back framebuffer */
+    {
+        return 1;                                                                                       /* return error */
+    }
+    memcpy(buf1, buf0, len);                                                                            /* both framebuffers start with the same picture */
+    
+    gs_flush.handle = handle;                                                                           /* save the handle */
+    memcpy(&gs_flush.flush, handle, sizeof(ssd1351_handle_t));                                          /* snapshot the handle */
+    gs_flush.buf[0] = buf0;                                                                             /* set the first framebuffer */
+    gs_flush.buf[1] = buf1;                                                                             /* set the second framebuffer */
+    gs_flush.back = 0;                                                                                  /* buf0 is the back framebuffer */
+    gs_flush.pending = 0;                                                                               /* clear pending flag */
+    gs_flush.stop = 0;                                                                                  /* clear stop flag */
+    gs_flush.res = 0;                                                                                   /* clear result */
+    memset(gs_flush.dirty, 0, sizeof(gs_flush.dirty));                                                  /* clear dirty tiles */
+    pthread_mutex_init(&gs_flush.mutex, NULL);                                                          /* init mutex */
+    pthread_cond_init(&gs_flush.cond, NULL);                                                            /* init condition */
+    
+    pthread_attr_init(&attr);                                                                           /* init attribute */
+    if (priority > 0)                                                                                   /* check priority */
+    {
+        memset(&param, 0, sizeof(struct sched_param));                                                  /* clear param */
+        param.sched_priority = priority;                                                                /* set priority */
+        pthread_attr_setinheritsched(&attr, PTHREAD_EXPLICIT_SCHED);                                    /* set explicit scheduling */
+        pthread_attr_setschedpolicy(&attr, SCHED_FIFO);                                                 /* set fifo policy */
+        pthread_attr_setschedparam(&attr, &param);                                                      /* set scheduling param */
+    }
+    res = pthread_create(&gs_flush.thread, &attr, a_flush_thread_run, NULL);                            /* create the thread */
+    pthread_attr_destroy(&attr);                                                                        /* destroy attribute */
+    if (res != 0)                                                                                       /* check result */
+    {
+        errno = res;                                                                                    /* set errno */
+        perror("flush thread: create failed.");                                                         /* create failed */
+        pthread_cond_destroy(&gs_flush.cond);                                                           /* destroy condition */
+        pthread_mutex_destroy(&gs_flush.mutex);                                                         /* destroy mutex */
+        
+        return 1;                                                                                       /* return error */
+    }
+    gs_flush.running = 1;                                                                               /* set running flag */
+    
+    if (cpu >= 0)                                                                                       /* check cpu */
+    {
+        CPU_ZERO(&set);                                                                                 /* clear cpu set */
+        CPU_SET(cpu, &set);                                                                             /* add the cpu */
+        res = pthread_setaffinity_np(gs_flush.thread, sizeof(cpu_set_t), &set);                         /* bind the thread to the cpu */
+        if (res != 0)                                                                                   /* check result */
+        {
+            errno = res;                                                                                /* set errno */
+            perror("flush thread: set affinity failed.");                                               /* set affinity failed */
+            (void)ssd1351_flush_thread_stop();                                                          /* stop the thread */
+            
+            return 1;                                                                                   /* return error */
+        }
+    }
+    
+    return 0;                                                                                           /* success return 0 */
+}
+
+/**
+ * @brief     swap the back and front framebuffer
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 swap failed
+ * @note      it waits until the last front framebuffer is sent, then the rendered back framebuffer
+ *            is sent by the flush thread while the next frame is rendered into the other one,
+ *            the handle is snapshotted for the flush thread here while the flush thread is idle
+ */
+uint8_t ssd1351_flush_thread_swap(ssd1351_handle_t *handle)
+{
+    uint8_t res;
+    
+    if ((gs_flush.running == 0) || (handle != gs_flush.handle))                                         /* check the state */
+    {
+        return 1;                                                                                       /* return error */
+    }
+    
+    pthread_mutex_lock(&gs_flush.mutex);                                                                /* lock */
+    while (gs_flush.pending != 0)                                                                       /* wait until the last front framebuffer is sent */
+    {
+        pthread_cond_wait(&gs_flush.cond, &gs_flush.mutex);                                             /* wait */
+    }
+    res = gs_flush.res;                                                                                 /* get the last result */
+    gs_flush.res = 0;                                                                                   /* clear result */
+    a_flush_thread_copy_bus_state(handle, &gs_flush.flush);                                             /* take over the bus state of the last flush */
+    if (ssd1351_swap_framebuffer(handle, gs_flush.buf[gs_flush.back ^ 1], gs_flush.dirty) != 0)         /* swap in the idle framebuffer */
+    {
+        pthread_mutex_unlock(&gs_flush.mutex);                                                          /* unlock */
+        
+        return 1;                                                                                       /* return error */
+    }
+    gs_flush.back ^= 1;                                                                                 /* switch the back framebuffer */
+    memcpy(&gs_flush.flush, handle, sizeof(ssd1351_handle_t));                                          /* snapshot the handle for the flush thread */
+    gs_flush.pending = 1;                                                                               /* hand the rendered frame to the flush thread */
+    pthread_cond_broadcast(&gs_flush.cond);                                                             /* wake up the flush thread */
+    pthread_mutex_unlock(&gs_flush.mutex);                                                              /* unlock */
+    
+    return (res != 0) ? 1 : 0;                                                                          /* return the last result */
+}
+
+/**
+ * @brief  wait until the front framebuffer is sent
+ * @return status code
+ *         - 0 success
+ *         - 1 the last flush failed
+ * @note   none
+ */
+uint8_t ssd1351_flush_thread_wait(void)
+{
+    uint8_t res;
+    
+    if (gs_flush.running == 0)                                                                          /* check the state */
+    {
+        return 0;                                                                                       /* success return 0 */
+    }
+    
+    pthread_mutex_lock(&gs_flush.mutex);                                                                /* lock */
+    while (gs_flush.pending != 0)                                                                       /* wait for the flush thread */
+    {
+        pthread_cond_wait(&gs_flush.cond, &gs_flush.mutex);                                             /* wait */
+    }
+    res = gs_flush.res;                                                                                 /* get the last result */
+    gs_flush.res = 0;                                                                                   /* clear result */
+    pthread_mutex_unlock(&gs_flush.mutex);                                                              /* unlock */
+    
+    return (res != 0) ? 1 : 0;                                                                          /* return the last result */
+}
+
+/**
+ * @brief  stop the flush thread
+ * @return status code
+ *         - 0 success
+ *         - 1 stop failed
+ * @note   the pending front framebuffer is sent before the thread exits
+ *         and the handle takes over the bus state of the flush thread
+ */
+uint8_t ssd1351_flush_thread_stop(void)
+{
+    int res;
+    
+    if (gs_flush.running == 0)                                                                          /* check the state */
+    {
+        return 0;                                                                                       /* success return 0 */
+    }
+    
+    pthread_mutex_lock(&gs_flush.mutex);                                                                /* lock */
+    gs_flush.stop = 1;                                                                                  /* set stop flag */
+    pthread_cond_broadcast(&gs_flush.cond);                                                             /* wake up the flush thread */
+    pthread_mutex_unlock(&gs_flush.mutex);                                                              /* unlock */
+    res = pthread_join(gs_flush.thread, NULL);                                                          /* wait for the thread */
+    gs_flush.running = 0;                                                                               /* clear running flag */
+    a_flush_thread_copy_bus_state(gs_flush.handle, &gs_flush.flush);                                    /* take over the bus state of the flush thread */
+    pthread_cond_destroy(&gs_flush.cond);                                                               /* destroy condition */
+    pthread_mutex_destroy(&gs_flush.mutex);                                                             /* destroy mutex */
+    if (res != 0)                                                                                       /* check result */
+    {
+        errno = res;                                                                                    /* set errno */
+        perror("flush thread: join failed.");                                                           /* join failed */
+        
+        return 1;                                                                                       /* return error */
+    }
+    
+    return (gs_flush.res != 0) ? 1 : 0;                                                                 /* return the last result */
+}
@@ -39,6 +39,7 @@
 #include "spi.h"
 #include "wire.h"
 #include <stdarg.h>
+#include <pthread.h>
 
 /**
  * @brief spi device name definition
@@ -50,6 +51,17 @@
  */
 static int gs_fd;                           /**< spi handle */
 
+/**
+ * @brief async transfer definition
+ */
+static uint8_t *gs_async_buf;               /**< async transfer buffer */
+static uint16_t gs_async_len;               /**< async transfer length */
+
+/**
+ * @brief spi irq definition
+ */
+extern uint8_t (*g_spi_irq)(uint8_t res);   /**< spi irq */
+
 /**
  * @brief  interface spi bus init
  * @return status code
@@ -88,6 +100,67 @@ uint8_t ssd1351_interface_spi_write_cmd(uint8_t *buf, uint16_t len)
     return spi_write_cmd(gs_fd, buf, len);
 }
 
+/**
+ * @brief     interface spi bus write vector
+ * @param[in] **buf pointer to a segment buffer array
+ * @param[in] *len pointer to a segment length array
+ * @param[in] num segment number
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      none
+ */
+uint8_t ssd1351_interface_spi_write_cmd_vector(uint8_t **buf, uint16_t *len, uint16_t num)
+{
+    return spi_write_cmd_vector(gs_fd, buf, len, num);
+}
+
+/**
+ * @brief     async transfer thread
+ * @param[in] *arg pointer to an argument
+ * @return    NULL
+ * @note      none
+ */
+static void *a_ssd1351_interface_async_thread(void *arg)
+{
+    uint8_t res;
+    
+    (void)arg;
+    
+    res = spi_write_cmd(gs_fd, gs_async_buf, gs_async_len);
+    if (g_spi_irq != NULL)
+    {
+        (void)g_spi_irq(res);
+    }
+    
+    return NULL;
+}
+
+/**
+ * @brief     interface spi bus write async
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      spidev has no transfer complete irq, so the buffer is sent by a detached thread
+ *            which runs g_spi_irq when the transfer is done
+ */
+uint8_t ssd1351_interface_spi_write_cmd_async(uint8_t *buf, uint16_t len)
+{
+    pthread_t thread;
+    
+    gs_async_buf = buf;
+    gs_async_len = len;
+    if (pthread_create(&thread, NULL, a_ssd1351_interface_async_thread, NULL) != 0)
+    {
+        return 1;
+    }
+    (void)pthread_detach(thread);
+    
+    return 0;
+}
+
 /**
  * @brief     interface delay ms
  * @param[in] ms time
@@ -54,6 +54,13 @@ extern "C" {
  * @{
  */
 
+/**
+ * @brief spi vector max segment number definition
+ */
+#ifndef SPI_VECTOR_MAX_NUM
+    #define SPI_VECTOR_MAX_NUM 32        /**< 32 segments */
+#endif
+
 /**
  * @brief spi mode type enumeration definition
  */
@@ -134,10 +141,23 @@ uint8_t spi_read_address16(int fd, uint16_t reg, uint8_t *buf, uint16_t len);
  * @return    status code
  *            - 0 success
  *            - 1 write failed
- * @note      none
+ * @note      a buffer longer than the spidev bufsiz is sent in bufsiz chunks
  */
 uint8_t spi_write_cmd(int fd, uint8_t *buf, uint16_t len);
 
+/**
+ * @brief     spi bus write command vector
+ * @param[in] fd spi handle
+ * @param[in] **buf pointer to a segment buffer array
+ * @param[in] *len pointer to a segment length array
+ * @param[in] num segment number
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      segments are packed into messages of at most bufsiz bytes and SPI_VECTOR_MAX_NUM transfers
+ */
+uint8_t spi_write_cmd_vector(int fd, uint8_t **buf, uint16_t *len, uint16_t num);
+
 /**
  * @brief     spi bus write
  * @param[in] fd spi handle
@@ -39,6 +39,48 @@
 #include <sys/ioctl.h>
 #include <fcntl.h>
 
+/**
+ * @brief spidev buffer size definition
+ */
+#define SPI_BUFSIZ_PATH    "/sys/module/spidev/parameters/bufsiz"        /**< spidev bufsiz parameter */
+#define SPI_BUFSIZ_DEFAULT 4096                                          /**< spidev default bufsiz */
+
+/**
+ * @brief spidev max message length
+ */
+static uint32_t gs_bufsiz = SPI_BUFSIZ_DEFAULT;        /**< max bytes of one message */
+
+/**
+ * @brief  read the spidev buffer size
+ * @return max bytes of one message
+ * @note   spidev rejects a message whose total length is over bufsiz
+ */
+static uint32_t a_spi_read_bufsiz(void)
+{
+    FILE *fp;
+    unsigned long size;
+    
+    /* open the module parameter */
+    fp = fopen(SPI_BUFSIZ_PATH, "r");
+    if (fp == NULL)
+    {
+        return SPI_BUFSIZ_DEFAULT;
+    }
+    
+    /* read the size */
+    if (fscanf(fp, "%lu", &size) != 1)
+    {
+        size = SPI_BUFSIZ_DEFAULT;
+    }
+    (void)fclose(fp);
+    if (size == 0)
+    {
+        size = SPI_BUFSIZ_DEFAULT;
+    }
+    
+    return (uint32_t)size;
+}
+
 /**
  * @brief      spi bus init
  * @param[in]  *name pointer to a spi device name buffer
@@ -132,6 +174,9 @@ uint8_t spi_init(char *name, int *fd, spi_mode_type_t mode, uint32_t freq)
             return 1;
         }
         
+        /* get the max message length */
+        gs_bufsiz = a_spi_read_bufsiz();
+        
         return 0;
     }
 }
@@ -295,28 +340,118 @@ uint8_t spi_read_address16(int fd, uint16_t reg, uint8_t *buf, uint16_t len)
  * @return    status code
  *            - 0 success
  *            - 1 write failed
- * @note      none
+ * @note      a buffer longer than the spidev bufsiz is sent in bufsiz chunks
  */
 uint8_t spi_write_cmd(int fd, uint8_t *buf, uint16_t len)
 {
     struct spi_ioc_transfer k;
+    uint32_t n;
+    int l;
+    
+    do
+    {
+        /* get the chunk length */
+        n = (len > gs_bufsiz) ? gs_bufsiz : len;
+        
+        /* clear ioc transfer */
+        memset(&k, 0, sizeof(k));
+        
+        /* set the param */
+        k.tx_buf = (unsigned long)buf;
+        k.len = n;
+        k.cs_change = 0;
+        
+        /* transmit */
+        l = ioctl(fd, SPI_IOC_MESSAGE(1), &k);
+        if (l != (int)n)
+        {
+            perror("spi: length check error.\n");
+            
+            return 1;
+        }
+        
+        /* next chunk */
+        buf += n;
+        len -= n;
+    } while (len > 0);
+    
+    return 0;
+}
+
+/**
+ * @brief     spi bus write command vector
+ * @param[in] fd spi handle
+ * @param[in] **buf pointer to a segment buffer array
+ * @param[in] *len pointer to a segment length array
+ * @param[in] num segment number
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      segments are packed into messages of at most bufsiz bytes and SPI_VECTOR_MAX_NUM transfers
+ */
+uint8_t spi_write_cmd_vector(int fd, uint8_t **buf, uint16_t *len, uint16_t num)
+{
+    struct spi_ioc_transfer k[SPI_VECTOR_MAX_NUM];
+    uint8_t *p;
+    uint32_t left;
+    uint32_t total;
+    uint32_t n;
+    uint16_t i;
+    uint16_t m;
     int l;
     
     /* clear ioc transfer */
-    memset(&k, 0, sizeof(k));
+    memset(k, 0, sizeof(k));
     
-    /* set the param */
-    k.tx_buf = (unsigned long)buf;
-    k.len = len;
-    k.cs_change = 0;
+    m = 0;
+    total = 0;
+    for (i = 0; i < num; i++)
+    {
+        p = buf[i];
+        left = len[i];
+        while (left > 0)
+        {
+            /* fill the message up to bufsiz */
+            n = gs_bufsiz - total;
+            if (n > left)
+            {
+                n = left;
+            }
+            k[m].tx_buf = (unsigned long)p;
+            k[m].len = n;
+            k[m].cs_change = 0;
+            m++;
+            total += n;
+            p += n;
+            left -= n;
+            
+            /* transmit the full message */
+            if ((m == SPI_VECTOR_MAX_NUM) || (total == gs_bufsiz))
+            {
+                l = ioctl(fd, SPI_IOC_MESSAGE(m), k);
+                if (l != (int)total)
+                {
+                    perror("spi: length check error.\n");
+                    
+                    return 1;
+                }
+                memset(k, 0, sizeof(struct spi_ioc_transfer) * m);
+                m = 0;
+                total = 0;
+            }
+        }
+    }
     
-    /* transmit */
-    l = ioctl(fd, SPI_IOC_MESSAGE(1), &k);
-    if (l != len)
+    /* transmit the rest */
+    if (m > 0)
     {
-        perror("spi: length check error.\n");
-        
-        return 1;
+        l = ioctl(fd, SPI_IOC_MESSAGE(m), k);
+        if (l != (int)total)
+        {
+            perror("spi: length check error.\n");
+            
+            return 1;
+        }
     }
     
     return 0;
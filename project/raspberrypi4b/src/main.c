@@ -37,6 +37,7 @@
 #include "driver_ssd1351_basic.h"
 #include "driver_ssd1351_advance.h"
 #include "driver_ssd1351_display_test.h"
+#include "raspberrypi4b_driver_ssd1351_flush_thread.h"
 #include "shell.h"
 #include <getopt.h>
 #include <sys/types.h>
@@ -51,9 +52,405 @@
  */
 uint8_t g_buf[256];                              /**< uart buffer */
 volatile uint16_t g_len;                         /**< uart buffer length */
+uint8_t (*g_spi_irq)(uint8_t res) = NULL;        /**< spi irq */
 static int gs_listen_fd;                         /**< network handle */
 static int gs_conn_fd;                           /**< network handle */
 static struct sockaddr_in gs_server_addr;        /**< server address */
+static ssd1351_handle_t gs_flush_handle;         /**< ssd1351 handle of the flush thread test */
+static uint8_t gs_flush_fb[2][128 * 128 * 2];    /**< framebuffers of the flush thread test */
+static uint8_t gs_flush_gamma[64] = { 0x02, 0x03, 0x04, 0x05,
+                                      0x06, 0x07, 0x08, 0x09,
+                                      0x0A, 0x0B, 0x0C, 0x0D,
+                                      0x0E, 0x0F, 0x10, 0x11,
+                                      0x12, 0x13, 0x15, 0x17,
+                                      0x19, 0x1B, 0x1D, 0x1F,
+                                      0x21, 0x23, 0x25, 0x27,
+                                      0x2A, 0x2D, 0x30, 0x33,
+                                      0x36, 0x39, 0x3C, 0x3F,
+                                      0x42, 0x45, 0x48, 0x4C,
+                                      0x50, 0x54, 0x58, 0x5C,
+                                      0x60, 0x64, 0x68, 0x6C,
+                                      0x70, 0x74, 0x78, 0x7D,
+                                      0x82, 0x87, 0x8C, 0x91,
+                                      0x96, 0x9B, 0xA0, 0xA5,
+                                      0xAA, 0xAF, 0xB4, 0x00 };
+
+/**
+ * @brief  flush thread test
+ * @return status code
+ *         - 0 success
+ *         - 1 test failed
+ * @note   a circle is moved over 100 frames which are sent by the double buffered flush thread
+ */
+static uint8_t a_ssd1351_flush_thread_test(void)
+{
+    uint8_t res;
+    uint8_t i;
+    
+    ssd1351_interface_debug_print("ssd1351: start flush thread test.\n");
+    
+    /* link functions */
+    DRIVER_SSD1351_LINK_INIT(&gs_flush_handle, ssd1351_handle_t);
+    DRIVER_SSD1351_LINK_SPI_INIT(&gs_flush_handle, ssd1351_interface_spi_init);
+    DRIVER_SSD1351_LINK_SPI_DEINIT(&gs_flush_handle, ssd1351_interface_spi_deinit);
+    DRIVER_SSD1351_LINK_SPI_WRITE_COMMAND(&gs_flush_handle, ssd1351_interface_spi_write_cmd);
+    DRIVER_SSD1351_LINK_SPI_WRITE_COMMAND_VECTOR(&gs_flush_handle, ssd1351_interface_spi_write_cmd_vector);
+    DRIVER_SSD1351_LINK_COMMAND_DATA_GPIO_INIT(&gs_flush_handle, ssd1351_interface_cmd_data_gpio_init);
+    DRIVER_SSD1351_LINK_COMMAND_DATA_GPIO_DEINIT(&gs_flush_handle, ssd1351_interface_cmd_data_gpio_deinit);
+    DRIVER_SSD1351_LINK_COMMAND_DATA_GPIO_WRITE(&gs_flush_handle, ssd1351_interface_cmd_data_gpio_write);
+    DRIVER_SSD1351_LINK_RESET_GPIO_INIT(&gs_flush_handle, ssd1351_interface_reset_gpio_init);
+    DRIVER_SSD1351_LINK_RESET_GPIO_DEINIT(&gs_flush_handle, ssd1351_interface_reset_gpio_deinit);
+    DRIVER_SSD1351_LINK_RESET_GPIO_WRITE(&gs_flush_handle, ssd1351_interface_reset_gpio_write);
+    DRIVER_SSD1351_LINK_DELAY_MS(&gs_flush_handle, ssd1351_interface_delay_ms);
+    DRIVER_SSD1351_LINK_DEBUG_PRINT(&gs_flush_handle, ssd1351_interface_debug_print);
+    
+    /* ssd1351 init */
+    res = ssd1351_init(&gs_flush_handle);
+    if (res != 0)
+    {
+        ssd1351_interface_debug_print("ssd1351: ssd1351 init.\n");
+        
+        return 1;
+    }
+    
+    /* unlock oled driver ic */
+    res = ssd1351_set_command(&gs_flush_handle, SSD1351_COMMAND_UNLOCK_OLED_DRIVER_IC);
+    if (res != 0)
+    {
+        ssd1351_interface_debug_print("ssd1351: set command failed.\n");
+        (void)ssd1351_deinit(&gs_flush_handle);
+        
+        return 1;
+    }
+    
+    /* enable command */
+    res = ssd1351_set_command(&gs_flush_handle, SSD1351_COMMAND_A2_B1_B3_BB_BE_ACCESSIBLE);
+    if (res != 0)
+    {
+        ssd1351_interface_debug_print("ssd1351: set command failed.\n");
+        (void)ssd1351_deinit(&gs_flush_handle);
+        
+        return 1;
+    }
+    
+    /* enter sleep mode */
+    res = ssd1351_set_sleep_mode(&gs_flush_handle, SSD1351_BOOL_TRUE);
+    if (res != 0)
+    {
+        ssd1351_interface_debug_print("ssd1351: set sleep mode failed.\n");
+        (void)ssd1351_deinit(&gs_flush_handle);
+        
+        return 1;
+    }
+    
+    /* set default front clock oscillator frequency */
+    res = ssd1351_set_front_clock_oscillator_frequency(&gs_flush_handle, SSD1351_BASIC_DEFAULT_CLOCK_DIV, SSD1351_BASIC_DEFAULT_OSCILLATOR_FREQUENCY);
+    if (res != 0)
+    {
+        ssd1351_interface_debug_print("ssd1351: set front clock oscillator failed.\n");
+        (void)ssd1351_deinit(&gs_flush_handle);
+        
+        return 1;
+    }
+    
+    /* set default mux ratio */
+    res = ssd1351_set_mux_ratio(&gs_flush_handle, SSD1351_BASIC_DEFAULT_MUX_RATIO);
+    if (res != 0)
+    {
+        ssd1351_interface_debug_print("ssd1351: set mux ratio failed.\n");
+        (void)ssd1351_deinit(&gs_flush_handle);
+        
+        return 1;
+    }
+    
+    /* set default display offset */
+    res = ssd1351_set_display_offset(&gs_flush_handle, SSD1351_BASIC_DEFAULT_DISPLAY_OFFSET);
+    if (res != 0)
+    {
+        ssd1351_interface_debug_print("ssd1351: set display offset failed.\n");
+        (void)ssd1351_deinit(&gs_flush_handle);
+        
+        return 1;
+    }
+    
+    /* set default display start line */
+    res = ssd1351_set_display_start_line(&gs_flush_handle, SSD1351_BASIC_DEFAULT_DISPLAY_START_LINE);
+    if (res != 0)
+    {
+        ssd1351_interface_debug_print("ssd1351: set display start line failed.\n");
+        (void)ssd1351_deinit(&gs_flush_handle);
+        
+        return 1;
+    }
+    
+    /* set default address increment */
+    res = ssd1351_set_address_increment(&gs_flush_handle, SSD1351_BASIC_DEFAULT_ADDRESS_INCREMENT);
+    if (res != 0)
+    {
+        ssd1351_interface_debug_print("ssd1351: set address increment failed.\n");
+        (void)ssd1351_deinit(&gs_flush_handle);
+        
+        return 1;
+    }
+    
+    /* set default color depth */
+    res = ssd1351_set_color_depth(&gs_flush_handle, SSD1351_BASIC_DEFAULT_COLOR_DEPTH);
+    if (res != 0)
+    {
+        ssd1351_interface_debug_print("ssd1351: set color depth failed.\n");
+        (void)ssd1351_deinit(&gs_flush_handle);
+        
+        return 1;
+    }
+    
+    /* set default seg0 map */
+    res = ssd1351_set_seg0_map(&gs_flush_handle, SSD1351_BASIC_DEFAULT_SEG0_MAP);
+    if (res != 0)
+    {
+        ssd1351_interface_debug_print("ssd1351: set seg0 map failed.\n");
+        (void)ssd1351_deinit(&gs_flush_handle);
+        
+        return 1;
+    }
+    
+    /* set default color sequence */
+    res = ssd1351_set_color_sequence(&gs_flush_handle, SSD1351_BASIC_DEFAULT_COLOR_SEQUENCE);
+    if (res != 0)
+    {
+        ssd1351_interface_debug_print("ssd1351: set color sequence failed.\n");
+        (void)ssd1351_deinit(&gs_flush_handle);
+        
+        return 1;
+    }
+    
+    /* set default scan mode */
+    res = ssd1351_set_scan_mode(&gs_flush_handle, SSD1351_BASIC_DEFAULT_SCAN_MODE);
+    if (res != 0)
+    {
+        ssd1351_interface_debug_print("ssd1351: set scan mode failed.\n");
+        (void)ssd1351_deinit(&gs_flush_handle);
+        
+        return 1;
+    }
+    
+    /* set default com split odd even */
+    res = ssd1351_set_com_split_odd_even(&gs_flush_handle, SSD1351_BASIC_DEFAULT_COM_SPLIT_ODD_EVEN);
+    if (res != 0)
+    {
+        ssd1351_interface_debug_print("ssd1351: set com split odd even failed.\n");
+        (void)ssd1351_deinit(&gs_flush_handle);
+        
+        return 1;
+    }
+    
+    /* set default gpio */
+    res = ssd1351_set_gpio(&gs_flush_handle, SSD1351_BASIC_DEFAULT_GPIO0_MODE, SSD1351_BASIC_DEFAULT_GPIO1_MODE);
+    if (res != 0)
+    {
+        ssd1351_interface_debug_print("ssd1351: set gpio failed.\n");
+        (void)ssd1351_deinit(&gs_flush_handle);
+        
+        return 1;
+    }
+    
+    /* set default select vdd */
+    res = ssd1351_set_select_vdd(&gs_flush_handle, SSD1351_BASIC_DEFAULT_SELECT_VDD);
+    if (res != 0)
+    {
+        ssd1351_interface_debug_print("ssd1351: set select vdd failed.\n");
+        (void)ssd1351_deinit(&gs_flush_handle);
+        
+        return 1;
+    }
+    
+    /* set default parallel bits */
+    res = ssd1351_set_parallel_bits(&gs_flush_handle, SSD1351_BASIC_DEFAULT_SELECT_PARALLEL);
+    if (res != 0)
+    {
+        ssd1351_interface_debug_print("ssd1351: set parallel bits failed.\n");
+        (void)ssd1351_deinit(&gs_flush_handle);
+        
+        return 1;
+    }
+    
+    /* set default segment low voltage */
+    res = ssd1351_set_segment_low_voltage(&gs_flush_handle, SSD1351_BASIC_DEFAULT_SEGMENT_LOW_VOLTAGE);
+    if (res != 0)
+    {
+        ssd1351_interface_debug_print("ssd1351: set segment low voltage failed.\n");
+        (void)ssd1351_deinit(&gs_flush_handle);
+        
+        return 1;
+    }
+    
+    /* set default contrast */
+    res = ssd1351_set_contrast(&gs_flush_handle, SSD1351_BASIC_DEFAULT_CONTRAST_A, SSD1351_BASIC_DEFAULT_CONTRAST_B, SSD1351_BASIC_DEFAULT_CONTRAST_C);
+    if (res != 0)
+    {
+        ssd1351_interface_debug_print("ssd1351: set contrast failed.\n");
+        (void)ssd1351_deinit(&gs_flush_handle);
+        
+        return 1;
+    }
+    
+    /* set default master contrast current */
+    res = ssd1351_set_master_contrast_current(&gs_flush_handle, SSD1351_BASIC_DEFAULT_MASTER_CONTRAST_CURRENT);
+    if (res != 0)
+    {
+        ssd1351_interface_debug_print("ssd1351: set master contrast failed.\n");
+        (void)ssd1351_deinit(&gs_flush_handle);
+        
+        return 1;
+    }
+    
+    /* set default gray scale pulse width */
+    res = ssd1351_set_gray_scale_pulse_width(&gs_flush_handle, (uint8_t *)gs_flush_gamma);
+    if (res != 0)
+    {
+        ssd1351_interface_debug_print("ssd1351: set gray scale pulse width failed.\n");
+        (void)ssd1351_deinit(&gs_flush_handle);
+        
+        return 1;
+    }
+    
+    /* set default phase period */
+    res = ssd1351_set_phase_period(&gs_flush_handle, SSD1351_BASIC_DEFAULT_PHASE1_PERIOD, SSD1351_BASIC_DEFAULT_PHASE2_PERIOD);
+    if (res != 0)
+    {
+        ssd1351_interface_debug_print("ssd1351: set phase period failed.\n");
+        (void)ssd1351_deinit(&gs_flush_handle);
+        
+        return 1;
+    }
+    
+    /* set default pre charge voltage */
+    res = ssd1351_set_pre_charge_voltage(&gs_flush_handle, SSD1351_BASIC_DEFAULT_PRE_CHARGE_VOLTAGE);
+    if (res != 0)
+    {
+        ssd1351_interface_debug_print("ssd1351: set pre charge voltage failed.\n");
+        (void)ssd1351_deinit(&gs_flush_handle);
+        
+        return 1;
+    }
+    
+    /* set default vcomh voltage */
+    res = ssd1351_set_vcomh_voltage(&gs_flush_handle, SSD1351_BASIC_DEFAULT_VCOMH_VOLTAGE);
+    if (res != 0)
+    {
+        ssd1351_interface_debug_print("ssd1351: set vcomh voltage failed.\n");
+        (void)ssd1351_deinit(&gs_flush_handle);
+        
+        return 1;
+    }
+    
+    /* set default second pre charge period */
+    res = ssd1351_set_second_pre_charge_period(&gs_flush_handle, SSD1351_BASIC_DEFAULT_SECOND_PRE_CHARGE_PERIOD);
+    if (res != 0)
+    {
+        ssd1351_interface_debug_print("ssd1351: set second pre charge period failed.\n");
+        (void)ssd1351_deinit(&gs_flush_handle);
+        
+        return 1;
+    }
+    
+    /* set default display mode */
+    res = ssd1351_set_display_mode(&gs_flush_handle, SSD1351_DISPLAY_MODE_NORMAL);
+    if (res != 0)
+    {
+        ssd1351_interface_debug_print("ssd1351: set display mode failed.\n");
+        (void)ssd1351_deinit(&gs_flush_handle);
+        
+        return 1;
+    }
+    
+    /* exit sleep mode */
+    res = ssd1351_set_sleep_mode(&gs_flush_handle, SSD1351_BOOL_FALSE);
+    if (res != 0)
+    {
+        ssd1351_interface_debug_print("ssd1351: set sleep mode failed.\n");
+        (void)ssd1351_deinit(&gs_flush_handle);
+        
+        return 1;
+    }
+    
+    /* clear screen */
+    res = ssd1351_clear(&gs_flush_handle);
+    if (res != 0)
+    {
+        ssd1351_interface_debug_print("ssd1351: clear failed.\n");
+        (void)ssd1351_deinit(&gs_flush_handle);
+        
+        return 1;
+    }
+    
+    /* start the flush thread */
+    res = ssd1351_flush_thread_start(&gs_flush_handle, gs_flush_fb[0], gs_flush_fb[1], sizeof(gs_flush_fb[0]), 0, -1);
+    if (res != 0)
+    {
+        ssd1351_interface_debug_print("ssd1351: flush thread start failed.\n");
+        (void)ssd1351_deinit(&gs_flush_handle);
+        
+        return 1;
+    }
+    
+    /* render into the back framebuffer while the front one is sent */
+    for (i = 0; i < 100; i++)
+    {
+        res = ssd1351_fill_circle(&gs_flush_handle, (uint8_t)(14 + i), 64, 12, 0x0000U);
+        if (res != 0)
+        {
+            ssd1351_interface_debug_print("ssd1351: fill circle failed.\n");
+            (void)ssd1351_flush_thread_stop();
+            (void)ssd1351_deinit(&gs_flush_handle);
+            
+            return 1;
+        }
+        res = ssd1351_fill_circle(&gs_flush_handle, (uint8_t)(15 + i), 64, 12, 0xF800U);
+        if (res != 0)
+        {
+            ssd1351_interface_debug_print("ssd1351: fill circle failed.\n");
+            (void)ssd1351_flush_thread_stop();
+            (void)ssd1351_deinit(&gs_flush_handle);
+            
+            return 1;
+        }
+        res = ssd1351_flush_thread_swap(&gs_flush_handle);
+        if (res != 0)
+        {
+            ssd1351_interface_debug_print("ssd1351: flush thread swap failed.\n");
+            (void)ssd1351_flush_thread_stop();
+            (void)ssd1351_deinit(&gs_flush_handle);
+            
+            return 1;
+        }
+    }
+    
+    /* stop the flush thread */
+    res = ssd1351_flush_thread_stop();
+    if (res != 0)
+    {
+        ssd1351_interface_debug_print("ssd1351: flush thread stop failed.\n");
+        (void)ssd1351_deinit(&gs_flush_handle);
+        
+        return 1;
+    }
+    
+    /* disable the framebuffer */
+    res = ssd1351_set_framebuffer(&gs_flush_handle, NULL, 0);
+    if (res != 0)
+    {
+        ssd1351_interface_debug_print("ssd1351: set framebuffer failed.\n");
+        (void)ssd1351_deinit(&gs_flush_handle);
+        
+        return 1;
+    }
+    
+    /* finish flush thread test */
+    ssd1351_interface_debug_print("ssd1351: finish flush thread test.\n");
+    (void)ssd1351_deinit(&gs_flush_handle);
+    
+    return 0;
+}
 
 /**
  * @brief     ssd1351 full function
@@ -330,8 +727,27 @@ uint8_t ssd1351(uint8_t argc, char** argv)
     /* run the function */
     if (strcmp("t_display", type) == 0)
     {
+        /* set the spi irq */
+        g_spi_irq = ssd1351_display_test_async_irq_handler;
+        
         /* run display test */
         if (ssd1351_display_test() != 0)
+        {
+            g_spi_irq = NULL;
+            
+            return 1;
+        }
+        else
+        {
+            g_spi_irq = NULL;
+            
+            return 0;
+        }
+    }
+    else if (strcmp("t_flush", type) == 0)
+    {
+        /* run flush thread test */
+        if (a_ssd1351_flush_thread_test() != 0)
         {
             return 1;
         }
@@ -733,6 +1149,7 @@ uint8_t ssd1351(uint8_t argc, char** argv)
         ssd1351_interface_debug_print("  ssd1351 (-h | --help)\n");
         ssd1351_interface_debug_print("  ssd1351 (-p | --port)\n");
         ssd1351_interface_debug_print("  ssd1351 (-t display | --test=display)\n");
+        ssd1351_interface_debug_print("  ssd1351 (-t flush | --test=flush)\n");
         ssd1351_interface_debug_print("  ssd1351 (-e basic-init | --example=basic-init)\n");
         ssd1351_interface_debug_print("  ssd1351 (-e basic-deinit | --example=basic-deinit)\n");
         ssd1351_interface_debug_print("  ssd1351 (-e basic-str | --example=basic-str) [--str=<string>]\n");
@@ -768,7 +1185,7 @@ uint8_t ssd1351(uint8_t argc, char** argv)
         ssd1351_interface_debug_print("      --scroll            Set the scrolling number, if > 0 left scroll and < 0 right scroll.([default: 1])\n");
         ssd1351_interface_debug_print("      --start=<srow>      Set the scrolling start row and len + srow <= 128.([default: 0])\n");
         ssd1351_interface_debug_print("      --str=<string>      Set the display string.([default: libdriver])\n");
-        ssd1351_interface_debug_print("  -t <display>, --test=<display>\n");
+        ssd1351_interface_debug_print("  -t <display | flush>, --test=<display | flush>\n");
         ssd1351_interface_debug_print("                          Run the driver test.\n");
         ssd1351_interface_debug_print("      --x0=<x0>           Set the x0 and it is the x of the point.\n");
         ssd1351_interface_debug_print("      --x1=<x1>           Set the x1 and it is the top left x of the rect.\n");
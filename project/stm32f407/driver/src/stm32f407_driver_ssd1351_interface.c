@@ -80,6 +80,45 @@ uint8_t ssd1351_interface_spi_write_cmd(uint8_t *buf, uint16_t len)
     return spi_write_cmd(buf, len);
 }
 
+/**
+ * @brief     interface spi bus write vector
+ * @param[in] **buf pointer to a segment buffer array
+ * @param[in] *len pointer to a segment length array
+ * @param[in] num segment number
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      none
+ */
+uint8_t ssd1351_interface_spi_write_cmd_vector(uint8_t **buf, uint16_t *len, uint16_t num)
+{
+    uint16_t i;
+    
+    for (i = 0; i < num; i++)
+    {
+        if (spi_write_cmd(buf[i], len[i]) != 0)
+        {
+            return 1;
+        }
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     interface spi bus write async
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      the buffer is sent by the spi1 tx dma and g_spi_irq is called from the dma complete irq
+ */
+uint8_t ssd1351_interface_spi_write_cmd_async(uint8_t *buf, uint16_t len)
+{
+    return spi_write_cmd_dma(buf, len);
+}
+
 /**
  * @brief     interface delay ms
  * @param[in] ms time
@@ -174,6 +174,39 @@ uint8_t spi_write_read(uint8_t *in_buf, uint32_t in_len, uint8_t *out_buf, uint3
  */
 uint8_t spi_transmit(uint8_t *tx, uint8_t *rx, uint16_t len);
 
+/**
+ * @brief     spi bus write command with dma
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      the function returns when the transfer is started,
+ *            cs is set high and g_spi_irq is called by spi_dma_irq_handler when the transfer is done
+ */
+uint8_t spi_write_cmd_dma(uint8_t *buf, uint16_t len);
+
+/**
+ * @brief  spi get the handle
+ * @return pointer to a spi handle
+ * @note   none
+ */
+SPI_HandleTypeDef* spi_get_handle(void);
+
+/**
+ * @brief  spi get the dma handle
+ * @return pointer to a dma handle
+ * @note   none
+ */
+DMA_HandleTypeDef* spi_get_dma_handle(void);
+
+/**
+ * @brief     spi dma irq handler
+ * @param[in] res transfer result
+ * @note      none
+ */
+void spi_dma_irq_handler(uint8_t res);
+
 /**
  * @}
  */
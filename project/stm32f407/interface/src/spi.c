@@ -40,6 +40,12 @@
  * @brief spi var definition
  */
 SPI_HandleTypeDef g_spi_handle;        /**< spi handle */
+DMA_HandleTypeDef g_spi_dma_handle;    /**< spi dma handle */
+
+/**
+ * @brief spi irq definition
+ */
+extern uint8_t (*g_spi_irq)(uint8_t res);
 
 /**
  * @brief  spi cs init
@@ -495,3 +501,70 @@ uint8_t spi_write_read(uint8_t *in_buf, uint32_t in_len, uint8_t *out_buf, uint3
     
     return 0;
 }
+
+/**
+ * @brief     spi bus write command with dma
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      the function returns when the transfer is started,
+ *            cs is set high and g_spi_irq is called by spi_dma_irq_handler when the transfer is done
+ */
+uint8_t spi_write_cmd_dma(uint8_t *buf, uint16_t len)
+{
+    uint8_t res;
+    
+    /* set cs low */
+    HAL_GPIO_WritePin(GPIOA, GPIO_PIN_4, GPIO_PIN_RESET);
+    
+    /* start the dma transmit */
+    res = HAL_SPI_Transmit_DMA(&g_spi_handle, buf, len);
+    if (res != HAL_OK)
+    {
+        /* set cs high */
+        HAL_GPIO_WritePin(GPIOA, GPIO_PIN_4, GPIO_PIN_SET);
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief  spi get the handle
+ * @return pointer to a spi handle
+ * @note   none
+ */
+SPI_HandleTypeDef* spi_get_handle(void)
+{
+    return &g_spi_handle;
+}
+
+/**
+ * @brief  spi get the dma handle
+ * @return pointer to a dma handle
+ * @note   none
+ */
+DMA_HandleTypeDef* spi_get_dma_handle(void)
+{
+    return &g_spi_dma_handle;
+}
+
+/**
+ * @brief     spi dma irq handler
+ * @param[in] res transfer result
+ * @note      none
+ */
+void spi_dma_irq_handler(uint8_t res)
+{
+    /* set cs high */
+    HAL_GPIO_WritePin(GPIOA, GPIO_PIN_4, GPIO_PIN_SET);
+    
+    /* run the spi irq */
+    if (g_spi_irq != NULL)
+    {
+        (void)g_spi_irq(res);
+    }
+}
@@ -48,8 +48,9 @@
 /**
  * @brief global var definition
  */
-uint8_t g_buf[256];        /**< uart buffer */
-volatile uint16_t g_len;   /**< uart buffer length */
+uint8_t g_buf[256];                              /**< uart buffer */
+volatile uint16_t g_len;                         /**< uart buffer length */
+uint8_t (*g_spi_irq)(uint8_t res) = NULL;        /**< spi irq */
 
 /**
  * @brief     ssd1306 full function
@@ -326,13 +327,20 @@ uint8_t ssd1351(uint8_t argc, char** argv)
     /* run the function */
     if (strcmp("t_display", type) == 0)
     {
+        /* set the spi irq */
+        g_spi_irq = ssd1351_display_test_async_irq_handler;
+        
         /* run display test */
         if (ssd1351_display_test() != 0)
         {
+            g_spi_irq = NULL;
+            
             return 1;
         }
         else
         {
+            g_spi_irq = NULL;
+            
             return 0;
         }
     }
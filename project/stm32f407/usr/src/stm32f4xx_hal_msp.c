@@ -35,6 +35,7 @@
  */
 
 #include "stm32f4xx_hal.h"
+#include "spi.h"
 
 /** 
  * @defgroup msp HAL_MSP_Private_Functions
@@ -155,6 +156,7 @@ void HAL_UART_MspDeInit(UART_HandleTypeDef* huart)
 void HAL_SPI_MspInit(SPI_HandleTypeDef* hspi)
 {
     GPIO_InitTypeDef GPIO_InitStruct;
+    DMA_HandleTypeDef *hdma;
     
     if (hspi->Instance == SPI1)
     {
@@ -175,6 +177,30 @@ void HAL_SPI_MspInit(SPI_HandleTypeDef* hspi)
         GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_VERY_HIGH;
         GPIO_InitStruct.Alternate = GPIO_AF5_SPI1;
         HAL_GPIO_Init(GPIOA, &GPIO_InitStruct);
+        
+        /* enable dma2 clock */
+        __HAL_RCC_DMA2_CLK_ENABLE();
+        
+        /**
+         * DMA2_Stream3 Channel3 ------> SPI1_TX
+         */
+        hdma = spi_get_dma_handle();
+        hdma->Instance = DMA2_Stream3;
+        hdma->Init.Channel = DMA_CHANNEL_3;
+        hdma->Init.Direction = DMA_MEMORY_TO_PERIPH;
+        hdma->Init.PeriphInc = DMA_PINC_DISABLE;
+        hdma->Init.MemInc = DMA_MINC_ENABLE;
+        hdma->Init.PeriphDataAlignment = DMA_PDATAALIGN_BYTE;
+        hdma->Init.MemDataAlignment = DMA_MDATAALIGN_BYTE;
+        hdma->Init.Mode = DMA_NORMAL;
+        hdma->Init.Priority = DMA_PRIORITY_HIGH;
+        hdma->Init.FIFOMode = DMA_FIFOMODE_DISABLE;
+        (void)HAL_DMA_Init(hdma);
+        __HAL_LINKDMA(hspi, hdmatx, *hdma);
+        
+        /* enable nvic */
+        HAL_NVIC_SetPriority(DMA2_Stream3_IRQn, 1, 0);
+        HAL_NVIC_EnableIRQ(DMA2_Stream3_IRQn);
     }
 }
 
@@ -192,6 +218,12 @@ void HAL_SPI_MspDeInit(SPI_HandleTypeDef* hspi)
         
         /* spi gpio deinit */
         HAL_GPIO_DeInit(GPIOA, GPIO_PIN_5 | GPIO_PIN_6 | GPIO_PIN_7);
+        
+        /* spi dma deinit */
+        (void)HAL_DMA_DeInit(hspi->hdmatx);
+        
+        /* disable nvic */
+        HAL_NVIC_DisableIRQ(DMA2_Stream3_IRQn);
     }
 }
 
@@ -36,6 +36,7 @@
 
 #include "stm32f4xx_it.h"
 #include "uart.h"
+#include "spi.h"
 
 /**
  * @brief nmi handler
@@ -211,3 +212,40 @@ void HAL_UART_TxCpltCallback(UART_HandleTypeDef *huart)
         uart2_set_tx_done();
     }
 }
+
+/**
+ * @brief dma2 stream3 irq handler
+ * @note  none
+ */
+void DMA2_Stream3_IRQHandler(void)
+{
+    HAL_DMA_IRQHandler(spi_get_dma_handle());
+}
+
+/**
+ * @brief     spi tx finished callback
+ * @param[in] *hspi pointer to a spi handle
+ * @note      none
+ */
+void HAL_SPI_TxCpltCallback(SPI_HandleTypeDef *hspi)
+{
+    if (hspi->Instance == SPI1)
+    {
+        /* run the spi dma irq handler */
+        spi_dma_irq_handler(0);
+    }
+}
+
+/**
+ * @brief     spi error callback
+ * @param[in] *hspi pointer to a spi handle
+ * @note      none
+ */
+void HAL_SPI_ErrorCallback(SPI_HandleTypeDef *hspi)
+{
+    if (hspi->Instance == SPI1)
+    {
+        /* run the spi dma irq handler */
+        spi_dma_irq_handler(1);
+    }
+}
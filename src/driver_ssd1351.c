@@ -37,6 +37,32 @@
 
 #include "driver_ssd1351.h"
 #include "driver_ssd1351_font.h"
+#include "driver_ssd1351_font_packed.h"
+#include "driver_ssd1351_color.h"
+
+/**
+ * @brief color depth and color sequence of the pixel paths
+ */
+#if (SSD1351_FIXED_COLOR_DEPTH == 0xFF)
+    #define SSD1351_CONF_DEPTH(handle)       ((handle)->conf_1 & 0xC0)                                           /**< runtime color depth */
+#else
+    #define SSD1351_CONF_DEPTH(handle)       (((void)(handle)), (uint8_t)((SSD1351_FIXED_COLOR_DEPTH) << 6))     /**< fixed color depth */
+#endif
+#if (SSD1351_FIXED_COLOR_SEQUENCE == 0xFF)
+    #define SSD1351_CONF_SEQUENCE(handle)    ((handle)->conf_1 & 0x04)                                           /**< runtime color sequence */
+#else
+    #define SSD1351_CONF_SEQUENCE(handle)    (((void)(handle)), (uint8_t)((SSD1351_FIXED_COLOR_SEQUENCE) << 2))  /**< fixed color sequence */
+#endif
+
+/**
+ * @brief max width and height of a glyph
+ */
+#define SSD1351_GLYPH_MAX_SIZE       32          /**< 32 pixels */
+
+/**
+ * @brief glyph cache format of the transparent glyph runs
+ */
+#define SSD1351_GLYPH_FORMAT_RUNS    0x01        /**< never a color depth and color sequence */
 
 /**
  * @brief chip information definition
@@ -55,6 +81,77 @@
  */
 #define SSD1351_CMD         0        /**< command type */
 #define SSD1351_DATA        1        /**< data type */
+#define SSD1351_DC_UNKNOWN  0xFF     /**< unknown dc level */
+
+/**
+ * @brief dirty tile definition
+ */
+#define SSD1351_TILE_SIZE                8          /**< tile size in pixels */
+#define SSD1351_TILE_NUM                 16         /**< tiles per line */
+#define SSD1351_DIRTY_RECT_MAX           128        /**< max dirty rectangle number */
+#define SSD1351_WINDOW_SETUP_BYTES       7          /**< column, row and write ram bytes */
+#define SSD1351_DRAW_NONE                0xFF       /**< culled display list item */
+
+/**
+ * @brief dirty rectangle structure definition
+ */
+typedef struct ssd1351_dirty_rect_s
+{
+    uint8_t left;          /**< left tile */
+    uint8_t top;           /**< top tile */
+    uint8_t right;         /**< right tile */
+    uint8_t bottom;        /**< bottom tile */
+} ssd1351_dirty_rect_t;
+
+/**
+ * @brief arc structure definition
+ */
+typedef struct ssd1351_arc_s
+{
+    int16_t x;              /**< center x */
+    int16_t y;              /**< center y */
+    int32_t start_x;        /**< start direction x */
+    int32_t start_y;        /**< start direction y */
+    int32_t end_x;          /**< end direction x */
+    int32_t end_y;          /**< end direction y */
+    uint16_t sweep;         /**< sweep angle in degrees */
+} ssd1351_arc_t;
+
+/**
+ * @brief box structure definition
+ */
+typedef struct ssd1351_box_s
+{
+    int16_t left;          /**< left coordinate x */
+    int16_t top;           /**< top coordinate y */
+    int16_t right;         /**< right coordinate x */
+    int16_t bottom;        /**< bottom coordinate y */
+} ssd1351_box_t;
+
+/**
+ * @brief polygon edge structure definition
+ */
+typedef struct ssd1351_edge_s
+{
+    int32_t x;             /**< x at the current sample in 1/65536 pixel */
+    int32_t dx;            /**< x step per 1/16 pixel of y in 1/65536 pixel */
+    int16_t top;           /**< top y in 1/16 pixel */
+    int16_t bottom;        /**< bottom y in 1/16 pixel */
+    int8_t dir;            /**< winding direction */
+} ssd1351_edge_t;
+
+/**
+ * @brief sine table of 0 - 90 degrees scaled by 1024
+ */
+static const uint16_t gsc_ssd1351_sin[91] =
+{
+       0,   18,   36,   54,   71,   89,  107,  125,  143,  160,  178,  195,  213,  230,  248,  265, 
+     282,  299,  316,  333,  350,  367,  384,  400,  416,  433,  449,  465,  481,  496,  512,  527, 
+     543,  558,  573,  587,  602,  616,  630,  644,  658,  672,  685,  698,  711,  724,  737,  749, 
+     761,  773,  784,  796,  807,  818,  828,  839,  849,  859,  868,  878,  887,  896,  904,  912, 
+     920,  928,  935,  943,  949,  956,  962,  968,  974,  979,  984,  989,  994,  998, 1002, 1005, 
+    1008, 1011, 1014, 1016, 1018, 1020, 1022, 1023, 1023, 1024, 1024, 
+};
 
 /**
  * @brief command definition
@@ -91,27 +188,69 @@
 #define SSD1351_CMD_START_MOVING                        0x9F        /**< start moving command */
 
 /**
- * @brief     write one byte
+ * @brief     set the command data gpio level
  * @param[in] *handle pointer to an ssd1351 handle structure
- * @param[in] data written data
+ * @param[in] cmd data type
+ * @return    status code
+ *            - 0 success
+ *            - 1 set failed
+ * @note      the gpio is only written when the cached level differs,
+ *            it fails while an async transfer owns the bus
+ */
+static uint8_t a_ssd1351_set_dc(ssd1351_handle_t *handle, uint8_t cmd)
+{
+    if (handle->async_status == SSD1351_ASYNC_STATUS_BUSY)    /* check async status */
+    {
+        handle->debug_print("ssd1351: async is busy.\n");     /* async is busy */
+        
+        return 1;                                             /* return error */
+    }
+    if (handle->dc == cmd)                                    /* check cached level */
+    {
+        return 0;                                             /* success return 0 */
+    }
+    if (handle->cmd_data_gpio_write(cmd) != 0)                /* write gpio */
+    {
+        handle->dc = SSD1351_DC_UNKNOWN;                      /* invalidate level */
+        
+        return 1;                                             /* return error */
+    }
+    handle->dc = cmd;                                         /* save level */
+    
+    return 0;                                                 /* success return 0 */
+}
+
+/**
+ * @brief     write bytes
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @param[in] *data pointer to a data buffer
+ * @param[in] len data length
  * @param[in] cmd data type
  * @return    status code
  *            - 0 success
  *            - 1 write failed
  * @note      none
  */
-static uint8_t a_ssd1351_write_byte(ssd1351_handle_t *handle, uint8_t data, uint8_t cmd)
+static uint8_t a_ssd1351_write_bytes(ssd1351_handle_t *handle, uint8_t *data, uint16_t len, uint8_t cmd)
 {
     uint8_t res;
-    
-    res = handle->cmd_data_gpio_write(cmd);        /* write gpio */
+
+    res = a_ssd1351_set_dc(handle, cmd);           /* set dc */
     if (res != 0)                                  /* check result */
     {
+        handle->window_valid = 0;                  /* invalidate window */
+        
         return 1;                                  /* return error */
     }
-    res = handle->spi_write_cmd(&data, 1);         /* write data command */
+    if (cmd == SSD1351_CMD)                        /* if command */
+    {
+        handle->ram_mode = 0;                      /* exit write ram mode */
+    }
+    res = handle->spi_write_cmd(data, len);        /* write data command */
     if (res != 0)                                  /* check result */
     {
+        handle->window_valid = 0;                  /* invalidate window */
+        
         return 1;                                  /* return error */
     }
     else
@@ -121,862 +260,6469 @@ static uint8_t a_ssd1351_write_byte(ssd1351_handle_t *handle, uint8_t data, uint
 }
 
 /**
- * @brief     set the display column address
+ * @brief     send the inner buffer as data
  * @param[in] *handle pointer to an ssd1351 handle structure
- * @param[in] start_address start address
- * @param[in] end_address end address
  * @return    status code
  *            - 0 success
- *            - 1 set column address failed
- *            - 2 handle is NULL
- *            - 3 handle is not initialized
- *            - 4 address is invalid
- *            - 5 start_address > end_address
- * @note      start_address <= 127 && end_address <= 127 && start_address <= end_address
+ *            - 1 send failed
+ * @note      none
  */
-uint8_t ssd1351_set_column_address(ssd1351_handle_t *handle, uint8_t start_address, uint8_t end_address)
+static uint8_t a_ssd1351_buffer_send(ssd1351_handle_t *handle)
 {
-    if (handle == NULL)                                                                  /* check handle */
+    uint16_t len;
+
+    len = handle->buf_len;                                                 /* get length */
+    handle->buf_len = 0;                                                   /* clear length */
+    if (len == 0)                                                          /* check length */
     {
-        return 2;                                                                        /* return error */
+        return 0;                                                          /* success return 0 */
     }
-    if (handle->inited != 1)                                                             /* check handle initialization */
+
+    return a_ssd1351_write_bytes(handle, handle->buf, len, SSD1351_DATA);  /* write data */
+}
+
+/**
+ * @brief     flush the inner buffer at the end of a draw
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 flush failed
+ * @note      nothing is sent when the framebuffer is enabled,
+ *            so rendering into the framebuffer never touches the bus
+ */
+static uint8_t a_ssd1351_buffer_flush(ssd1351_handle_t *handle)
+{
+    if (handle->fb != NULL)                                                /* if framebuffer */
     {
-        return 3;                                                                        /* return error */
+        return 0;                                                          /* success return 0 */
     }
-    if ((start_address > 127) || (end_address > 127))                                    /* check range */
+    
+    return a_ssd1351_buffer_send(handle);                                  /* send buffer */
+}
+
+/**
+ * @brief     write one byte
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @param[in] data written data
+ * @param[in] cmd data type
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      none
+ */
+static uint8_t a_ssd1351_write_byte(ssd1351_handle_t *handle, uint8_t data, uint8_t cmd)
+{
+    uint8_t res;
+    
+    if (handle->buf_len != 0)                      /* check buffered data */
     {
-        handle->debug_print("ssd1351: address is invalid.\n");                           /* address is invalid */
-        
-        return 4;                                                                        /* return error */
+        res = a_ssd1351_buffer_send(handle);       /* flush buffer */
+        if (res != 0)                              /* check result */
+        {
+            return 1;                              /* return error */
+        }
     }
-    if (start_address > end_address)                                                     /* check range */
+    res = a_ssd1351_set_dc(handle, cmd);           /* set dc */
+    if (res != 0)                                  /* check result */
     {
-        handle->debug_print("ssd1351: start_address > end_address.\n");                  /* start_address > end_address */
+        handle->window_valid = 0;                  /* invalidate window */
         
-        return 5;                                                                        /* return error */
+        return 1;                                  /* return error */
     }
-
-    if (a_ssd1351_write_byte(handle, SSD1351_CMD_SET_COLUMN_ADDRESS, SSD1351_CMD) != 0)  /* write column address command */
+    if (cmd == SSD1351_CMD)                        /* if command */
     {
-        handle->debug_print("ssd1351: write command failed.\n");                         /* write command failed */
-        
-        return 1;                                                                        /* return error */
+        handle->ram_mode = 0;                      /* exit write ram mode */
     }
-    if (a_ssd1351_write_byte(handle, start_address, SSD1351_DATA) != 0)                  /* set start address */
+    res = handle->spi_write_cmd(&data, 1);         /* write data command */
+    if (res != 0)                                  /* check result */
     {
-        handle->debug_print("ssd1351: write start address failed.\n");                   /* write start address failed */
+        handle->window_valid = 0;                  /* invalidate window */
         
-        return 1;                                                                        /* return error */
+        return 1;                                  /* return error */
     }
-    if (a_ssd1351_write_byte(handle, end_address, SSD1351_DATA) != 0)                    /* set end address */
+    else
     {
-        handle->debug_print("ssd1351: write end address failed.\n");                     /* write end address failed */
-        
-        return 1;                                                                        /* return error */
+        return 0;                                  /* success return 0 */
     }
-
-    return 0;                                                                            /* success return 0 */
 }
 
 /**
- * @brief     set the row address
+ * @brief     get the bytes of one pixel at the current color depth
  * @param[in] *handle pointer to an ssd1351 handle structure
- * @param[in] start_address start address
- * @param[in] end_address end address
- * @return    status code
- *            - 0 success
- *            - 1 set row address failed
- *            - 2 handle is NULL
- *            - 3 handle is not initialized
- *            - 4 address is invalid
- *            - 5 start_address > end_address
- * @note      start_address <= 127 && end_address <= 127 && start_address <= end_address
+ * @return    pixel bytes
+ * @note      none
  */
-uint8_t ssd1351_set_row_address(ssd1351_handle_t *handle, uint8_t start_address, uint8_t end_address)
+static uint8_t a_ssd1351_pixel_bytes(ssd1351_handle_t *handle)
 {
-    if (handle == NULL)                                                              /* check handle */
+    if (SSD1351_CONF_DEPTH(handle) == 0)               /* if 256 */
     {
-        return 2;                                                                    /* return error */
+        return 1;                                      /* 1 byte */
     }
-    if (handle->inited != 1)                                                         /* check handle initialization */
+    else if (SSD1351_CONF_DEPTH(handle) == 0x40)       /* if 65K */
     {
-        return 3;                                                                    /* return error */
+        return 2;                                      /* 2 bytes */
     }
-    if ((start_address > 127) || (end_address > 127))                                /* check range */
+    else                                               /* if 262K */
     {
-        handle->debug_print("ssd1351: address is invalid.\n");                       /* address is invalid */
-        
-        return 4;                                                                    /* return error */
+        return 3;                                      /* 3 bytes */
     }
-    if (start_address > end_address)                                                 /* check range */
+}
+
+/**
+ * @brief     get the address increment of the following writes
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @return    address increment
+ * @note      the framebuffer cursor keeps its own increment so conf_1 always matches the panel
+ */
+static uint8_t a_ssd1351_get_increment(ssd1351_handle_t *handle)
+{
+    if (handle->fb != NULL)                            /* if framebuffer */
     {
-        handle->debug_print("ssd1351: start_address > end_address.\n");              /* start_address > end_address */
-        
-        return 5;                                                                    /* return error */
+        return handle->fb_increment;                   /* framebuffer cursor increment */
     }
     
-    if (a_ssd1351_write_byte(handle, SSD1351_CMD_SET_ROW_ADDRESS, SSD1351_CMD)!= 0)  /* set row address */
+    return handle->conf_1 & 0x01;                      /* panel increment */
+}
+
+/**
+ * @brief     write one data byte into the framebuffer
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @param[in] data written data
+ * @note      the framebuffer cursor follows the address increment like the gram
+ */
+static void a_ssd1351_framebuffer_write(ssd1351_handle_t *handle, uint8_t data)
+{
+    uint8_t bytes;
+    
+    bytes = a_ssd1351_pixel_bytes(handle);                                         /* get pixel bytes */
+    handle->fb[((uint32_t)handle->fb_row * 128 + handle->fb_column) * bytes + 
+               handle->fb_byte] = data;                                            /* set data */
+    handle->fb_byte++;                                                             /* byte++ */
+    if (handle->fb_byte < bytes)                                                   /* check pixel end */
     {
-        handle->debug_print("ssd1351: write command failed.\n");                     /* write command failed */
-        
-        return 1;                                                                    /* return error */
+        return;                                                                    /* return */
     }
-    if (a_ssd1351_write_byte(handle, start_address, SSD1351_DATA) != 0)              /* set start address */
+    handle->fb_byte = 0;                                                           /* next pixel */
+    if (handle->fb_increment != 0)                                                 /* if vertical increment */
     {
-        handle->debug_print("ssd1351: write start address failed.\n");               /* write start address failed */
-        
-        return 1;                                                                    /* return error */
+        handle->fb_row++;                                                          /* row++ */
+        if (handle->fb_row > handle->fb_bottom)                                    /* check row end */
+        {
+            handle->fb_row = handle->fb_top;                                       /* reset row */
+            handle->fb_column++;                                                   /* column++ */
+            if (handle->fb_column > handle->fb_right)                              /* check column end */
+            {
+                handle->fb_column = handle->fb_left;                               /* reset column */
+            }
+        }
     }
-    if (a_ssd1351_write_byte(handle, end_address, SSD1351_DATA) != 0)                /* set end address */
+    else                                                                           /* if horizontal increment */
     {
-        handle->debug_print("ssd1351: write end address failed.\n");                 /* write end address failed */
-        
-        return 1;                                                                    /* return error */
+        handle->fb_column++;                                                       /* column++ */
+        if (handle->fb_column > handle->fb_right)                                  /* check column end */
+        {
+            handle->fb_column = handle->fb_left;                                   /* reset column */
+            handle->fb_row++;                                                      /* row++ */
+            if (handle->fb_row > handle->fb_bottom)                                /* check row end */
+            {
+                handle->fb_row = handle->fb_top;                                   /* reset row */
+            }
+        }
     }
-
-    return 0;                                                                        /* success return 0 */
 }
 
 /**
- * @brief     sent the write ram command
+ * @brief     append data bytes into the inner buffer
  * @param[in] *handle pointer to an ssd1351 handle structure
+ * @param[in] *data pointer to a data buffer
+ * @param[in] len data length
  * @return    status code
  *            - 0 success
- *            - 1 write ram failed
- *            - 2 handle is NULL
- *            - 3 handle is not initialized
- * @note      none
+ *            - 1 write failed
+ * @note      the buffer is flushed when it is full
  */
-uint8_t ssd1351_write_ram(ssd1351_handle_t *handle)
+static uint8_t a_ssd1351_buffer_append(ssd1351_handle_t *handle, const uint8_t *data, uint32_t len)
 {
-    if (handle == NULL)                                                         /* check handle */
-    {
-        return 2;                                                               /* return error */
-    }
-    if (handle->inited != 1)                                                    /* check handle initialization */
-    {
-        return 3;                                                               /* return error */
-    }
+    uint32_t l;
     
-    if (a_ssd1351_write_byte(handle, SSD1351_CMD_WRITE_RAM, SSD1351_CMD) != 0)  /* set write ram */
+    while (len != 0)                                                       /* loop all */
     {
-        handle->debug_print("ssd1351: write ram failed.\n");                    /* write ram failed */
-        
-        return 1;                                                               /* return error */
+        l = SSD1351_BUFFER_SIZE - handle->buf_len;                         /* get free length */
+        if (l > len)                                                       /* check length */
+        {
+            l = len;                                                       /* set length */
+        }
+        memcpy(&handle->buf[handle->buf_len], data, l);                    /* copy data */
+        handle->buf_len += (uint16_t)l;                                    /* length += l */
+        data += l;                                                         /* data += l */
+        len -= l;                                                          /* len -= l */
+        if (handle->buf_len >= SSD1351_BUFFER_SIZE)                        /* check full */
+        {
+            if (a_ssd1351_buffer_send(handle) != 0)                        /* flush buffer */
+            {
+                return 1;                                                  /* return error */
+            }
+        }
     }
     
-    return 0;                                                                   /* success return 0 */
+    return 0;                                                              /* success return 0 */
 }
 
 /**
- * @brief     sent the read ram command
+ * @brief     advance the shadow write pointer
  * @param[in] *handle pointer to an ssd1351 handle structure
- * @return    status code
- *            - 0 success
- *            - 1 read ram failed
- *            - 2 handle is NULL
- *            - 3 handle is not initialized
+ * @param[in] len written pixel length
  * @note      none
  */
-uint8_t ssd1351_read_ram(ssd1351_handle_t *handle)
+static void a_ssd1351_window_advance(ssd1351_handle_t *handle, uint32_t len)
 {
-    if (handle == NULL)                                                        /* check handle */
-    {
-        return 2;                                                              /* return error */
-    }
-    if (handle->inited != 1)                                                   /* check handle initialization */
+    uint32_t width;
+    uint32_t height;
+    uint32_t pos;
+    
+    width = (uint32_t)(handle->column_end - handle->column_start) + 1;         /* get window width */
+    height = (uint32_t)(handle->row_end - handle->row_start) + 1;              /* get window height */
+    if ((handle->conf_1 & 0x01) != 0)                                          /* if vertical increment */
     {
-        return 3;                                                              /* return error */
+        pos = (uint32_t)(handle->column - handle->column_start) * height + 
+              (uint32_t)(handle->row - handle->row_start);                     /* get position */
+        pos = (pos + len) % (width * height);                                  /* advance position */
+        handle->column = (uint8_t)(handle->column_start + pos / height);       /* set column pointer */
+        handle->row = (uint8_t)(handle->row_start + pos % height);             /* set row pointer */
     }
-  
-    if (a_ssd1351_write_byte(handle, SSD1351_CMD_READ_RAM, SSD1351_CMD) != 0)  /* set read ram */
+    else                                                                       /* if horizontal increment */
     {
-        handle->debug_print("ssd1351: read command failed.\n");                /* return error */
-        
-        return 1;
+        pos = (uint32_t)(handle->row - handle->row_start) * width + 
+              (uint32_t)(handle->column - handle->column_start);               /* get position */
+        pos = (pos + len) % (width * height);                                  /* advance position */
+        handle->row = (uint8_t)(handle->row_start + pos / width);              /* set row pointer */
+        handle->column = (uint8_t)(handle->column_start + pos % width);        /* set column pointer */
     }
-    
-    return 0;                                                                  /* success return 0 */
 }
 
 /**
- * @brief     set the display color depth
+ * @brief     set the gram write window and enter the write ram mode
  * @param[in] *handle pointer to an ssd1351 handle structure
- * @param[in] color_depth color depth
+ * @param[in] left left address of the window
+ * @param[in] top top address of the window
+ * @param[in] right right address of the window
+ * @param[in] bottom bottom address of the window
+ * @param[in] len pixel length to be written
  * @return    status code
  *            - 0 success
- *            - 1 set color depth failed
- *            - 2 handle is NULL
- *            - 3 handle is not initialized
- * @note      none
+ *            - 1 set window failed
+ * @note      only the changed address commands are sent, a single pixel at the
+ *            write pointer reuses the current window and the shadow write
+ *            pointer is advanced by len pixels
  */
-uint8_t ssd1351_set_color_depth(ssd1351_handle_t *handle, ssd1351_color_depth_t color_depth)
+static uint8_t a_ssd1351_set_gram_window(ssd1351_handle_t *handle, uint8_t left, uint8_t top, uint8_t right, uint8_t bottom, uint32_t len)
 {
-    if (handle == NULL)                                                                     /* check handle */
+    uint8_t param[2];
+    
+    if (handle->async_status == SSD1351_ASYNC_STATUS_BUSY)                               /* check async status */
     {
-        return 2;                                                                           /* return error */
+        handle->debug_print("ssd1351: async is busy.\n");                                /* async is busy */
+        
+        return 1;                                                                        /* return error */
     }
-    if (handle->inited != 1)                                                                /* check handle initialization */
+    if ((len == 1) && (handle->window_valid != 0) && (handle->ram_mode != 0) && 
+        (handle->column == left) && (handle->row == top))                                /* check single pixel at pointer */
     {
-        return 3;                                                                           /* return error */
+        a_ssd1351_window_advance(handle, 1);                                             /* advance write pointer */
+        
+        return 0;                                                                        /* success return 0 */
     }
-    
-    handle->conf_1 &= ~ (3 << 6);                                                           /* clear conf */
-    handle->conf_1 |= color_depth << 6;                                                     /* set conf */
-    if (a_ssd1351_write_byte(handle, SSD1351_CMD_SET_REMAP_COLOR_DEPTH, SSD1351_CMD) != 0)  /* set color depth */
+    if ((handle->window_valid == 0) || (handle->column_start != left) || 
+        (handle->column_end != right) || (handle->column != left))                       /* check column */
     {
-        handle->debug_print("ssd1351: write color depth failed.\n");                        /* write color depth failed */
-        
-        return 1;                                                                           /* return error */
+        if (a_ssd1351_write_byte(handle, SSD1351_CMD_SET_COLUMN_ADDRESS, SSD1351_CMD) != 0)  /* write column address command */
+        {
+            handle->debug_print("ssd1351: write command failed.\n");                     /* write command failed */
+            
+            return 1;                                                                    /* return error */
+        }
+        param[0] = left;                                                                 /* set start address */
+        param[1] = right;                                                                /* set end address */
+        if (a_ssd1351_write_bytes(handle, param, 2, SSD1351_DATA) != 0)                  /* set start and end address */
+        {
+            handle->debug_print("ssd1351: write address failed.\n");                     /* write address failed */
+            
+            return 1;                                                                    /* return error */
+        }
+        handle->column_start = left;                                                     /* save column start */
+        handle->column_end = right;                                                      /* save column end */
+        handle->column = left;                                                           /* save column pointer */
     }
-    if (a_ssd1351_write_byte(handle, handle->conf_1, SSD1351_DATA) != 0)                    /* set conf */
+    if ((handle->window_valid == 0) || (handle->row_start != top) || 
+        (handle->row_end != bottom) || (handle->row != top))                             /* check row */
     {
-        handle->debug_print("ssd1351: write color depth failed.\n");                        /* write color depth failed */
-        
-        return 1;                                                                           /* return error */
+        if (a_ssd1351_write_byte(handle, SSD1351_CMD_SET_ROW_ADDRESS, SSD1351_CMD) != 0) /* write row address command */
+        {
+            handle->debug_print("ssd1351: write command failed.\n");                     /* write command failed */
+            
+            return 1;                                                                    /* return error */
+        }
+        param[0] = top;                                                                  /* set start address */
+        param[1] = bottom;                                                               /* set end address */
+        if (a_ssd1351_write_bytes(handle, param, 2, SSD1351_DATA) != 0)                  /* set start and end address */
+        {
+            handle->debug_print("ssd1351: write address failed.\n");                     /* write address failed */
+            
+            return 1;                                                                    /* return error */
+        }
+        handle->row_start = top;                                                         /* save row start */
+        handle->row_end = bottom;                                                        /* save row end */
+        handle->row = top;                                                               /* save row pointer */
+    }
+    if (handle->ram_mode == 0)                                                           /* check write ram mode */
+    {
+        if (a_ssd1351_write_byte(handle, SSD1351_CMD_WRITE_RAM, SSD1351_CMD) != 0)       /* set write ram */
+        {
+            handle->debug_print("ssd1351: write ram failed.\n");                         /* write ram failed */
+            
+            return 1;                                                                    /* return error */
+        }
+        handle->ram_mode = 1;                                                            /* enter write ram mode */
     }
+    handle->window_valid = 1;                                                            /* flag window valid */
+    a_ssd1351_window_advance(handle, len);                                               /* advance write pointer */
     
-    return 0;                                                                               /* success return 0 */
+    return 0;                                                                            /* success return 0 */
 }
 
 /**
- * @brief     set the address increment
+ * @brief     mark a region of the framebuffer as dirty
  * @param[in] *handle pointer to an ssd1351 handle structure
- * @param[in] increment address increment param
- * @return    status code
- *            - 0 success
- *            - 1 set address increment failed
- *            - 2 handle is NULL
- *            - 3 handle is not initialized
- * @note      none
+ * @param[in] left left address of the region
+ * @param[in] top top address of the region
+ * @param[in] right right address of the region
+ * @param[in] bottom bottom address of the region
+ * @note      the region is marked in tiles
  */
-uint8_t ssd1351_set_address_increment(ssd1351_handle_t *handle, ssd1351_address_increment_t increment)
+static void a_ssd1351_framebuffer_mark(ssd1351_handle_t *handle, uint8_t left, uint8_t top, uint8_t right, uint8_t bottom)
 {
-    if (handle == NULL)                                                                     /* check handle */
-    {
-        return 2;                                                                           /* return error */
-    }
-    if (handle->inited != 1)                                                                /* check handle initialization */
+    uint8_t i;
+    uint16_t mask;
+    
+    mask = (uint16_t)(((1UL << (right / SSD1351_TILE_SIZE + 1)) - 1) & 
+                      ~((1UL << (left / SSD1351_TILE_SIZE)) - 1));           /* get tile mask */
+    for (i = top / SSD1351_TILE_SIZE; i <= bottom / SSD1351_TILE_SIZE; i++)   /* loop tile rows */
     {
-        return 3;                                                                           /* return error */
+        handle->dirty[i] |= mask;                                             /* mark tiles */
     }
+}
+
+/**
+ * @brief     get the cost of sending a dirty rectangle
+ * @param[in] *rect pointer to a dirty rectangle structure
+ * @param[in] bytes pixel bytes
+ * @return    cost in bytes
+ * @note      none
+ */
+static uint32_t a_ssd1351_dirty_rect_cost(ssd1351_dirty_rect_t *rect, uint8_t bytes)
+{
+    return SSD1351_WINDOW_SETUP_BYTES + (uint32_t)(rect->right - rect->left + 1) * 
+           (uint32_t)(rect->bottom - rect->top + 1) * SSD1351_TILE_SIZE * SSD1351_TILE_SIZE * bytes;
+}
+
+/**
+ * @brief      coalesce the dirty tiles into rectangles
+ * @param[in]  *handle pointer to an ssd1351 handle structure
+ * @param[in]  *dirty pointer to a dirty tile bitmap
+ * @param[out] *rect pointer to a dirty rectangle buffer
+ * @return     rectangle number
+ * @note       the rectangle buffer must hold SSD1351_DIRTY_RECT_MAX rectangles,
+ *             after a merge only the grown rectangle is tested against the others again,
+ *             rectangles that were kept apart stay apart because a merge never shrinks a rectangle
+ */
+static uint16_t a_ssd1351_dirty_coalesce(ssd1351_handle_t *handle, const uint16_t *dirty, ssd1351_dirty_rect_t *rect)
+{
+    uint8_t bytes;
+    uint8_t x;
+    uint8_t x0;
+    uint8_t y;
+    uint16_t i;
+    uint16_t j;
+    uint16_t k;
+    uint16_t num;
+    uint32_t cost;
+    uint32_t merged;
+    ssd1351_dirty_rect_t b;
     
-    handle->conf_1 &= ~ (1 << 0);                                                           /* clear conf */
-    handle->conf_1 |= increment << 0;                                                       /* set conf */
-    if (a_ssd1351_write_byte(handle, SSD1351_CMD_SET_REMAP_COLOR_DEPTH, SSD1351_CMD) != 0)  /* set address increment */
+    num = 0;                                                                                 /* init 0 */
+    for (y = 0; y < SSD1351_TILE_NUM; y++)                                                   /* loop tile rows */
     {
-        handle->debug_print("ssd1351: write address increment failed.\n");                  /* write address increment failed */
-        
-        return 1;                                                                           /* return error */
+        x = 0;                                                                               /* init 0 */
+        while (x < SSD1351_TILE_NUM)                                                         /* loop tile columns */
+        {
+            if ((dirty[y] & (1U << x)) == 0)                                                 /* check tile */
+            {
+                x++;                                                                         /* next tile */
+                
+                continue;                                                                    /* continue */
+            }
+            x0 = x;                                                                          /* run start */
+            while ((x < SSD1351_TILE_NUM) && ((dirty[y] & (1U << x)) != 0))                  /* find run end */
+            {
+                x++;                                                                         /* next tile */
+            }
+            for (k = 0; k < num; k++)                                                        /* find the same run above */
+            {
+                if ((rect[k].bottom + 1 == y) && (rect[k].left == x0) && (rect[k].right == x - 1))
+                {
+                    break;                                                                   /* break */
+                }
+            }
+            if (k < num)                                                                     /* if found */
+            {
+                rect[k].bottom = y;                                                          /* extend down */
+            }
+            else
+            {
+                rect[num].left = x0;                                                         /* set left */
+                rect[num].top = y;                                                           /* set top */
+                rect[num].right = x - 1;                                                     /* set right */
+                rect[num].bottom = y;                                                        /* set bottom */
+                num++;                                                                       /* num++ */
+            }
+        }
     }
-    if (a_ssd1351_write_byte(handle, handle->conf_1, SSD1351_DATA) != 0)                    /* set conf */
+    
+    bytes = a_ssd1351_pixel_bytes(handle);                                                   /* get pixel bytes */
+    for (i = 0; i < num; i++)                                                                /* loop all */
     {
-        handle->debug_print("ssd1351: write address increment failed.\n");                  /* write address increment failed */
-        
-        return 1;                                                                           /* return error */
+        cost = a_ssd1351_dirty_rect_cost(&rect[i], bytes);                                   /* get the rectangle cost */
+        j = i + 1;                                                                           /* the rectangles before were tested */
+        while (j < num)                                                                      /* loop others */
+        {
+            if (j == i)                                                                      /* check itself */
+            {
+                j++;                                                                         /* next rectangle */
+                
+                continue;                                                                    /* continue */
+            }
+            b.left = (rect[i].left < rect[j].left) ? rect[i].left : rect[j].left;            /* get left */
+            b.top = (rect[i].top < rect[j].top) ? rect[i].top : rect[j].top;                 /* get top */
+            b.right = (rect[i].right > rect[j].right) ? rect[i].right : rect[j].right;       /* get right */
+            b.bottom = (rect[i].bottom > rect[j].bottom) ? rect[i].bottom : rect[j].bottom;  /* get bottom */
+            merged = a_ssd1351_dirty_rect_cost(&b, bytes);                                   /* get the merged cost */
+            if (merged > cost + a_ssd1351_dirty_rect_cost(&rect[j], bytes))                  /* check cost */
+            {
+                j++;                                                                         /* merging costs more */
+                
+                continue;                                                                    /* continue */
+            }
+            for (k = 0; k < num; k++)                                                        /* check the other rectangles */
+            {
+                if ((k != i) && (k != j) && 
+                    (rect[k].left <= b.right) && (rect[k].right >= b.left) && 
+                    (rect[k].top <= b.bottom) && (rect[k].bottom >= b.top))
+                {
+                    break;                                                                   /* overlapped */
+                }
+            }
+            if (k < num)                                                                     /* if overlapped */
+            {
+                j++;                                                                         /* keep them apart */
+                
+                continue;                                                                    /* continue */
+            }
+            rect[i] = b;                                                                     /* merge */
+            cost = merged;                                                                   /* set the rectangle cost */
+            memmove(&rect[j], &rect[j + 1], sizeof(ssd1351_dirty_rect_t) * (num - j - 1));   /* remove */
+            num--;                                                                           /* num-- */
+            if (j < i)                                                                       /* if removed before */
+            {
+                i--;                                                                         /* follow the merged rectangle */
+            }
+            j = 0;                                                                           /* only test the grown rectangle again */
+        }
     }
     
-    return 0;                                                                               /* success return 0 */
+    return num;                                                                              /* return number */
 }
 
 /**
- * @brief     set the seg0 map
+ * @brief     set the write window
  * @param[in] *handle pointer to an ssd1351 handle structure
- * @param[in] seg0_map seg0 map
+ * @param[in] left left address of the window
+ * @param[in] top top address of the window
+ * @param[in] right right address of the window
+ * @param[in] bottom bottom address of the window
+ * @param[in] len pixel length to be written
  * @return    status code
  *            - 0 success
- *            - 1 set seg0 map failed
- *            - 2 handle is NULL
- *            - 3 handle is not initialized
- * @note      none
+ *            - 1 set window failed
+ * @note      when the framebuffer is enabled the window is opened in the framebuffer
+ *            and the written region is marked as dirty
  */
-uint8_t ssd1351_set_seg0_map(ssd1351_handle_t *handle, ssd1351_seg0_mapped_t seg0_map)
+static uint8_t a_ssd1351_set_window(ssd1351_handle_t *handle, uint8_t left, uint8_t top, uint8_t right, uint8_t bottom, uint32_t len)
 {
-    if (handle == NULL)                                                                     /* check handle */
+    if (handle->list_buf != NULL)                                                        /* check display list */
     {
-        return 2;                                                                           /* return error */
+        handle->debug_print("ssd1351: display list is recording.\n");                   /* display list is recording */
+        
+        return 1;                                                                        /* return error */
     }
-    if (handle->inited != 1)                                                                /* check handle initialization */
+    if (handle->async_status == SSD1351_ASYNC_STATUS_BUSY)                               /* check async status */
     {
-        return 3;                                                                           /* return error */
+        handle->debug_print("ssd1351: async is busy.\n");                                /* async is busy */
+        
+        return 1;                                                                        /* return error */
     }
-    
-    handle->conf_1 &= ~ (1 << 1);                                                           /* clear conf */
-    handle->conf_1 |= seg0_map << 1;                                                        /* set conf */
-    if (a_ssd1351_write_byte(handle, SSD1351_CMD_SET_REMAP_COLOR_DEPTH, SSD1351_CMD) != 0)  /* set seg0 map */
+    if (handle->fb == NULL)                                                              /* if no framebuffer */
     {
-        handle->debug_print("ssd1351: write seg0 map failed.\n");                           /* write seg0 map failed */
-        
-        return 1;                                                                           /* return error */
+        return a_ssd1351_set_gram_window(handle, left, top, right, bottom, len);         /* set gram window */
     }
-    if (a_ssd1351_write_byte(handle, handle->conf_1, SSD1351_DATA) != 0)                    /* set conf */
+    if (handle->fb_len < (uint32_t)128 * 128 * a_ssd1351_pixel_bytes(handle))            /* check framebuffer length */
     {
-        handle->debug_print("ssd1351: write seg0 map failed.\n");                           /* write seg0 map failed */
+        handle->debug_print("ssd1351: framebuffer is too small.\n");                     /* framebuffer is too small */
         
-        return 1;                                                                           /* return error */
+        return 1;                                                                        /* return error */
+    }
+    handle->fb_left = left;                                                              /* set left */
+    handle->fb_top = top;                                                                /* set top */
+    handle->fb_right = right;                                                            /* set right */
+    handle->fb_bottom = bottom;                                                          /* set bottom */
+    handle->fb_column = left;                                                            /* set column */
+    handle->fb_row = top;                                                                /* set row */
+    handle->fb_byte = 0;                                                                 /* set byte */
+    if (len == 1)                                                                        /* if single pixel */
+    {
+        a_ssd1351_framebuffer_mark(handle, left, top, left, top);                        /* mark pixel */
+    }
+    else
+    {
+        a_ssd1351_framebuffer_mark(handle, left, top, right, bottom);                    /* mark window */
     }
     
-    return 0;                                                                               /* success return 0 */
+    return 0;                                                                            /* success return 0 */
 }
 
 /**
- * @brief     set the color sequence
+ * @brief     send the framebuffer rows of a window with the vector write
  * @param[in] *handle pointer to an ssd1351 handle structure
- * @param[in] color_sequence display color sequence
+ * @param[in] *fb pointer to a framebuffer
+ * @param[in] left left address of the window
+ * @param[in] top top address of the window
+ * @param[in] right right address of the window
+ * @param[in] bottom bottom address of the window
  * @return    status code
  *            - 0 success
- *            - 1 set color sequence failed
- *            - 2 handle is NULL
- *            - 3 handle is not initialized
- * @note      none
+ *            - 1 send failed
+ * @note      the gram window must be set, rows are sent from the framebuffer without copying
  */
-uint8_t ssd1351_set_color_sequence(ssd1351_handle_t *handle, ssd1351_color_sequence_t color_sequence)
+static uint8_t a_ssd1351_framebuffer_send_vector(ssd1351_handle_t *handle, const uint8_t *fb, 
+                                                 uint8_t left, uint8_t top, uint8_t right, uint8_t bottom)
 {
-    if (handle == NULL)                                                                     /* check handle */
-    {
-        return 2;                                                                           /* return error */
-    }
-    if (handle->inited != 1)                                                                /* check handle initialization */
-    {
-        return 3;                                                                           /* return error */
-    }
+    uint8_t *seg[SSD1351_VECTOR_NUM];
+    uint16_t seg_len[SSD1351_VECTOR_NUM];
+    uint16_t num;
+    uint16_t row;
+    uint16_t j;
+    uint8_t bytes;
     
-    handle->conf_1 &= ~ (1 << 2);                                                           /* clear conf */
-    handle->conf_1 |= color_sequence << 2;                                                  /* set conf */
-    if (a_ssd1351_write_byte(handle, SSD1351_CMD_SET_REMAP_COLOR_DEPTH, SSD1351_CMD) != 0)  /* set color sequence */
+    bytes = a_ssd1351_pixel_bytes(handle);                                               /* get pixel bytes */
+    row = (uint16_t)((right - left + 1) * bytes);                                        /* get row length */
+    if (a_ssd1351_buffer_send(handle) != 0)                                              /* send pending data */
     {
-        handle->debug_print("ssd1351: write color sequence failed.\n");                     /* write color sequence failed */
+        handle->debug_print("ssd1351: write data failed.\n");                            /* write data failed */
         
-        return 1;                                                                           /* return error */
+        return 1;                                                                        /* return error */
     }
-    if (a_ssd1351_write_byte(handle, handle->conf_1, SSD1351_DATA) != 0)                    /* set conf */
+    if (a_ssd1351_set_dc(handle, SSD1351_DATA) != 0)                                     /* set data */
     {
-        handle->debug_print("ssd1351: write color sequence failed.\n");                     /* write color sequence failed */
+        handle->window_valid = 0;                                                        /* invalidate window */
+        handle->debug_print("ssd1351: write data failed.\n");                            /* write data failed */
         
-        return 1;                                                                           /* return error */
+        return 1;                                                                        /* return error */
+    }
+    num = 0;                                                                             /* init 0 */
+    for (j = top; j <= bottom; j++)                                                      /* y */
+    {
+        if ((left == 0) && (right == 127) && (num != 0))                                 /* if full rows */
+        {
+            seg_len[num - 1] = (uint16_t)(seg_len[num - 1] + row);                       /* rows are contiguous */
+        }
+        else
+        {
+            seg[num] = (uint8_t *)&fb[((uint32_t)j * 128 + left) * bytes];               /* set row */
+            seg_len[num] = row;                                                          /* set length */
+            num++;                                                                       /* num++ */
+        }
+        if ((num == SSD1351_VECTOR_NUM) || (j == bottom))                                /* if full or last */
+        {
+            if (handle->spi_write_cmd_vector(seg, seg_len, num) != 0)                    /* write segments */
+            {
+                handle->window_valid = 0;                                                /* invalidate window */
+                handle->debug_print("ssd1351: write data failed.\n");                    /* write data failed */
+                
+                return 1;                                                                /* return error */
+            }
+            num = 0;                                                                     /* reset num */
+        }
     }
     
-    return 0;                                                                               /* success return 0 */
+    return 0;                                                                            /* success return 0 */
 }
 
 /**
- * @brief     set the scan mode
+ * @brief     send a region of the framebuffer to the gram
  * @param[in] *handle pointer to an ssd1351 handle structure
- * @param[in] mode scan mode
+ * @param[in] *fb pointer to a framebuffer
+ * @param[in] left left address of the region
+ * @param[in] top top address of the region
+ * @param[in] right right address of the region
+ * @param[in] bottom bottom address of the region
  * @return    status code
  *            - 0 success
- *            - 1 set scan mode failed
- *            - 2 handle is NULL
- *            - 3 handle is not initialized
+ *            - 1 send failed
  * @note      none
  */
-uint8_t ssd1351_set_scan_mode(ssd1351_handle_t *handle, ssd1351_scan_mode_t mode)
+static uint8_t a_ssd1351_framebuffer_send(ssd1351_handle_t *handle, const uint8_t *fb, uint8_t left, uint8_t top, uint8_t right, uint8_t bottom)
 {
-    if (handle == NULL)                                                                     /* check handle */
+    uint8_t bytes;
+    uint16_t i;
+    uint16_t j;
+    
+    bytes = a_ssd1351_pixel_bytes(handle);                                               /* get pixel bytes */
+    if (a_ssd1351_set_gram_window(handle, left, top, right, bottom, 
+                                  (uint32_t)(right - left + 1) * (bottom - top + 1)) != 0) /* set gram window */
     {
-        return 2;                                                                           /* return error */
+        return 1;                                                                        /* return error */
     }
-    if (handle->inited != 1)                                                                /* check handle initialization */
+    if ((handle->conf_1 & 0x01) != 0)                                                    /* if vertical increment */
     {
-        return 3;                                                                           /* return error */
+        for (i = left; i <= right; i++)                                                  /* x */
+        {
+            for (j = top; j <= bottom; j++)                                              /* y */
+            {
+                if (a_ssd1351_buffer_append(handle, &fb[((uint32_t)j * 128 + i) * bytes], 
+                                            bytes) != 0)                                 /* append pixel */
+                {
+                    handle->debug_print("ssd1351: write data failed.\n");                /* write data failed */
+                    
+                    return 1;                                                            /* return error */
+                }
+            }
+        }
     }
-    
-    handle->conf_1 &= ~ (1 << 4);                                                           /* clear conf */
-    handle->conf_1 |= mode << 4;                                                            /* set conf */
-    if (a_ssd1351_write_byte(handle, SSD1351_CMD_SET_REMAP_COLOR_DEPTH, SSD1351_CMD) != 0)  /* set scan mode */
+    else                                                                                 /* if horizontal increment */
     {
-        handle->debug_print("ssd1351: write scan mode failed.\n");                          /* write scan mode failed */
-        
-        return 1;                                                                           /* return error */
+        if (handle->spi_write_cmd_vector != NULL)                                        /* if vector write */
+        {
+            return a_ssd1351_framebuffer_send_vector(handle, fb, left, top, right, bottom);  /* send rows */
+        }
+        for (j = top; j <= bottom; j++)                                                  /* y */
+        {
+            if (a_ssd1351_buffer_append(handle, &fb[((uint32_t)j * 128 + left) * bytes], 
+                                        (uint32_t)(right - left + 1) * bytes) != 0)      /* append row */
+            {
+                handle->debug_print("ssd1351: write data failed.\n");                    /* write data failed */
+                
+                return 1;                                                                /* return error */
+            }
+        }
     }
-    if (a_ssd1351_write_byte(handle, handle->conf_1, SSD1351_DATA) != 0)                    /* set conf */
+    if (a_ssd1351_buffer_send(handle) != 0)                                              /* flush buffer */
     {
-        handle->debug_print("ssd1351: write scan mode failed.\n");                          /* write scan mode failed */
+        handle->debug_print("ssd1351: write data failed.\n");                            /* write data failed */
         
-        return 1;                                                                           /* return error */
+        return 1;                                                                        /* return error */
     }
     
-    return 0;                                                                               /* success return 0 */
+    return 0;                                                                            /* success return 0 */
 }
 
 /**
- * @brief     set the com split odd or even
+ * @brief     send the dirty tiles of a framebuffer
  * @param[in] *handle pointer to an ssd1351 handle structure
- * @param[in] enable bool value
+ * @param[in] *fb pointer to a framebuffer
+ * @param[in] *dirty pointer to a dirty tile bitmap
  * @return    status code
  *            - 0 success
- *            - 1 set com split odd even failed
- *            - 2 handle is NULL
- *            - 3 handle is not initialized
- * @note      none
+ *            - 1 flush failed
+ * @note      the flush stats are updated
  */
-uint8_t ssd1351_set_com_split_odd_even(ssd1351_handle_t *handle, ssd1351_bool_t enable)
+static uint8_t a_ssd1351_framebuffer_flush(ssd1351_handle_t *handle, const uint8_t *fb, const uint16_t *dirty)
 {
-    if (handle == NULL)                                                                     /* check handle */
-    {
-        return 2;                                                                           /* return error */
-    }
-    if (handle->inited != 1)                                                                /* check handle initialization */
+    uint8_t bytes;
+    uint16_t i;
+    uint16_t j;
+    uint16_t num;
+    ssd1351_dirty_rect_t rect[SSD1351_DIRTY_RECT_MAX];
+    
+    bytes = a_ssd1351_pixel_bytes(handle);                                           /* get pixel bytes */
+    memset(&handle->stats, 0, sizeof(ssd1351_flush_stats_t));                        /* clear stats */
+    handle->stats.full_frame_bytes = SSD1351_WINDOW_SETUP_BYTES + 
+                                     (uint32_t)128 * 128 * bytes;                    /* set full frame bytes */
+    for (i = 0; i < SSD1351_TILE_NUM; i++)                                           /* loop tile rows */
     {
-        return 3;                                                                           /* return error */
+        for (j = 0; j < SSD1351_TILE_NUM; j++)                                       /* loop tile columns */
+        {
+            if ((dirty[i] & (1U << j)) != 0)                                         /* check tile */
+            {
+                handle->stats.dirty_tiles++;                                         /* dirty tiles++ */
+            }
+        }
     }
-    
-    handle->conf_1 &= ~ (1 << 5);                                                           /* clear conf */
-    handle->conf_1 |= enable << 5;                                                          /* set conf */
-    if (a_ssd1351_write_byte(handle, SSD1351_CMD_SET_REMAP_COLOR_DEPTH, SSD1351_CMD) != 0)  /* set com split odd even */
+    if (handle->stats.dirty_tiles == 0)                                              /* check dirty */
     {
-        handle->debug_print("ssd1351: write com split odd even failed.\n");                 /* write com split odd even failed */
-        
-        return 1;                                                                           /* return error */
+        return 0;                                                                    /* success return 0 */
     }
-    if (a_ssd1351_write_byte(handle, handle->conf_1, SSD1351_DATA) != 0)                    /* set conf */
+    num = a_ssd1351_dirty_coalesce(handle, dirty, rect);                             /* coalesce dirty tiles */
+    for (i = 0; i < num; i++)                                                        /* send all rectangles */
     {
-        handle->debug_print("ssd1351: write com split odd even failed.\n");                 /* write com split odd even failed */
-        
-        return 1;                                                                           /* return error */
+        if (a_ssd1351_framebuffer_send(handle, fb, 
+                                       rect[i].left * SSD1351_TILE_SIZE, 
+                                       rect[i].top * SSD1351_TILE_SIZE, 
+                                       rect[i].right * SSD1351_TILE_SIZE + (SSD1351_TILE_SIZE - 1), 
+                                       rect[i].bottom * SSD1351_TILE_SIZE + (SSD1351_TILE_SIZE - 1)
+                                      ) != 0)                                        /* send rectangle */
+        {
+            return 1;                                                                /* return error */
+        }
+        handle->stats.rects++;                                                       /* rects++ */
+        handle->stats.pixels += (uint32_t)(rect[i].right - rect[i].left + 1) * 
+                                (uint32_t)(rect[i].bottom - rect[i].top + 1) * 
+                                SSD1351_TILE_SIZE * SSD1351_TILE_SIZE;               /* add pixels */
+    }
+    handle->stats.bytes = (uint32_t)handle->stats.rects * SSD1351_WINDOW_SETUP_BYTES + 
+                          handle->stats.pixels * bytes;                              /* set bytes */
+    
+    return 0;                                                                        /* success return 0 */
+}
+
+/**
+ * @brief     draw a rgb888 or rgba8888 picture
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @param[in] left left coordinate x
+ * @param[in] top top coordinate y
+ * @param[in] right right coordinate x
+ * @param[in] bottom bottom coordinate y
+ * @param[in] *image pointer to a source image buffer
+ * @param[in] format source pixel format
+ * @return    status code
+ *            - 0 success
+ *            - 1 draw picture failed
+ * @note      the image is converted into the inner buffer chunk by chunk,
+ *            with a horizontal framebuffer cursor each row is converted into the framebuffer directly
+ */
+static uint8_t a_ssd1351_draw_picture_rgb888(ssd1351_handle_t *handle, uint8_t left, uint8_t top, uint8_t right, uint8_t bottom, 
+                                             const uint8_t *image, ssd1351_color_format_t format)
+{
+    ssd1351_color_depth_t depth;
+    ssd1351_color_sequence_t sequence;
+    uint8_t bytes;
+    uint32_t total;
+    uint32_t chunk;
+    uint32_t n;
+    uint32_t len;
+    uint32_t i;
+    
+    total = (uint32_t)(right - left + 1) * (bottom - top + 1);                                   /* get pixel number */
+    if (a_ssd1351_set_window(handle, left, top, right, bottom, total) != 0)                      /* set window */
+    {
+        return 1;                                                                                /* return error */
+    }
+    if (a_ssd1351_buffer_send(handle) != 0)                                                      /* send pending data */
+    {
+        handle->debug_print("ssd1351: write data failed.\n");                                    /* write data failed */
+        
+        return 1;                                                                                /* return error */
+    }
+    depth = (ssd1351_color_depth_t)(SSD1351_CONF_DEPTH(handle) >> 6);                            /* get color depth */
+    sequence = (ssd1351_color_sequence_t)(SSD1351_CONF_SEQUENCE(handle) >> 2);                   /* get color sequence */
+    bytes = a_ssd1351_pixel_bytes(handle);                                                       /* get pixel bytes */
+    if ((handle->fb != NULL) && (handle->fb_increment == 0))                                     /* if framebuffer with horizontal increment */
+    {
+        n = (uint32_t)(right - left + 1);                                                        /* get row pixels */
+        for (i = top; i <= bottom; i++)                                                          /* y */
+        {
+            (void)ssd1351_color_convert(depth, sequence, format, image, 
+                                        &handle->fb[(i * 128 + left) * bytes], n);               /* convert the row into the framebuffer */
+            image += n * format;                                                                 /* next row */
+        }
+        
+        return 0;                                                                                /* success return 0 */
+    }
+    chunk = SSD1351_BUFFER_SIZE / bytes;                                                         /* get chunk pixels */
+    while (total != 0)                                                                           /* loop all */
+    {
+        n = (total > chunk) ? chunk : total;                                                     /* get pixels */
+        len = ssd1351_color_convert(depth, sequence, format, image, handle->buf, n);             /* convert */
+        if (handle->fb != NULL)                                                                  /* if framebuffer with vertical increment */
+        {
+            for (i = 0; i < len; i++)                                                            /* all bytes */
+            {
+                a_ssd1351_framebuffer_write(handle, handle->buf[i]);                             /* write framebuffer */
+            }
+        }
+        else
+        {
+            handle->buf_len = (uint16_t)len;                                                     /* set length */
+            if (a_ssd1351_buffer_send(handle) != 0)                                              /* send buffer */
+            {
+                handle->debug_print("ssd1351: write data failed.\n");                            /* write data failed */
+                
+                return 1;                                                                        /* return error */
+            }
+        }
+        image += n * format;                                                                     /* next pixels */
+        total -= n;                                                                              /* total -= n */
+    }
+    
+    return 0;                                                                                    /* success return 0 */
+}
+
+/**
+ * @brief     draw a raw panel format picture
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @param[in] left left coordinate x
+ * @param[in] top top coordinate y
+ * @param[in] right right coordinate x
+ * @param[in] bottom bottom coordinate y
+ * @param[in] *data pointer to a panel format data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 draw raw failed
+ * @note      none
+ */
+static uint8_t a_ssd1351_draw_raw(ssd1351_handle_t *handle, uint8_t left, uint8_t top, uint8_t right, uint8_t bottom, 
+                                  const uint8_t *data, uint32_t len)
+{
+    uint8_t bytes;
+    uint16_t n;
+    uint32_t i;
+    uint32_t j;
+    
+    if (a_ssd1351_set_window(handle, left, top, right, bottom, (right - left + 1) * (bottom - top + 1)) != 0) /* set window */
+    {
+        return 1;                                                                                /* return error */
+    }
+    if (handle->fb != NULL)                                                                      /* if framebuffer */
+    {
+        bytes = a_ssd1351_pixel_bytes(handle);                                                   /* get pixel bytes */
+        if (handle->fb_increment != 0)                                                           /* if vertical increment */
+        {
+            for (i = left; i <= right; i++)                                                      /* x */
+            {
+                for (j = top; j <= bottom; j++)                                                  /* y */
+                {
+                    memcpy(&handle->fb[(j * 128 + i) * bytes], data, bytes);                     /* copy pixel */
+                    data += bytes;                                                               /* next pixel */
+                }
+            }
+        }
+        else                                                                                     /* if horizontal increment */
+        {
+            for (j = top; j <= bottom; j++)                                                      /* y */
+            {
+                memcpy(&handle->fb[(j * 128 + left) * bytes], data, (right - left + 1) * bytes); /* copy row */
+                data += (right - left + 1) * bytes;                                              /* next row */
+            }
+        }
+        
+        return 0;                                                                                /* success return 0 */
+    }
+    if (a_ssd1351_buffer_send(handle) != 0)                                                      /* send pending data */
+    {
+        handle->debug_print("ssd1351: write data failed.\n");                                    /* write data failed */
+        
+        return 1;                                                                                /* return error */
+    }
+    while (len != 0)                                                                             /* loop all */
+    {
+        n = (len > 0xFFFFU) ? 0xFFFFU : (uint16_t)len;                                           /* get chunk length */
+        if (a_ssd1351_write_bytes(handle, (uint8_t *)data, n, SSD1351_DATA) != 0)                /* write data */
+        {
+            handle->debug_print("ssd1351: write data failed.\n");                                /* write data failed */
+            
+            return 1;                                                                            /* return error */
+        }
+        data += n;                                                                               /* data += n */
+        len -= n;                                                                                /* len -= n */
+    }
+    
+    return 0;                                                                                    /* success return 0 */
+}
+
+/**
+ * @brief      pack one pixel in the 256 color format
+ * @param[in]  color pixel color
+ * @param[out] *buf pointer to a data buffer
+ * @return     packed bytes
+ * @note       none
+ */
+static uint8_t a_ssd1351_pack_256(uint32_t color, uint8_t *buf)
+{
+    buf[0] = color & 0xFF;                                                            /* set data */
+    
+    return 1;                                                                         /* 1 byte */
+}
+
+/**
+ * @brief      pack one pixel in the 65K color format
+ * @param[in]  color pixel color
+ * @param[out] *buf pointer to a data buffer
+ * @return     packed bytes
+ * @note       none
+ */
+static uint8_t a_ssd1351_pack_65k(uint32_t color, uint8_t *buf)
+{
+    buf[0] = (color >> 8) & 0xFF;                                                     /* set 1st */
+    buf[1] = (color >> 0) & 0xFF;                                                     /* set 2nd */
+    
+    return 2;                                                                         /* 2 bytes */
+}
+
+/**
+ * @brief      pack one pixel in the 262K color format
+ * @param[in]  color pixel color
+ * @param[out] *buf pointer to a data buffer
+ * @return     packed bytes
+ * @note       none
+ */
+static uint8_t a_ssd1351_pack_262k(uint32_t color, uint8_t *buf)
+{
+    buf[0] = (color >> 16) & 0x3F;                                                    /* set red */
+    buf[1] = (color >> 8) & 0x3F;                                                     /* set green */
+    buf[2] = (color >> 0) & 0x3F;                                                     /* set blue */
+    
+    return 3;                                                                         /* 3 bytes */
+}
+
+#if (SSD1351_AUTO_COLOR_CONVERT == 1)                                                 /* if auto color convert */
+
+/**
+ * @brief      pack one pixel in the 65K color format with red and blue swapped
+ * @param[in]  color pixel color
+ * @param[out] *buf pointer to a data buffer
+ * @return     packed bytes
+ * @note       none
+ */
+static uint8_t a_ssd1351_pack_65k_swap(uint32_t color, uint8_t *buf)
+{
+    color = ((color&0xF800)>>11) | (color&0x07E0) | ((color&0x001F)<<11);             /* blue green red */
+    buf[0] = (color >> 8) & 0xFF;                                                     /* set 1st */
+    buf[1] = (color >> 0) & 0xFF;                                                     /* set 2nd */
+    
+    return 2;                                                                         /* 2 bytes */
+}
+
+/**
+ * @brief      pack one pixel in the 262K color format with red and blue swapped
+ * @param[in]  color pixel color
+ * @param[out] *buf pointer to a data buffer
+ * @return     packed bytes
+ * @note       none
+ */
+static uint8_t a_ssd1351_pack_262k_swap(uint32_t color, uint8_t *buf)
+{
+    buf[0] = (color >> 0) & 0x3F;                                                     /* set blue */
+    buf[1] = (color >> 8) & 0x3F;                                                     /* set green */
+    buf[2] = (color >> 16) & 0x3F;                                                    /* set red */
+    
+    return 3;                                                                         /* 3 bytes */
+}
+
+#endif
+
+/**
+ * @brief pixel packer table indexed by color depth and color sequence
+ */
+static uint8_t (*const gsc_ssd1351_packer[4][2])(uint32_t color, uint8_t *buf) =
+{
+#if (SSD1351_AUTO_COLOR_CONVERT == 1)                                                 /* if auto color convert */
+    {a_ssd1351_pack_256, a_ssd1351_pack_256},                                         /* 256 */
+    {a_ssd1351_pack_65k_swap, a_ssd1351_pack_65k},                                    /* 65K */
+    {a_ssd1351_pack_262k_swap, a_ssd1351_pack_262k},                                  /* 262K */
+    {a_ssd1351_pack_262k_swap, a_ssd1351_pack_262k},                                  /* 262K */
+#else
+    {a_ssd1351_pack_256, a_ssd1351_pack_256},                                         /* 256 */
+    {a_ssd1351_pack_65k, a_ssd1351_pack_65k},                                         /* 65K */
+    {a_ssd1351_pack_262k, a_ssd1351_pack_262k},                                       /* 262K */
+    {a_ssd1351_pack_262k, a_ssd1351_pack_262k},                                       /* 262K */
+#endif
+};
+
+/**
+ * @brief     select the pixel packer of the current color depth and color sequence
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @note      called once whenever the color depth or the color sequence changes
+ */
+static void a_ssd1351_select_packer(ssd1351_handle_t *handle)
+{
+    handle->pack = gsc_ssd1351_packer[SSD1351_CONF_DEPTH(handle) >> 6]
+                                     [SSD1351_CONF_SEQUENCE(handle) >> 2];            /* set packer */
+}
+
+/**
+ * @brief      pack one pixel in the panel format of the current color depth
+ * @param[in]  *handle pointer to an ssd1351 handle structure
+ * @param[in]  color pixel color
+ * @param[out] *buf pointer to a data buffer
+ * @return     packed bytes
+ * @note       the fixed color format calls its packer directly
+ */
+static uint8_t a_ssd1351_pack_pixel(ssd1351_handle_t *handle, uint32_t color, uint8_t *buf)
+{
+#if (SSD1351_FIXED_COLOR_DEPTH != 0xFF) && (SSD1351_FIXED_COLOR_SEQUENCE != 0xFF)     /* if fixed color format */
+    (void)handle;                                                                     /* not used */
+    
+    return gsc_ssd1351_packer[SSD1351_FIXED_COLOR_DEPTH]
+                             [SSD1351_FIXED_COLOR_SEQUENCE](color, buf);              /* pack pixel */
+#else
+    return handle->pack(color, buf);                                                  /* pack pixel */
+#endif
+}
+
+/**
+ * @brief     fill a memory area with one packed pixel
+ * @param[out] *dst pointer to a destination buffer
+ * @param[in]  *data pointer to a packed pixel
+ * @param[in]  n packed pixel bytes
+ * @param[in]  num pixel number
+ * @note       the filled part is doubled by every copy
+ */
+static void a_ssd1351_pattern_fill(uint8_t *dst, const uint8_t *data, uint8_t n, uint32_t num)
+{
+    uint32_t len;
+    uint32_t total;
+    uint32_t l;
+    
+    memcpy(dst, data, n);                                                  /* copy the first pixel */
+    len = n;                                                               /* init n */
+    total = num * n;                                                       /* get total */
+    while (len < total)                                                    /* double the pattern */
+    {
+        l = total - len;                                                   /* get rest length */
+        if (l > len)                                                       /* check length */
+        {
+            l = len;                                                       /* set length */
+        }
+        memcpy(&dst[len], dst, l);                                         /* copy pattern */
+        len += l;                                                          /* length += l */
+    }
+}
+
+/**
+ * @brief     fill a block of the render strip
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @param[in] left left coordinate x
+ * @param[in] top top coordinate y
+ * @param[in] right right coordinate x
+ * @param[in] bottom bottom coordinate y
+ * @param[in] *data pointer to a packed pixel
+ * @param[in] n packed pixel bytes
+ * @note      the block is clipped to the rows of the strip
+ */
+static void a_ssd1351_strip_fill(ssd1351_handle_t *handle, int16_t left, int16_t top, int16_t right, int16_t bottom, 
+                                 const uint8_t *data, uint8_t n)
+{
+    int16_t y;
+    
+    if (top < handle->strip_top)                                           /* check top */
+    {
+        top = handle->strip_top;                                           /* clip top */
+    }
+    if (bottom > handle->strip_bottom)                                     /* check bottom */
+    {
+        bottom = handle->strip_bottom;                                     /* clip bottom */
+    }
+    if (left < 0)                                                          /* check left */
+    {
+        left = 0;                                                          /* clip left */
+    }
+    if (right > 127)                                                       /* check right */
+    {
+        right = 127;                                                       /* clip right */
+    }
+    if ((left > right) || (top > bottom))                                  /* check clipped */
+    {
+        return;                                                            /* return */
+    }
+    for (y = top; y <= bottom; y++)                                        /* fill all rows */
+    {
+        a_ssd1351_pattern_fill(&handle->strip[((uint32_t)(y - handle->strip_top) * 128 + left) * n], 
+                               data, n, (uint32_t)(right - left + 1));     /* fill row */
+    }
+}
+
+/**
+ * @brief     record a display list item
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @param[in] type draw type
+ * @param[in] x0 coordinate x0
+ * @param[in] y0 coordinate y0
+ * @param[in] x1 coordinate x1
+ * @param[in] y1 coordinate y1
+ * @param[in] param radius or font
+ * @param[in] color display color
+ * @return    pointer to the recorded item or NULL if the display list is full
+ * @note      the items grow from the start of the arena and the strings from its end
+ */
+static ssd1351_draw_item_t *a_ssd1351_list_record(ssd1351_handle_t *handle, uint8_t type, uint8_t x0, uint8_t y0, 
+                                                  uint8_t x1, uint8_t y1, uint8_t param, uint32_t color)
+{
+    ssd1351_draw_item_t *item;
+    
+    if ((uint32_t)(handle->list_num + 1) * sizeof(ssd1351_draw_item_t) > handle->list_tail)     /* check space */
+    {
+        handle->debug_print("ssd1351: display list is full.\n");           /* display list is full */
+        
+        return NULL;                                                       /* return error */
+    }
+    item = &((ssd1351_draw_item_t *)handle->list_buf)[handle->list_num];  /* get item */
+    memset(item, 0, sizeof(ssd1351_draw_item_t));                         /* clear item */
+    item->type = type;                                                     /* set type */
+    item->x0 = x0;                                                         /* set x0 */
+    item->y0 = y0;                                                         /* set y0 */
+    item->x1 = x1;                                                         /* set x1 */
+    item->y1 = y1;                                                         /* set y1 */
+    item->param = param;                                                   /* set param */
+    item->color = color;                                                   /* set color */
+    handle->list_num++;                                                    /* item++ */
+    
+    return item;                                                           /* return item */
+}
+
+/**
+ * @brief     record a display list string item
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @param[in] type draw type
+ * @param[in] x coordinate x
+ * @param[in] y coordinate y
+ * @param[in] *str pointer to a string
+ * @param[in] len length of the string
+ * @param[in] color display color
+ * @param[in] background background color
+ * @param[in] font string font
+ * @return    status code
+ *            - 0 success
+ *            - 1 display list is full
+ * @note      the string is copied into the arena
+ */
+static uint8_t a_ssd1351_list_record_string(ssd1351_handle_t *handle, uint8_t type, uint8_t x, uint8_t y, 
+                                            const char *str, uint16_t len, uint32_t color, uint32_t background, 
+                                            uint8_t font)
+{
+    ssd1351_draw_item_t *item;
+    
+    item = a_ssd1351_list_record(handle, type, x, y, 0, 0, font, color);  /* record item */
+    if (item == NULL)                                                      /* check item */
+    {
+        return 1;                                                          /* return error */
+    }
+    if ((uint32_t)handle->list_num * sizeof(ssd1351_draw_item_t) + len > handle->list_tail)     /* check space */
+    {
+        handle->list_num--;                                                /* drop item */
+        handle->debug_print("ssd1351: display list is full.\n");           /* display list is full */
+        
+        return 1;                                                          /* return error */
+    }
+    handle->list_tail -= len;                                              /* alloc string */
+    memcpy(&handle->list_buf[handle->list_tail], str, len);                /* copy string */
+    item->data = &handle->list_buf[handle->list_tail];                     /* set string */
+    item->len = len;                                                       /* set length */
+    item->background = background;                                         /* set background */
+    
+    return 0;                                                              /* success return 0 */
+}
+
+/**
+ * @brief     write one packed pixel several times to the framebuffer
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @param[in] *data pointer to a packed pixel
+ * @param[in] n packed pixel bytes
+ * @param[in] num pixel number
+ * @note      with the horizontal increment each row span is filled at once
+ */
+static void a_ssd1351_framebuffer_write_packed(ssd1351_handle_t *handle, const uint8_t *data, uint8_t n, uint32_t num)
+{
+    uint8_t i;
+    uint32_t k;
+    
+    while (num != 0)                                                       /* loop all */
+    {
+        if ((handle->fb_increment != 0) || (handle->fb_byte != 0))         /* if vertical or unaligned */
+        {
+            for (i = 0; i < n; i++)                                        /* write all bytes */
+            {
+                a_ssd1351_framebuffer_write(handle, data[i]);              /* write framebuffer */
+            }
+            num--;                                                         /* num-- */
+            
+            continue;                                                      /* next pixel */
+        }
+        k = (uint32_t)(handle->fb_right - handle->fb_column) + 1;          /* get rest of the row */
+        if (k > num)                                                       /* check num */
+        {
+            k = num;                                                       /* set k */
+        }
+        a_ssd1351_pattern_fill(&handle->fb[((uint32_t)handle->fb_row * 128 + handle->fb_column) * n], 
+                               data, n, k);                                /* fill the span */
+        handle->fb_column = (uint8_t)(handle->fb_column + k);              /* column += k */
+        num -= k;                                                          /* num -= k */
+        if (handle->fb_column > handle->fb_right)                          /* check column end */
+        {
+            handle->fb_column = handle->fb_left;                           /* reset column */
+            handle->fb_row++;                                              /* row++ */
+            if (handle->fb_row > handle->fb_bottom)                        /* check row end */
+            {
+                handle->fb_row = handle->fb_top;                           /* reset row */
+            }
+        }
+    }
+}
+
+/**
+ * @brief     stream one packed pixel several times from a pre-filled inner buffer
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @param[in] *data pointer to a packed pixel
+ * @param[in] n packed pixel bytes
+ * @param[in] num pixel number
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      the inner buffer must be empty, it is filled once and sent repeatedly,
+ *            the rest pixels are left in the inner buffer
+ */
+static uint8_t a_ssd1351_buffer_write_repeat(ssd1351_handle_t *handle, const uint8_t *data, uint8_t n, uint32_t num)
+{
+    uint8_t *seg[SSD1351_VECTOR_NUM];
+    uint16_t seg_len[SSD1351_VECTOR_NUM];
+    uint16_t chunk;
+    uint16_t len;
+    uint32_t cnt;
+    uint32_t i;
+    
+    chunk = (uint16_t)(SSD1351_BUFFER_SIZE / n);                           /* get chunk pixels */
+    len = (uint16_t)(chunk * n);                                           /* get chunk length */
+    a_ssd1351_pattern_fill(handle->buf, data, n, chunk);                   /* fill the buffer once */
+    if (handle->spi_write_cmd_vector != NULL)                              /* if vector write */
+    {
+        if (a_ssd1351_set_dc(handle, SSD1351_DATA) != 0)                   /* set data */
+        {
+            handle->window_valid = 0;                                      /* invalidate window */
+            
+            return 1;                                                      /* return error */
+        }
+        for (i = 0; i < SSD1351_VECTOR_NUM; i++)                           /* set all segments */
+        {
+            seg[i] = handle->buf;                                          /* same buffer */
+            seg_len[i] = len;                                              /* set length */
+        }
+        while (num >= chunk)                                               /* loop all chunks */
+        {
+            cnt = num / chunk;                                             /* get chunk number */
+            if (cnt > SSD1351_VECTOR_NUM)                                  /* check segments */
+            {
+                cnt = SSD1351_VECTOR_NUM;                                  /* set max */
+            }
+            if (handle->spi_write_cmd_vector(seg, seg_len, (uint16_t)cnt) != 0)  /* write segments */
+            {
+                handle->window_valid = 0;                                  /* invalidate window */
+                
+                return 1;                                                  /* return error */
+            }
+            num -= cnt * chunk;                                            /* num -= sent */
+        }
+    }
+    else
+    {
+        while (num >= chunk)                                               /* loop all chunks */
+        {
+            if (a_ssd1351_write_bytes(handle, handle->buf, len, SSD1351_DATA) != 0)  /* write chunk */
+            {
+                return 1;                                                  /* return error */
+            }
+            num -= chunk;                                                  /* num -= chunk */
+        }
+    }
+    handle->buf_len = (uint16_t)(num * n);                                 /* rest pixels are in place */
+    
+    return 0;                                                              /* success return 0 */
+}
+
+/**
+ * @brief     write one packed pixel several times to the inner buffer
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @param[in] *data pointer to a packed pixel
+ * @param[in] n packed pixel bytes
+ * @param[in] num pixel number
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      the pixels go to the framebuffer when it is enabled,
+ *            a run of at least one buffer is streamed from a pre-filled buffer
+ */
+static uint8_t a_ssd1351_buffer_write_packed(ssd1351_handle_t *handle, const uint8_t *data, uint8_t n, uint32_t num)
+{
+    uint8_t i;
+    
+    if (handle->fb != NULL)                                                /* if framebuffer */
+    {
+        a_ssd1351_framebuffer_write_packed(handle, data, n, num);          /* write framebuffer */
+        
+        return 0;                                                          /* success return 0 */
+    }
+    while (num != 0)                                                       /* loop all */
+    {
+        if ((handle->buf_len == 0) && (num * n >= SSD1351_BUFFER_SIZE))    /* if a long run */
+        {
+            return a_ssd1351_buffer_write_repeat(handle, data, n, num);    /* stream the pattern */
+        }
+        if (handle->buf_len + n > SSD1351_BUFFER_SIZE)                     /* check free length */
+        {
+            if (a_ssd1351_buffer_send(handle) != 0)                        /* flush buffer */
+            {
+                return 1;                                                  /* return error */
+            }
+        }
+        for (i = 0; i < n; i++)                                            /* copy all bytes */
+        {
+            handle->buf[handle->buf_len + i] = data[i];                    /* set data */
+        }
+        handle->buf_len += n;                                              /* length += n */
+        num--;                                                             /* num-- */
+    }
+    
+    return 0;                                                              /* success return 0 */
+}
+
+/**
+ * @brief     write pixels of one color to the inner buffer
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @param[in] color pixel color
+ * @param[in] num pixel number
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      the pixel is packed once and copied in place,
+ *            the pixels go to the framebuffer when it is enabled
+ */
+static uint8_t a_ssd1351_buffer_write_pixel(ssd1351_handle_t *handle, uint32_t color, uint32_t num)
+{
+    uint8_t data[3];
+    uint8_t n;
+    
+    n = a_ssd1351_pack_pixel(handle, color, data);                         /* pack pixel */
+    
+    return a_ssd1351_buffer_write_packed(handle, data, n, num);            /* write packed pixel */
+}
+
+/**
+ * @brief     pack the next async pixels into one half of the inner buffer
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @param[in] half buffer half
+ * @note      none
+ */
+static void a_ssd1351_async_pack(ssd1351_handle_t *handle, uint8_t half)
+{
+    uint8_t bytes;
+    uint8_t *buf;
+    uint16_t len;
+    uint32_t color;
+    
+    bytes = a_ssd1351_pixel_bytes(handle);                                            /* get pixel bytes */
+    buf = &handle->buf[half * (SSD1351_BUFFER_SIZE / 2)];                             /* get half */
+    len = 0;                                                                          /* init 0 */
+    while ((handle->async_pos < handle->async_total) && 
+           (len + bytes <= (SSD1351_BUFFER_SIZE / 2)))                                /* fill the half */
+    {
+        if (handle->async_image != NULL)                                              /* if picture */
+        {
+            color = handle->async_image[handle->async_pos];                           /* get pixel */
+        }
+        else                                                                          /* if fill */
+        {
+            color = handle->async_color;                                              /* get color */
+        }
+        len += a_ssd1351_pack_pixel(handle, color, &buf[len]);                        /* pack pixel */
+        handle->async_pos++;                                                          /* pos++ */
+    }
+    handle->async_len[half] = len;                                                    /* set length */
+}
+
+/**
+ * @brief     finish the async transfer
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @param[in] res transfer result
+ * @note      none
+ */
+static void a_ssd1351_async_finish(ssd1351_handle_t *handle, uint8_t res)
+{
+    if (res != 0)                                                                     /* if failed */
+    {
+        handle->window_valid = 0;                                                     /* invalidate window */
+        handle->async_status = SSD1351_ASYNC_STATUS_FAILED;                           /* set failed */
+    }
+    else
+    {
+        handle->async_status = SSD1351_ASYNC_STATUS_IDLE;                             /* set idle */
+    }
+    if (handle->async_callback != NULL)                                               /* if callback */
+    {
+        handle->async_callback(res);                                                  /* run the callback */
+    }
+}
+
+/**
+ * @brief     start an async transfer of a window
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @param[in] left left address of the window
+ * @param[in] top top address of the window
+ * @param[in] right right address of the window
+ * @param[in] bottom bottom address of the window
+ * @param[in] *image pointer to an image buffer or NULL
+ * @param[in] color fill color used when image is NULL
+ * @return    status code
+ *            - 0 success
+ *            - 1 start failed
+ * @note      the window is set synchronously and the pixel data is sent by spi_write_cmd_async
+ */
+static uint8_t a_ssd1351_async_start(ssd1351_handle_t *handle, uint8_t left, uint8_t top, uint8_t right, uint8_t bottom, 
+                                     const uint32_t *image, uint32_t color)
+{
+    uint32_t total;
+    
+    total = (uint32_t)(right - left + 1) * (bottom - top + 1);                        /* get pixel number */
+    if (a_ssd1351_buffer_send(handle) != 0)                                           /* send pending data */
+    {
+        handle->debug_print("ssd1351: write data failed.\n");                         /* write data failed */
+        
+        return 1;                                                                     /* return error */
+    }
+    if (a_ssd1351_set_gram_window(handle, left, top, right, bottom, total) != 0)      /* set gram window */
+    {
+        return 1;                                                                     /* return error */
+    }
+    if (a_ssd1351_set_dc(handle, SSD1351_DATA) != 0)                                  /* set data */
+    {
+        handle->window_valid = 0;                                                     /* invalidate window */
+        handle->debug_print("ssd1351: write data failed.\n");                         /* write data failed */
+        
+        return 1;                                                                     /* return error */
+    }
+    handle->async_image = image;                                                      /* set image */
+    handle->async_color = color;                                                      /* set color */
+    handle->async_pos = 0;                                                            /* set pos */
+    handle->async_total = total;                                                      /* set total */
+    a_ssd1351_async_pack(handle, 0);                                                  /* pack 1st half */
+    a_ssd1351_async_pack(handle, 1);                                                  /* pack 2nd half */
+    handle->async_half = 0;                                                           /* set half */
+    handle->async_status = SSD1351_ASYNC_STATUS_BUSY;                                 /* set busy */
+    if (handle->spi_write_cmd_async(handle->buf, handle->async_len[0]) != 0)          /* start transfer */
+    {
+        handle->window_valid = 0;                                                     /* invalidate window */
+        handle->async_status = SSD1351_ASYNC_STATUS_FAILED;                           /* set failed */
+        handle->debug_print("ssd1351: write data failed.\n");                         /* write data failed */
+        
+        return 1;                                                                     /* return error */
+    }
+    
+    return 0;                                                                         /* success return 0 */
+}
+
+/**
+ * @brief     set the display column address
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @param[in] start_address start address
+ * @param[in] end_address end address
+ * @return    status code
+ *            - 0 success
+ *            - 1 set column address failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 address is invalid
+ *            - 5 start_address > end_address
+ * @note      start_address <= 127 && end_address <= 127 && start_address <= end_address
+ */
+uint8_t ssd1351_set_column_address(ssd1351_handle_t *handle, uint8_t start_address, uint8_t end_address)
+{
+    if (handle == NULL)                                                                  /* check handle */
+    {
+        return 2;                                                                        /* return error */
+    }
+    if (handle->inited != 1)                                                             /* check handle initialization */
+    {
+        return 3;                                                                        /* return error */
+    }
+    if ((start_address > 127) || (end_address > 127))                                    /* check range */
+    {
+        handle->debug_print("ssd1351: address is invalid.\n");                           /* address is invalid */
+        
+        return 4;                                                                        /* return error */
+    }
+    if (start_address > end_address)                                                     /* check range */
+    {
+        handle->debug_print("ssd1351: start_address > end_address.\n");                  /* start_address > end_address */
+        
+        return 5;                                                                        /* return error */
+    }
+
+    handle->window_valid = 0;                                                            /* invalidate window */
+    if (a_ssd1351_write_byte(handle, SSD1351_CMD_SET_COLUMN_ADDRESS, SSD1351_CMD) != 0)  /* write column address command */
+    {
+        handle->debug_print("ssd1351: write command failed.\n");                         /* write command failed */
+        
+        return 1;                                                                        /* return error */
+    }
+    if (a_ssd1351_write_byte(handle, start_address, SSD1351_DATA) != 0)                  /* set start address */
+    {
+        handle->debug_print("ssd1351: write start address failed.\n");                   /* write start address failed */
+        
+        return 1;                                                                        /* return error */
+    }
+    if (a_ssd1351_write_byte(handle, end_address, SSD1351_DATA) != 0)                    /* set end address */
+    {
+        handle->debug_print("ssd1351: write end address failed.\n");                     /* write end address failed */
+        
+        return 1;                                                                        /* return error */
+    }
+
+    return 0;                                                                            /* success return 0 */
+}
+
+/**
+ * @brief     set the row address
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @param[in] start_address start address
+ * @param[in] end_address end address
+ * @return    status code
+ *            - 0 success
+ *            - 1 set row address failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 address is invalid
+ *            - 5 start_address > end_address
+ * @note      start_address <= 127 && end_address <= 127 && start_address <= end_address
+ */
+uint8_t ssd1351_set_row_address(ssd1351_handle_t *handle, uint8_t start_address, uint8_t end_address)
+{
+    if (handle == NULL)                                                              /* check handle */
+    {
+        return 2;                                                                    /* return error */
+    }
+    if (handle->inited != 1)                                                         /* check handle initialization */
+    {
+        return 3;                                                                    /* return error */
+    }
+    if ((start_address > 127) || (end_address > 127))                                /* check range */
+    {
+        handle->debug_print("ssd1351: address is invalid.\n");                       /* address is invalid */
+        
+        return 4;                                                                    /* return error */
+    }
+    if (start_address > end_address)                                                 /* check range */
+    {
+        handle->debug_print("ssd1351: start_address > end_address.\n");              /* start_address > end_address */
+        
+        return 5;                                                                    /* return error */
+    }
+    
+    handle->window_valid = 0;                                                        /* invalidate window */
+    if (a_ssd1351_write_byte(handle, SSD1351_CMD_SET_ROW_ADDRESS, SSD1351_CMD)!= 0)  /* set row address */
+    {
+        handle->debug_print("ssd1351: write command failed.\n");                     /* write command failed */
+        
+        return 1;                                                                    /* return error */
+    }
+    if (a_ssd1351_write_byte(handle, start_address, SSD1351_DATA) != 0)              /* set start address */
+    {
+        handle->debug_print("ssd1351: write start address failed.\n");               /* write start address failed */
+        
+        return 1;                                                                    /* return error */
+    }
+    if (a_ssd1351_write_byte(handle, end_address, SSD1351_DATA) != 0)                /* set end address */
+    {
+        handle->debug_print("ssd1351: write end address failed.\n");                 /* write end address failed */
+        
+        return 1;                                                                    /* return error */
+    }
+
+    return 0;                                                                        /* success return 0 */
+}
+
+/**
+ * @brief     sent the write ram command
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 write ram failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t ssd1351_write_ram(ssd1351_handle_t *handle)
+{
+    if (handle == NULL)                                                         /* check handle */
+    {
+        return 2;                                                               /* return error */
+    }
+    if (handle->inited != 1)                                                    /* check handle initialization */
+    {
+        return 3;                                                               /* return error */
+    }
+    
+    if (a_ssd1351_write_byte(handle, SSD1351_CMD_WRITE_RAM, SSD1351_CMD) != 0)  /* set write ram */
+    {
+        handle->debug_print("ssd1351: write ram failed.\n");                    /* write ram failed */
+        
+        return 1;                                                               /* return error */
+    }
+    
+    return 0;                                                                   /* success return 0 */
+}
+
+/**
+ * @brief     sent the read ram command
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 read ram failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t ssd1351_read_ram(ssd1351_handle_t *handle)
+{
+    if (handle == NULL)                                                        /* check handle */
+    {
+        return 2;                                                              /* return error */
+    }
+    if (handle->inited != 1)                                                   /* check handle initialization */
+    {
+        return 3;                                                              /* return error */
+    }
+  
+    if (a_ssd1351_write_byte(handle, SSD1351_CMD_READ_RAM, SSD1351_CMD) != 0)  /* set read ram */
+    {
+        handle->debug_print("ssd1351: read command failed.\n");                /* return error */
+        
+        return 1;
+    }
+    
+    return 0;                                                                  /* success return 0 */
+}
+
+/**
+ * @brief     set the display color depth
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @param[in] color_depth color depth
+ * @return    status code
+ *            - 0 success
+ *            - 1 set color depth failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 color depth is fixed
+ * @note      with SSD1351_FIXED_COLOR_DEPTH only the fixed value can be set
+ */
+uint8_t ssd1351_set_color_depth(ssd1351_handle_t *handle, ssd1351_color_depth_t color_depth)
+{
+    if (handle == NULL)                                                                     /* check handle */
+    {
+        return 2;                                                                           /* return error */
+    }
+    if (handle->inited != 1)                                                                /* check handle initialization */
+    {
+        return 3;                                                                           /* return error */
+    }
+    
+#if (SSD1351_FIXED_COLOR_DEPTH != 0xFF)
+    if (color_depth != SSD1351_FIXED_COLOR_DEPTH)                                           /* check fixed color depth */
+    {
+        handle->debug_print("ssd1351: color depth is fixed.\n");                            /* color depth is fixed */
+        
+        return 4;                                                                           /* return error */
+    }
+#endif
+    
+    handle->conf_1 &= ~ (3 << 6);                                                           /* clear conf */
+    handle->conf_1 |= color_depth << 6;                                                     /* set conf */
+    a_ssd1351_select_packer(handle);                                                        /* select packer */
+    if (a_ssd1351_write_byte(handle, SSD1351_CMD_SET_REMAP_COLOR_DEPTH, SSD1351_CMD) != 0)  /* set color depth */
+    {
+        handle->debug_print("ssd1351: write color depth failed.\n");                        /* write color depth failed */
+        
+        return 1;                                                                           /* return error */
+    }
+    if (a_ssd1351_write_byte(handle, handle->conf_1, SSD1351_DATA) != 0)                    /* set conf */
+    {
+        handle->debug_print("ssd1351: write color depth failed.\n");                        /* write color depth failed */
+        
+        return 1;                                                                           /* return error */
+    }
+    
+    return 0;                                                                               /* success return 0 */
+}
+
+/**
+ * @brief     set the address increment
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @param[in] increment address increment param
+ * @return    status code
+ *            - 0 success
+ *            - 1 set address increment failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t ssd1351_set_address_increment(ssd1351_handle_t *handle, ssd1351_address_increment_t increment)
+{
+    if (handle == NULL)                                                                     /* check handle */
+    {
+        return 2;                                                                           /* return error */
+    }
+    if (handle->inited != 1)                                                                /* check handle initialization */
+    {
+        return 3;                                                                           /* return error */
+    }
+    
+    handle->conf_1 &= ~ (1 << 0);                                                           /* clear conf */
+    handle->conf_1 |= increment << 0;                                                       /* set conf */
+    handle->fb_increment = (uint8_t)increment;                                              /* set framebuffer cursor increment */
+    if (a_ssd1351_write_byte(handle, SSD1351_CMD_SET_REMAP_COLOR_DEPTH, SSD1351_CMD) != 0)  /* set address increment */
+    {
+        handle->debug_print("ssd1351: write address increment failed.\n");                  /* write address increment failed */
+        
+        return 1;                                                                           /* return error */
+    }
+    if (a_ssd1351_write_byte(handle, handle->conf_1, SSD1351_DATA) != 0)                    /* set conf */
+    {
+        handle->debug_print("ssd1351: write address increment failed.\n");                  /* write address increment failed */
+        
+        return 1;                                                                           /* return error */
+    }
+    
+    return 0;                                                                               /* success return 0 */
+}
+
+/**
+ * @brief     set the seg0 map
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @param[in] seg0_map seg0 map
+ * @return    status code
+ *            - 0 success
+ *            - 1 set seg0 map failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t ssd1351_set_seg0_map(ssd1351_handle_t *handle, ssd1351_seg0_mapped_t seg0_map)
+{
+    if (handle == NULL)                                                                     /* check handle */
+    {
+        return 2;                                                                           /* return error */
+    }
+    if (handle->inited != 1)                                                                /* check handle initialization */
+    {
+        return 3;                                                                           /* return error */
+    }
+    
+    handle->conf_1 &= ~ (1 << 1);                                                           /* clear conf */
+    handle->conf_1 |= seg0_map << 1;                                                        /* set conf */
+    if (a_ssd1351_write_byte(handle, SSD1351_CMD_SET_REMAP_COLOR_DEPTH, SSD1351_CMD) != 0)  /* set seg0 map */
+    {
+        handle->debug_print("ssd1351: write seg0 map failed.\n");                           /* write seg0 map failed */
+        
+        return 1;                                                                           /* return error */
+    }
+    if (a_ssd1351_write_byte(handle, handle->conf_1, SSD1351_DATA) != 0)                    /* set conf */
+    {
+        handle->debug_print("ssd1351: write seg0 map failed.\n");                           /* write seg0 map failed */
+        
+        return 1;                                                                           /* return error */
+    }
+    
+    return 0;                                                                               /* success return 0 */
+}
+
+/**
+ * @brief     set the color sequence
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @param[in] color_sequence display color sequence
+ * @return    status code
+ *            - 0 success
+ *            - 1 set color sequence failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 color sequence is fixed
+ * @note      with SSD1351_FIXED_COLOR_SEQUENCE only the fixed value can be set
+ */
+uint8_t ssd1351_set_color_sequence(ssd1351_handle_t *handle, ssd1351_color_sequence_t color_sequence)
+{
+    if (handle == NULL)                                                                     /* check handle */
+    {
+        return 2;                                                                           /* return error */
+    }
+    if (handle->inited != 1)                                                                /* check handle initialization */
+    {
+        return 3;                                                                           /* return error */
+    }
+    
+#if (SSD1351_FIXED_COLOR_SEQUENCE != 0xFF)
+    if (color_sequence != SSD1351_FIXED_COLOR_SEQUENCE)                                     /* check fixed color sequence */
+    {
+        handle->debug_print("ssd1351: color sequence is fixed.\n");                         /* color sequence is fixed */
+        
+        return 4;                                                                           /* return error */
+    }
+#endif
+    
+    handle->conf_1 &= ~ (1 << 2);                                                           /* clear conf */
+    handle->conf_1 |= color_sequence << 2;                                                  /* set conf */
+    a_ssd1351_select_packer(handle);                                                        /* select packer */
+    if (a_ssd1351_write_byte(handle, SSD1351_CMD_SET_REMAP_COLOR_DEPTH, SSD1351_CMD) != 0)  /* set color sequence */
+    {
+        handle->debug_print("ssd1351: write color sequence failed.\n");                     /* write color sequence failed */
+        
+        return 1;                                                                           /* return error */
+    }
+    if (a_ssd1351_write_byte(handle, handle->conf_1, SSD1351_DATA) != 0)                    /* set conf */
+    {
+        handle->debug_print("ssd1351: write color sequence failed.\n");                     /* write color sequence failed */
+        
+        return 1;                                                                           /* return error */
+    }
+    
+    return 0;                                                                               /* success return 0 */
+}
+
+/**
+ * @brief     set the scan mode
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @param[in] mode scan mode
+ * @return    status code
+ *            - 0 success
+ *            - 1 set scan mode failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t ssd1351_set_scan_mode(ssd1351_handle_t *handle, ssd1351_scan_mode_t mode)
+{
+    if (handle == NULL)                                                                     /* check handle */
+    {
+        return 2;                                                                           /* return error */
+    }
+    if (handle->inited != 1)                                                                /* check handle initialization */
+    {
+        return 3;                                                                           /* return error */
+    }
+    
+    handle->conf_1 &= ~ (1 << 4);                                                           /* clear conf */
+    handle->conf_1 |= mode << 4;                                                            /* set conf */
+    if (a_ssd1351_write_byte(handle, SSD1351_CMD_SET_REMAP_COLOR_DEPTH, SSD1351_CMD) != 0)  /* set scan mode */
+    {
+        handle->debug_print("ssd1351: write scan mode failed.\n");                          /* write scan mode failed */
+        
+        return 1;                                                                           /* return error */
+    }
+    if (a_ssd1351_write_byte(handle, handle->conf_1, SSD1351_DATA) != 0)                    /* set conf */
+    {
+        handle->debug_print("ssd1351: write scan mode failed.\n");                          /* write scan mode failed */
+        
+        return 1;                                                                           /* return error */
+    }
+    
+    return 0;                                                                               /* success return 0 */
+}
+
+/**
+ * @brief     set the com split odd or even
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @param[in] enable bool value
+ * @return    status code
+ *            - 0 success
+ *            - 1 set com split odd even failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t ssd1351_set_com_split_odd_even(ssd1351_handle_t *handle, ssd1351_bool_t enable)
+{
+    if (handle == NULL)                                                                     /* check handle */
+    {
+        return 2;                                                                           /* return error */
+    }
+    if (handle->inited != 1)                                                                /* check handle initialization */
+    {
+        return 3;                                                                           /* return error */
+    }
+    
+    handle->conf_1 &= ~ (1 << 5);                                                           /* clear conf */
+    handle->conf_1 |= enable << 5;                                                          /* set conf */
+    if (a_ssd1351_write_byte(handle, SSD1351_CMD_SET_REMAP_COLOR_DEPTH, SSD1351_CMD) != 0)  /* set com split odd even */
+    {
+        handle->debug_print("ssd1351: write com split odd even failed.\n");                 /* write com split odd even failed */
+        
+        return 1;                                                                           /* return error */
+    }
+    if (a_ssd1351_write_byte(handle, handle->conf_1, SSD1351_DATA) != 0)                    /* set conf */
+    {
+        handle->debug_print("ssd1351: write com split odd even failed.\n");                 /* write com split odd even failed */
+        
+        return 1;                                                                           /* return error */
+    }
+    
+    return 0;                                                                               /* success return 0 */
+}
+
+/**
+ * @brief     set the display start line
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @param[in] l start line
+ * @return    status code
+ *            - 0 success
+ *            - 1 set display start line failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 line is over 127
+ * @note      line <= 127
+ */
+uint8_t ssd1351_set_display_start_line(ssd1351_handle_t *handle, uint8_t l)
+{
+    if (handle == NULL)                                                                      /* check handle */
+    {
+        return 2;                                                                            /* return error */
+    }
+    if (handle->inited != 1)                                                                 /* check handle initialization */
+    {
+        return 3;                                                                            /* return error */
+    }
+    if (l > 127)                                                                             /* check line */
+    {
+        handle->debug_print("ssd1351: line is over 127.\n");                                 /* line is over 127 */
+        
+        return 4;                                                                            /* return error */
+    }
+    
+    if (a_ssd1351_write_byte(handle, SSD1351_CMD_SET_DISPLAY_START_LINE, SSD1351_CMD) != 0)  /* set display start line */
+    {
+        handle->debug_print("ssd1351: write start line failed.\n");                          /* write start line failed */
+        
+        return 1;                                                                            /* return error */
+    }
+    if (a_ssd1351_write_byte(handle, l, SSD1351_DATA) != 0)                                  /* set display start line */
+    {
+        handle->debug_print("ssd1351: write data failed.\n");                                /* write data failed */
+        
+        return 1;                                                                            /* return error */
+    }
+
+    return 0;                                                                                /* success return 0 */
+}
+
+/**
+ * @brief     set the display offset
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @param[in] offset display offset
+ * @return    status code
+ *            - 0 success
+ *            - 1 set display offset failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 offset is over 127
+ * @note      offset <= 127
+ */
+uint8_t ssd1351_set_display_offset(ssd1351_handle_t *handle, uint8_t offset)
+{
+    if (handle == NULL)                                                                  /* check handle */
+    {
+        return 2;                                                                        /* return error */
+    }
+    if (handle->inited != 1)                                                             /* check handle initialization */
+    {
+        return 3;                                                                        /* return error */
+    }
+    if (offset > 127)                                                                    /* check offset */
+    {
+        handle->debug_print("ssd1351: offset is over 127.\n");                           /* offset is over 127 */
+        
+        return 4;                                                                        /* return error */
+    }
+  
+    if (a_ssd1351_write_byte(handle, SSD1351_CMD_SET_DISPLAY_OFFSET, SSD1351_CMD) != 0)  /* set display offset */ 
+    {
+        handle->debug_print("ssd1351: write display offset failed.\n");                  /* write display offset failed */
+        
+        return 1;                                                                        /* return error */
+    }
+    if (a_ssd1351_write_byte(handle, offset, SSD1351_DATA) != 0)                         /* set display offset */
+    {
+        handle->debug_print("ssd1351: write data failed.\n");                            /* write data failed */
+        
+        return 1;                                                                        /* return error */
+    }
+
+    return 0;                                                                            /* success return 0 */
+}
+
+/**
+ * @brief     set the display mode
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @param[in] mode display mode
+ * @return    status code
+ *            - 0 success
+ *            - 1 set display mode failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t ssd1351_set_display_mode(ssd1351_handle_t *handle, ssd1351_display_mode_t mode)
+{
+    if (handle == NULL)                                                      /* check handle */
+    {
+        return 2;                                                            /* return error */
+    }
+    if (handle->inited != 1)                                                 /* check handle initialization */
+    {
+        return 3;                                                            /* return error */
+    }
+
+    if (a_ssd1351_write_byte(handle, mode, SSD1351_CMD) != 0)                /* set display mode */
+    {
+        handle->debug_print("ssd1351: write display mode failed.\n");        /* write display mode failed */
+        
+        return 1;                                                            /* return error */
+    }
+    
+    return 0;                                                                /* success return 0 */
+}
+
+/**
+ * @brief     set the select vdd
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @param[in] vdd chip vdd
+ * @return    status code
+ *            - 0 success
+ *            - 1 set select vdd failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t ssd1351_set_select_vdd(ssd1351_handle_t *handle, ssd1351_select_vdd_t vdd)
+{
+    if (handle == NULL)                                                                  /* check handle */
+    {
+        return 2;                                                                        /* return error */
+    }
+    if (handle->inited != 1)                                                             /* check handle initialization */
+    {
+        return 3;                                                                        /* return error */
+    }
+
+    handle->conf_2 &= ~ (1 << 0);                                                        /* clear config */
+    handle->conf_2 |= vdd << 0;                                                          /* set vdd */
+    if (a_ssd1351_write_byte(handle, SSD1351_CMD_FUNCTION_SELECTION, SSD1351_CMD) != 0)  /* set select vdd */
+    {
+        handle->debug_print("ssd1351: write function selection failed.\n");              /* write function selection failed */
+        
+        return 1;                                                                        /* return error */
+    }
+    if (a_ssd1351_write_byte(handle, handle->conf_2, SSD1351_DATA) != 0)                 /* set select vdd */
+    {
+        handle->debug_print("ssd1351: write function selection failed.\n");              /* write function selection failed */
+        
+        return 1;                                                                        /* return error */
+    }
+    
+    return 0;                                                                            /* success return 0 */
+}
+
+/**
+ * @brief     set the interface parallel bits
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @param[in] parallel_bits interface parallel bits
+ * @return    status code
+ *            - 0 success
+ *            - 1 set parallel bits failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t ssd1351_set_parallel_bits(ssd1351_handle_t *handle, ssd1351_select_parallel_bits_t parallel_bits)
+{
+    if (handle == NULL)                                                                  /* check handle */
+    {
+        return 2;                                                                        /* return error */
+    }
+    if (handle->inited != 1)                                                             /* check handle initialization */
+    {
+        return 3;                                                                        /* return error */
+    }
+
+    handle->conf_2 &= ~ (3 << 6);                                                        /* clear config */
+    handle->conf_2 |= parallel_bits << 6;                                                /* set bits */
+    if (a_ssd1351_write_byte(handle, SSD1351_CMD_FUNCTION_SELECTION, SSD1351_CMD) != 0)  /* set parallel bits */
+    {
+        handle->debug_print("ssd1351: write parallel bits failed.\n");                   /* write parallel bits failed */
+        
+        return 1;                                                                        /* return error */
+    }
+    if (a_ssd1351_write_byte(handle, handle->conf_2, SSD1351_DATA) != 0)                 /* set parallel bits */
+    {
+        handle->debug_print("ssd1351: write parallel bits failed.\n");                   /* write parallel bits failed */
+        
+        return 1;                                                                        /* return error */
+    }
+    
+    return 0;                                                                            /* success return 0 */
+}
+
+/**
+ * @brief     set the sleep mode
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @param[in] enable bool value
+ * @return    status code
+ *            - 0 success
+ *            - 1 set sleep mode failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t ssd1351_set_sleep_mode(ssd1351_handle_t *handle, ssd1351_bool_t enable)
+{
+    if (handle == NULL)                                                                      /* check handle */
+    {
+        return 2;                                                                            /* return error */
+    }
+    if (handle->inited != 1)                                                                 /* check handle initialization */
+    {
+        return 3;                                                                            /* return error */
+    }
+    
+    if (enable == SSD1351_BOOL_TRUE)                                                         /* if sleep mode on */
+    {
+        if (a_ssd1351_write_byte(handle, SSD1351_CMD_SET_SLEEP_MODE_ON, SSD1351_CMD) != 0)   /* set sleep mode on */
+        {
+            handle->debug_print("ssd1351: set sleep mode on failed.\n");                     /* set sleep mode on failed */
+            
+            return 1;                                                                        /* return error */
+        }
+        
+        return 0;                                                                            /* success return 0 */
+    }
+    else if (enable == SSD1351_BOOL_FALSE)                                                   /* if sleep mode off */
+    {
+        if (a_ssd1351_write_byte(handle, SSD1351_CMD_SET_SLEEP_MODE_OFF, SSD1351_CMD) != 0)  /* set sleep mode off */ 
+        {
+            handle->debug_print("ssd1351: set sleep mode off failed.\n");                    /* set sleep mode off failed */
+            
+            return 1;                                                                        /* return error */
+        }
+        
+        return 0;                                                                            /* success return 0 */
+    }
+    else
+    {
+        handle->debug_print("ssd1351: param is invalid.\n");                                 /* param is invalid */
+        
+        return 1;                                                                            /* return error */
+    }
+}
+
+/**
+ * @brief     set the phase period
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @param[in] phase1_period phase 1 period
+ * @param[in] phase2_period phase 2 period
+ * @return    status code
+ *            - 0 success
+ *            - 1 set phase period failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 phase1_period is less than 2
+ *            - 5 phase1_period is over 15
+ *            - 6 phase2_period is less than 3
+ *            - 7 phase2_period is over 15
+ * @note      2 <= phase1_period <=15 && 3 <= phase2_period <= 15
+ */
+uint8_t ssd1351_set_phase_period(ssd1351_handle_t *handle, uint8_t phase1_period, uint8_t phase2_period)
+{
+    if (handle == NULL)                                                                           /* check handle */
+    {
+        return 2;                                                                                 /* return error */
+    }
+    if (handle->inited != 1)                                                                      /* check handle initialization */
+    {
+        return 3;                                                                                 /* return error */
+    }
+    if (phase1_period < 2)                                                                        /* check phase1 */
+    {
+        handle->debug_print("ssd1351: phase1_period is less than 2.\n");                          /* phase1_period is less than 2 */
+        
+        return 4;                                                                                 /* return error */
+    }
+    if (phase1_period > 15)                                                                       /* check phase1 */
+    {
+        handle->debug_print("ssd1351: phase1_period is over 15.\n");                              /* phase1_period is over 15 */
+        
+        return 5;                                                                                 /* return error */
+    }
+    if (phase2_period < 3)                                                                        /* check phase2 */
+    {
+        handle->debug_print("ssd1351: phase2_period is less than 3.\n");                          /* phase2_period is less than 3 */
+        
+        return 6;                                                                                 /* return error */
+    }
+    if (phase2_period > 15)                                                                       /* check phase2 */
+    {
+        handle->debug_print("ssd1351: phase2_period is over 15.\n");                              /* phase2_period is over 15 */
+        
+        return 7;                                                                                 /* return error */
+    }
+
+    if (a_ssd1351_write_byte(handle, SSD1351_CMD_SET_RESET_PRE_CHARGE_PERIOD, SSD1351_CMD) != 0)  /* set reset pre charge period */
+    {
+        handle->debug_print("ssd1351: write reset pre charge period failed.\n");                  /* write reset pre-charge period failed */
+        
+        return 1;                                                                                 /* return error */
+    }
+    if (a_ssd1351_write_byte(handle, (phase2_period << 4) | phase1_period, SSD1351_DATA) != 0)    /* set phase period */
+    {
+        handle->debug_print("ssd1351: write reset pre charge period failed.\n");                  /* write reset pre-charge period failed */
+        
+        return 1;                                                                                 /* return error */
+    }
+    
+    return 0;                                                                                     /* success return 0 */
+}
+
+/**
+ * @brief     set the front clock oscillator frequency
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @param[in] d clock div
+ * @param[in] frequency clock frequency
+ * @return    status code
+ *            - 0 success
+ *            - 1 set front clock oscillator frequency failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 div is over 11
+ *            - 5 frequency is over 15
+ * @note      div < 11 && frequency <= 15
+ */
+uint8_t ssd1351_set_front_clock_oscillator_frequency(ssd1351_handle_t *handle, uint8_t d, uint8_t frequency)
+{
+    if (handle == NULL)                                                                            /* check handle */
+    {
+        return 2;                                                                                  /* return error */
+    }
+    if (handle->inited != 1)                                                                       /* check handle initialization */
+    {
+        return 3;                                                                                  /* return error */
+    }
+    if (d >= 11)                                                                                   /* check div */
+    {
+        handle->debug_print("ssd1351: div is over 11.\n");                                         /* div is over 11 */
+        
+        return 4;                                                                                  /* return error */
+    }
+    if (frequency > 15)                                                                            /* check frequency */
+    {
+        handle->debug_print("ssd1351: frequency is over 15.\n");                                   /* frequency is over 15 */
+        
+        return 5;                                                                                  /* return error */
+    }
+    
+    if (a_ssd1351_write_byte(handle, SSD1351_CMD_FRONT_CLOCK_DIVIDER_OSC_FREQ, SSD1351_CMD) != 0)  /* set front clock divider osc freq */
+    {
+        handle->debug_print("ssd1351: write front clock divider osc freq failed.\n");              /* write front clock divider osc freq failed */
+        
+        return 1;                                                                                  /* return error */
+    }
+    if (a_ssd1351_write_byte(handle, (frequency << 4) | d, SSD1351_DATA) != 0)                     /* set front clock divider osc freq */
+    {
+        handle->debug_print("ssd1351: write front clock divider osc freq failed.\n");              /* write front clock divider osc freq failed */
+        
+        return 1;                                                                                  /* return error */
+    }
+    
+    return 0;                                                                                      /* success return 0 */
+}
+
+/**
+ * @brief     set the segment low voltage
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @param[in] segment segment low voltage
+ * @return    status code
+ *            - 0 success
+ *            - 1 set segment low voltage failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t ssd1351_set_segment_low_voltage(ssd1351_handle_t *handle, ssd1351_segment_low_voltage_t segment)
+{
+    if (handle == NULL)                                                                       /* check handle */
+    {
+        return 2;                                                                             /* return error */
+    }
+    if (handle->inited != 1)                                                                  /* check handle initialization */
+    {
+        return 3;                                                                             /* return error */
+    }
+    
+    if (a_ssd1351_write_byte(handle, SSD1351_CMD_SET_SEGMENT_LOW_VOLTAGE, SSD1351_CMD) != 0)  /* set segment low voltage */
+    {
+        handle->debug_print("ssd1351: write segment low voltage failed.\n");                  /* write segment low voltage failed */
+        
+        return 1;                                                                             /* return error */
+    }
+    if (a_ssd1351_write_byte(handle, (uint8_t)(0xA0 | segment), SSD1351_DATA) != 0)           /* set segment low voltage */
+    {
+        handle->debug_print("ssd1351: write segment low voltage failed.\n");                  /* write segment low voltage failed */
+        
+        return 1;                                                                             /* return error */
+    }
+    if (a_ssd1351_write_byte(handle, 0xB5, SSD1351_DATA) != 0)                                /* set segment low voltage */
+    {
+        handle->debug_print("ssd1351: write segment low voltage failed.\n");                  /* write segment low voltage failed */
+        
+        return 1;                                                                             /* return error */
+    }
+    if (a_ssd1351_write_byte(handle, 0x55, SSD1351_DATA) != 0)                                /* set segment low voltage */
+    {
+        handle->debug_print("ssd1351: write segment low voltage failed.\n");                  /* write segment low voltage failed */
+        
+        return 1;                                                                             /* return error */
+    }
+        
+    return 0;                                                                                 /* success return 0 */
+}
+
+/**
+ * @brief     set the gpio pin
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @param[in] gpio0 gpio 0 pin
+ * @param[in] gpio1 gpio 1 pin
+ * @return    status code
+ *            - 0 success
+ *            - 1 set gpio failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t ssd1351_set_gpio(ssd1351_handle_t *handle, ssd1351_gpio_pin_t gpio0, ssd1351_gpio_pin_t gpio1)
+{
+    if (handle == NULL)                                                        /* check handle */
+    {
+        return 2;                                                              /* return error */
+    }
+    if (handle->inited != 1)                                                   /* check handle initialization */
+    {
+        return 3;                                                              /* return error */
+    }
+    
+    if (a_ssd1351_write_byte(handle, SSD1351_CMD_SET_GPIO, SSD1351_CMD) != 0)  /* set gpio */
+    {
+        handle->debug_print("ssd1351: write gpio failed.\n");                  /* write gpio failed */
+        
+        return 1;                                                              /* return error */
+    }
+    if (a_ssd1351_write_byte(handle, 
+                            (uint8_t)((gpio1 << 2) | gpio0),
+                             SSD1351_DATA) != 0)                               /* set gpio */
+    {
+        handle->debug_print("ssd1351: write gpio failed.\n");                  /* write gpio failed */
+        
+        return 1;                                                              /* return error */
+    }
+    
+    return 0;                                                                  /* success return 0 */
+}
+
+/**
+ * @brief     set the second pre charge period
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @param[in] period pre charge period
+ * @return    status code
+ *            - 0 success
+ *            - 1 set second pre charge period failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 period is over 15
+ * @note      none
+ */
+uint8_t ssd1351_set_second_pre_charge_period(ssd1351_handle_t *handle, uint8_t period)
+{
+    if (handle == NULL)                                                                            /* check handle */
+    {
+        return 2;                                                                                  /* return error */
+    }
+    if (handle->inited != 1)                                                                       /* check handle initialization */
+    {
+        return 3;                                                                                  /* return error */
+    }
+    if (period > 15)                                                                               /* check period */
+    {
+        handle->debug_print("ssd1351: period is over 15.\n");                                      /* period is over 15 */
+        
+        return 4;                                                                                  /* return error */
+    }
+    
+    if (a_ssd1351_write_byte(handle, SSD1351_CMD_SET_SECOND_PRE_CHARGE_PERIOD, SSD1351_CMD) != 0)  /* set second pre-charge period */
+    {
+        handle->debug_print("ssd1351: write second pre charge period failed.\n");                  /* write second pre-charge period failed */
+        
+        return 1;                                                                                  /* return error */
+    }
+    if (a_ssd1351_write_byte(handle, period, SSD1351_DATA) != 0)                                   /* set second pre-charge period */
+    {
+        handle->debug_print("ssd1351: write second pre charge period failed.\n");                  /* write second pre-charge period failed */
+        
+        return 1;                                                                                  /* return error */
+    }
+    
+    return 0;                                                                                      /* success return 0 */
+}
+
+/**
+ * @brief     set the gray scale pulse width
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @param[in] *gamma pointer to a gamma table buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 set gray scale pulse width failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t ssd1351_set_gray_scale_pulse_width(ssd1351_handle_t *handle, uint8_t gamma[63])
+{
+    uint8_t i;
+    
+    if (handle == NULL)                                                                      /* check handle */
+    {
+        return 2;                                                                            /* return error */
+    }
+    if (handle->inited != 1)                                                                 /* check handle initialization */
+    {
+        return 3;                                                                            /* return error */
+    }
+    
+    if (a_ssd1351_write_byte(handle, SSD1351_CMD_GRAY_SCALE_PULSE_WIDTH, SSD1351_CMD) != 0)  /* set gray scale pulse width */
+    {
+        handle->debug_print("ssd1351: write gray scale pulse width failed.\n");              /* write gray scale pulse width failed */
+        
+        return 1;                                                                            /* return error */
+    }
+    for (i = 0; i < 63; i++)                                                                 /* 64 times */
+    {
+        if (a_ssd1351_write_byte(handle, gamma[i], SSD1351_DATA) != 0)                       /* set gamma */
+        {
+            handle->debug_print("ssd1351: write gamma failed.\n");                           /* write gamma failed */
+            
+            return 1;                                                                        /* return error */
+        }
+    }
+    
+    return 0;                                                                                /* success return 0 */
+}
+
+/**
+ * @brief     use built in linear lut
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 set use built in linear lut failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t ssd1351_set_use_built_in_linear_lut(ssd1351_handle_t *handle)
+{
+    if (handle == NULL)                                                                       /* check handle */
+    {
+        return 2;                                                                             /* return error */
+    }
+    if (handle->inited != 1)                                                                  /* check handle initialization */
+    {
+        return 3;                                                                             /* return error */
+    }
+    
+    if (a_ssd1351_write_byte(handle, SSD1351_CMD_USE_BUILT_IN_LINEAR_LUT, SSD1351_CMD) != 0)  /* set use built in linear lut */
+    {
+        handle->debug_print("ssd1351: use built in linear lut failed.\n");                    /* write use built in linear lut failed */
+        
+        return 1;                                                                             /* return error */
+    }
+    
+    return 0;                                                                                 /* success return 0 */
+}
+
+/**
+ * @brief     set the pre charge voltage
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @param[in] voltage_level pre charge voltage level
+ * @return    status code
+ *            - 0 success
+ *            - 1 set pre charge voltage failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 voltage level is over 0x1F
+ * @note      voltage_level <= 0x1F
+ */
+uint8_t ssd1351_set_pre_charge_voltage(ssd1351_handle_t *handle, uint8_t voltage_level)
+{
+    if (handle == NULL)                                                                      /* check handle */
+    {
+        return 2;                                                                            /* return error */
+    }
+    if (handle->inited != 1)                                                                 /* check handle initialization */
+    {
+        return 3;                                                                            /* return error */
+    }
+    if (voltage_level > 0x1F)                                                                /* check voltage level */
+    {
+        handle->debug_print("ssd1351: voltage level is over 0x1F.\n");                       /* voltage level is over 0x1F */
+        
+        return 4;                                                                            /* return error */
+    }
+    
+    if (a_ssd1351_write_byte(handle, SSD1351_CMD_SET_PRE_CHARGE_VOLTAGE, SSD1351_CMD) != 0)  /* set pre charge voltage */
+    {
+        handle->debug_print("ssd1351: write pre charge voltage failed.\n");                  /* write pre-charge voltage failed */
+        
+        return 1;                                                                            /* return error */
+    }
+    if (a_ssd1351_write_byte(handle, voltage_level, SSD1351_DATA) != 0)                      /* set pre charge voltage */
+    {
+        handle->debug_print("ssd1351: write pre charge voltage failed.\n");                  /* write pre-charge voltage failed */
+        
+        return 1;                                                                            /* return error */
+    }
+    
+    return 0;                                                                                /* success return 0 */
+}
+
+/**
+ * @brief     set the vcomh voltage
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @param[in] voltage_level vcomh voltage level
+ * @return    status code
+ *            - 0 success
+ *            - 1 set vcomh voltage failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 voltage level is over 0x07
+ * @note      voltage_level <= 0x07
+ */
+uint8_t ssd1351_set_vcomh_voltage(ssd1351_handle_t *handle, uint8_t voltage_level)
+{
+    if (handle == NULL)                                                                 /* check handle */
+    {
+        return 2;                                                                       /* return error */
+    }
+    if (handle->inited != 1)                                                            /* check handle initialization */
+    {
+        return 3;                                                                       /* return error */
+    }
+    if (voltage_level > 0x07)                                                           /* check voltage level */
+    {
+        handle->debug_print("ssd1351: voltage level is over 0x07.\n");                  /* voltage level is over 0x07 */
+        
+        return 4;                                                                       /* return error */
+    }
+    
+    if (a_ssd1351_write_byte(handle, SSD1351_CMD_SET_VCOMH_VOLTAGE, SSD1351_CMD) != 0)  /* set vcomh voltage */
+    {
+        handle->debug_print("ssd1351: write vcomh voltage failed.\n");                  /* write vcomh voltage failed */
+        
+        return 1;                                                                       /* return error */
+    }
+    if (a_ssd1351_write_byte(handle, voltage_level, SSD1351_DATA) != 0)                 /* set vcomh voltage */
+    {
+        handle->debug_print("ssd1351: write vcomh voltage failed.\n");                  /* write vcomh voltage failed */
+        
+        return 1;                                                                       /* return error */
+    }
+    
+    return 0;                                                                           /* success return 0 */
+}
+
+/**
+ * @brief     set the display contrast
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @param[in] a contrast a
+ * @param[in] b contrast b
+ * @param[in] c contrast c
+ * @return    status code
+ *            - 0 success
+ *            - 1 set contrast failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t ssd1351_set_contrast(ssd1351_handle_t *handle, uint8_t a, uint8_t b, uint8_t c)
+{
+    if (handle == NULL)                                                            /* check handle */
+    {
+        return 2;                                                                  /* return error */
+    }
+    if (handle->inited != 1)                                                       /* check handle initialization */
+    {
+        return 3;                                                                  /* return error */
+    }
+    
+    if (a_ssd1351_write_byte(handle, SSD1351_CMD_SET_CONTRAST, SSD1351_CMD) != 0)  /* set contrast */
+    {
+        handle->debug_print("ssd1351: write contrast failed.\n");                  /* write contrast failed */
+        
+        return 1;                                                                  /* return error */
+    }
+    if (a_ssd1351_write_byte(handle, a, SSD1351_DATA) != 0)                        /* set a */
+    {
+        handle->debug_print("ssd1351: write a failed.\n");                         /* write a failed */
+        
+        return 1;                                                                  /* return error */
+    }
+    if (a_ssd1351_write_byte(handle, b, SSD1351_DATA) != 0)                        /* set b */
+    {
+        handle->debug_print("ssd1351: write b failed.\n");                         /* write b failed */
+        
+        return 1;                                                                  /* return error */
+    }
+    if (a_ssd1351_write_byte(handle, c, SSD1351_DATA) != 0)                        /* set c */
+    {
+        handle->debug_print("ssd1351: write c failed.\n");                         /* write c failed */
+        
+        return 1;                                                                  /* return error */
+    }
+    
+    return 0;                                                                      /* success return 0 */
+}
+
+/**
+ * @brief     set the master contrast current
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @param[in] current master contrast current
+ * @return    status code
+ *            - 0 success
+ *            - 1 set master contrast current failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 master contrast current is over 0x0F
+ * @note      current <= 0x0F
+ */
+uint8_t ssd1351_set_master_contrast_current(ssd1351_handle_t *handle, uint8_t current)
+{
+    if (handle == NULL)                                                                       /* check handle */
+    {
+        return 2;                                                                             /* return error */
+    }
+    if (handle->inited != 1)                                                                  /* check handle initialization */
+    {
+        return 3;                                                                             /* return error */
+    }
+    if (current > 0x0F)                                                                       /* check master contrast current */
+    {
+        handle->debug_print("ssd1351: master contrast current is over 0x0F.\n");              /* master contrast current is over 0x0F */
+        
+        return 4;                                                                             /* return error */
+    }
+    
+    if (a_ssd1351_write_byte(handle, SSD1351_CMD_MASTER_CONTRAST_CONTROL, SSD1351_CMD) != 0)  /* set master contrast current */
+    {
+        handle->debug_print("ssd1351: write master contrast current failed.\n");              /* write master contrast current failed */
+        
+        return 1;                                                                             /* return error */
+    }
+    if (a_ssd1351_write_byte(handle, current, SSD1351_DATA) != 0)                             /* set master contrast current */
+    {
+        handle->debug_print("ssd1351: write master contrast current failed.\n");              /* write master contrast current failed */
+        
+        return 1;                                                                             /* return error */
+    }
+        
+    return 0;                                                                                 /* success return 0 */
+}
+
+/**
+ * @brief     set the mux ratio
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @param[in] ratio mux ratio
+ * @return    status code
+ *            - 0 success
+ *            - 1 set mux ratio failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 ratio < 15
+ *            - 5 ratio > 127
+ * @note      15 <= ratio <= 127
+ */
+uint8_t ssd1351_set_mux_ratio(ssd1351_handle_t *handle, uint8_t ratio)
+{
+    if (handle == NULL)                                                                       /* check handle */
+    {
+        return 2;                                                                             /* return error */
+    }
+    if (handle->inited != 1)                                                                  /* check handle initialization */
+    {
+        return 3;                                                                             /* return error */
+    }
+    if (ratio < 15)                                                                           /* check ratio */
+    {
+        handle->debug_print("ssd1351: ratio < 15.\n");                                        /* ratio < 15 */
+        
+        return 4;                                                                             /* return error */
+    }
+    if (ratio > 127)                                                                          /* check ratio */
+    {
+        handle->debug_print("ssd1351: ratio > 127.\n");                                       /* ratio > 127 */
+        
+        return 5;                                                                             /* return error */
+    }
+    
+    if (a_ssd1351_write_byte(handle, SSD1351_CMD_SET_MUX_RATIO, SSD1351_CMD) != 0)            /* set mux ratio */
+    {
+        handle->debug_print("ssd1351: write mux ratio failed.\n");                            /* write mux ratio failed */
+        
+        return 1;                                                                             /* return error */
+    }
+    if (a_ssd1351_write_byte(handle, ratio, SSD1351_DATA) != 0)                               /* set mux ratio */
+    {
+        handle->debug_print("ssd1351: write mux ratio failed.\n");                            /* write mux ratio failed */
+        
+        return 1;                                                                             /* return error */
+    }
+        
+    return 0;                                                                                 /* success return 0 */
+}
+
+/**
+ * @brief     set the command
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @param[in] command sent command
+ * @return    status code
+ *            - 0 success
+ *            - 1 set command failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t ssd1351_set_command(ssd1351_handle_t *handle, ssd1351_command_t command)
+{
+    if (handle == NULL)                                                                /* check handle */
+    {
+        return 2;                                                                      /* return error */
+    }
+    if (handle->inited != 1)                                                           /* check handle initialization */
+    {
+        return 3;                                                                      /* return error */
+    }
+    
+    handle->window_valid = 0;                                                          /* invalidate window */
+    if (a_ssd1351_write_byte(handle, SSD1351_CMD_SET_COMMAND_LOCK, SSD1351_CMD) != 0)  /* set command lock */
+    {
+        handle->debug_print("ssd1351: write command lock failed.\n");                  /* write command lock failed */
+        
+        return 1;                                                                      /* return error */
+    }
+    if (a_ssd1351_write_byte(handle, command, SSD1351_DATA) != 0)                      /* set command lock */
+    {
+        handle->debug_print("ssd1351: write command lock failed.\n");                  /* write command lock failed */
+        
+        return 1;                                                                      /* return error */
+    }
+    
+    return 0;                                                                          /* success return 0 */
+}
+
+/**
+ * @brief     set the scroll
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @param[in] scroll display scroll
+ * @param[in] start_row scroll start row
+ * @param[in] row_len scroll row len
+ * @param[in] mode scroll mode
+ * @return    status code
+ *            - 0 success
+ *            - 1 set scroll failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 start row is over 127
+ *            - 5 start_row + row_len is over 128
+ * @note      start_row <= 127 && start_row + row_len <= 128
+ */
+uint8_t ssd1351_set_scroll(ssd1351_handle_t *handle, int8_t scroll, uint8_t start_row, uint8_t row_len, ssd1351_scroll_mode_t mode)
+{
+    if (handle == NULL)                                                                 /* check handle */
+    {
+        return 2;                                                                       /* return error */
+    }
+    if (handle->inited != 1)                                                            /* check handle initialization */
+    {
+        return 3;                                                                       /* return error */
+    }
+    if (start_row > 127)                                                                /* check start row */
+    {
+        handle->debug_print("ssd1351: start row is over 127.\n");                       /* start row is over 127 */
+        
+        return 4;                                                                       /* return error */
+    }
+    if ((start_row + row_len) > 128)                                                    /* check row len */
+    {
+        handle->debug_print("ssd1351: start_row + row_len is over 128.\n");             /* start_row + row_len is over 128 */
+        
+        return 5;                                                                       /* return error */
+    }
+    
+    if (a_ssd1351_write_byte(handle, SSD1351_CMD_STOP_MOVING, SSD1351_CMD) != 0)        /* set stop moving */
+    {
+        handle->debug_print("ssd1351: write stop moving failed.\n");                    /* write stop moving failed */
+        
+        return 1;                                                                       /* return error */
+    }
+    if (a_ssd1351_write_byte(handle, SSD1351_CMD_HORIZONTAL_SCROLL, SSD1351_CMD) != 0)  /* set horizontal scroll */
+    {
+        handle->debug_print("ssd1351: write horizontal scroll failed.\n");              /* write horizontal scroll failed */
+        
+        return 1;                                                                       /* return error */
+    }
+    if (a_ssd1351_write_byte(handle, scroll, SSD1351_DATA) != 0)                        /* set scroll */
+    {
+        handle->debug_print("ssd1351: write scroll failed.\n");                         /* write scroll failed */
+        
+        return 1;                                                                       /* return error */
+    }
+    if (a_ssd1351_write_byte(handle, start_row, SSD1351_DATA) != 0)                     /* set start row */
+    {
+        handle->debug_print("ssd1351: write start row failed.\n");                      /* write start row failed */
+        
+        return 1;                                                                       /* return error */
+    }
+    if (a_ssd1351_write_byte(handle, row_len, SSD1351_DATA) != 0)                       /* start row len */
+    {
+        handle->debug_print("ssd1351: write row len failed.\n");                        /* write row len failed */
+        
+        return 1;                                                                       /* return error */
+    }
+    if (a_ssd1351_write_byte(handle, 0x00, SSD1351_DATA) != 0)                          /* set 0x00 */
+    {
+        handle->debug_print("ssd1351: write data failed.\n");                           /* write data failed */
+        
+        return 1;                                                                       /* return error */
+    }
+    if (a_ssd1351_write_byte(handle, mode, SSD1351_DATA) != 0)                          /* set mode */
+    {
+        handle->debug_print("ssd1351: write mode failed.\n");                           /* write mode failed */
+        
+        return 1;                                                                       /* return error */
+    }
+    
+    return 0;                                                                           /* success return 0 */
+}
+
+/**
+ * @brief     clear the display
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 clear failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t ssd1351_clear(ssd1351_handle_t *handle)
+{
+    if (handle == NULL)                                                                     /* check handle */
+    {
+        return 2;                                                                           /* return error */
+    }
+    if (handle->inited != 1)                                                                /* check handle initialization */
+    {
+        return 3;                                                                           /* return error */
+    }
+    
+    if (handle->list_buf != NULL)                                                           /* if recording */
+    {
+        if (a_ssd1351_list_record(handle, SSD1351_DRAW_FILL_RECT, 
+                                  0, 0, 127, 127, 0, 0x000000) == NULL)                     /* record clear */
+        {
+            return 1;                                                                       /* return error */
+        }
+        
+        return 0;                                                                           /* success return 0 */
+    }
+    
+    if (a_ssd1351_set_window(handle, 0, 0, 127, 127, 128 * 128) != 0)                       /* set window */
+    {
+        return 1;                                                                           /* return error */
+    }
+    if (a_ssd1351_buffer_write_pixel(handle, 0x000000, 128 * 128) != 0)                     /* set data */
+    {
+        handle->debug_print("ssd1351: write data failed.\n");                               /* write data failed */
+        
+        return 1;                                                                           /* return error */
+    }
+    
+    if (a_ssd1351_buffer_flush(handle) != 0)                                                /* flush buffer */
+    {
+        handle->debug_print("ssd1351: write data failed.\n");                               /* write data failed */
+        
+        return 1;                                                                           /* return error */
     }
     
     return 0;                                                                               /* success return 0 */
 }
 
 /**
- * @brief     set the display start line
+ * @brief     draw a point in the display
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @param[in] x coordinate x
+ * @param[in] y coordinate y
+ * @param[in] color point color
+ * @return    status code
+ *            - 0 success
+ *            - 1 draw point failed
+ * @note      none
+ */
+static uint8_t a_ssd1351_draw_point(ssd1351_handle_t *handle, uint8_t x, uint8_t y, uint32_t color)
+{
+    if (a_ssd1351_set_window(handle, x, y, 127, 127, 1) != 0)                            /* set window */
+    {
+        return 1;                                                                        /* return error */
+    }
+    if (a_ssd1351_buffer_write_pixel(handle, color, 1) != 0)                             /* set data */
+    {
+        handle->debug_print("ssd1351: write data failed.\n");                            /* write data failed */
+        
+        return 1;                                                                        /* return error */
+    }
+    if ((handle->write_combine == 0) && (a_ssd1351_buffer_flush(handle) != 0))           /* flush buffer */
+    {
+        handle->debug_print("ssd1351: write data failed.\n");                            /* write data failed */
+        
+        return 1;                                                                        /* return error */
+    }
+    
+    return 0;                                                                            /* success return 0 */
+}
+
+/**
+ * @brief     set the address increment used by the following writes
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @param[in] increment address increment
+ * @return    status code
+ *            - 0 success
+ *            - 1 set address increment failed
+ * @note      the command is only sent when the increment changes,
+ *            only the framebuffer cursor increment changes when the framebuffer is enabled
+ */
+static uint8_t a_ssd1351_set_increment(ssd1351_handle_t *handle, uint8_t increment)
+{
+    uint8_t conf;
+    
+    if (handle->fb != NULL)                                                                  /* if framebuffer */
+    {
+        handle->fb_increment = increment;                                                    /* set cursor increment */
+        
+        return 0;                                                                            /* success return 0 */
+    }
+    if ((handle->conf_1 & 0x01) == increment)                                                /* check increment */
+    {
+        return 0;                                                                            /* success return 0 */
+    }
+    conf = (uint8_t)((handle->conf_1 & ~(1 << 0)) | (increment << 0));                       /* get conf */
+    if (a_ssd1351_write_byte(handle, SSD1351_CMD_SET_REMAP_COLOR_DEPTH, SSD1351_CMD) != 0)   /* set address increment */
+    {
+        handle->debug_print("ssd1351: write address increment failed.\n");                   /* write address increment failed */
+        
+        return 1;                                                                            /* return error */
+    }
+    if (a_ssd1351_write_byte(handle, conf, SSD1351_DATA) != 0)                               /* set conf */
+    {
+        handle->debug_print("ssd1351: write address increment failed.\n");                   /* write address increment failed */
+        
+        return 1;                                                                            /* return error */
+    }
+    handle->conf_1 = conf;                                                                   /* set conf */
+    
+    return 0;                                                                                /* success return 0 */
+}
+
+#if (SSD1351_FONT_PACKED != 0)
+
+/**
+ * @brief     get the built-in packed font
+ * @param[in] size display size
+ * @return    pointer to the packed font or NULL if the font is disabled
+ * @note      none
+ */
+static const ssd1351_packed_font_t *a_ssd1351_get_packed_font(uint8_t size)
+{
+#if (SSD1351_FONT_12_ENABLE != 0)
+    if (size == 12)                                                                          /* if size 12 */
+    {
+        return &gsc_ssd1351_packed_1206;                                                     /* get packed 1206 */
+    }
+#endif
+#if (SSD1351_FONT_16_ENABLE != 0)
+    if (size == 16)                                                                          /* if size 16 */
+    {
+        return &gsc_ssd1351_packed_1608;                                                     /* get packed 1608 */
+    }
+#endif
+#if (SSD1351_FONT_24_ENABLE != 0)
+    if (size == 24)                                                                          /* if size 24 */
+    {
+        return &gsc_ssd1351_packed_2412;                                                     /* get packed 2412 */
+    }
+#endif
+    
+    return NULL;                                                                             /* return null */
+}
+
+#endif
+
+/**
+ * @brief     find the glyph index of a char in a packed font
+ * @param[in] *font pointer to a packed font
+ * @param[in] chr display char
+ * @return    glyph index or -1 if the char is not in the font
+ * @note      a subset font is searched in its sorted char map
+ */
+static int32_t a_ssd1351_packed_find(const ssd1351_packed_font_t *font, uint8_t chr)
+{
+    uint16_t l;
+    uint16_t r;
+    uint16_t m;
+    
+    if (font->chars == NULL)                                                                 /* if char range */
+    {
+        if ((chr < font->first) || ((uint16_t)(chr - font->first) >= font->num))             /* check range */
+        {
+            return -1;                                                                       /* return not found */
+        }
+        
+        return chr - font->first;                                                            /* return index */
+    }
+    l = 0;                                                                                   /* init 0 */
+    r = font->num;                                                                           /* init num */
+    while (l < r)                                                                            /* binary search */
+    {
+        m = (l + r) / 2;                                                                     /* get middle */
+        if (font->chars[m] < chr)                                                            /* check char */
+        {
+            l = m + 1;                                                                       /* search right */
+        }
+        else
+        {
+            r = m;                                                                           /* search left */
+        }
+    }
+    if ((l < font->num) && (font->chars[l] == chr))                                          /* check found */
+    {
+        return l;                                                                            /* return index */
+    }
+    
+    return -1;                                                                               /* return not found */
+}
+
+/**
+ * @brief      decode a packed glyph
+ * @param[in]  *font pointer to a packed font
+ * @param[in]  index glyph index
+ * @param[out] *buf pointer to a glyph buffer
+ * @note       the glyph is streamed into the column-major layout of the built-in fonts,
+ *             a glyph is bit-packed when its length is (width * height + 7) / 8 and
+ *             run-length coded otherwise
+ */
+static void a_ssd1351_packed_decode(const ssd1351_packed_font_t *font, uint16_t index, uint8_t *buf)
+{
+    const uint8_t *data;
+    uint8_t bytes = font->height / 8 + ((font->height % 8) ? 1 : 0);                         /* get column bytes */
+    uint8_t column;
+    uint8_t row;
+    uint8_t temp;
+    uint8_t zeros;
+    uint8_t ones;
+    uint8_t t;
+    uint16_t len;
+    uint16_t i;
+    
+    memset(buf, 0, (uint16_t)font->width * bytes);                                           /* clear glyph */
+    data = &font->data[font->index[index]];                                                  /* get data */
+    len = font->index[index + 1] - font->index[index];                                       /* get length */
+    column = 0;                                                                              /* init 0 */
+    row = 0;                                                                                 /* init 0 */
+    if (len == ((uint16_t)font->width * font->height + 7) / 8)                               /* if bit-packed */
+    {
+        for (i = 0; (i < len) && (column < font->width); i++)                                /* all bytes */
+        {
+            temp = data[i];                                                                  /* get bits */
+            for (t = 0; (t < 8) && (column < font->width); t++)                              /* all bits */
+            {
+                if ((temp & 0x80) != 0)                                                      /* if set */
+                {
+                    buf[column * bytes + row / 8] |= 0x80 >> (row % 8);                      /* set pixel */
+                }
+                temp <<= 1;                                                                  /* left shift 1 */
+                row++;                                                                       /* row++ */
+                if (row == font->height)                                                     /* check column end */
+                {
+                    row = 0;                                                                 /* reset row */
+                    column++;                                                                /* column++ */
+                }
+            }
+        }
+        
+        return;                                                                              /* return */
+    }
+    for (i = 0; (i < len) && (column < font->width); i++)                                    /* all runs */
+    {
+        zeros = data[i] >> 4;                                                                /* get clear pixels */
+        ones = data[i] & 0x0F;                                                               /* get set pixels */
+        row += zeros;                                                                        /* skip clear pixels */
+        while (row >= font->height)                                                          /* check column end */
+        {
+            row -= font->height;                                                             /* wrap row */
+            column++;                                                                        /* column++ */
+        }
+        while ((ones != 0) && (column < font->width))                                        /* all set pixels */
+        {
+            buf[column * bytes + row / 8] |= 0x80 >> (row % 8);                              /* set pixel */
+            row++;                                                                           /* row++ */
+            if (row == font->height)                                                         /* check column end */
+            {
+                row = 0;                                                                     /* reset row */
+                column++;                                                                    /* column++ */
+            }
+            ones--;                                                                          /* ones-- */
+        }
+    }
+}
+
+/**
+ * @brief      get the glyph size of a font
+ * @param[in]  size built-in font size
+ * @param[in]  *font pointer to a packed font or NULL for the built-in font
+ * @param[out] *width pointer to a glyph width buffer
+ * @param[out] *height pointer to a glyph height buffer
+ * @note       none
+ */
+static void a_ssd1351_font_size(uint8_t size, const ssd1351_packed_font_t *font, uint8_t *width, uint8_t *height)
+{
+    if (font != NULL)                                                                        /* if packed font */
+    {
+        *width = font->width;                                                                /* set width */
+        *height = font->height;                                                              /* set height */
+    }
+    else
+    {
+        *width = size / 2;                                                                   /* set width */
+        *height = size;                                                                      /* set height */
+    }
+}
+
+/**
+ * @brief     check whether a font has a char
+ * @param[in] chr display char
+ * @param[in] *font pointer to a packed font or NULL for the built-in font
+ * @return    1 if the font has the char, 0 otherwise
+ * @note      the built-in fonts cover ' ' to '~'
+ */
+static uint8_t a_ssd1351_font_has_char(uint8_t chr, const ssd1351_packed_font_t *font)
+{
+    if (font != NULL)                                                                        /* if packed font */
+    {
+        return (a_ssd1351_packed_find(font, chr) >= 0) ? 1 : 0;                              /* find char */
+    }
+    
+    return ((chr <= '~') && (chr >= ' ')) ? 1 : 0;                                           /* check range */
+}
+
+/**
+ * @brief      get the glyph of a char
+ * @param[in]  chr display char
+ * @param[in]  size built-in font size
+ * @param[in]  *font pointer to a packed font or NULL for the built-in font
+ * @param[out] *buf pointer to a glyph buffer used by the packed fonts
+ * @return     pointer to the column-major glyph bits or NULL if the char or the font is invalid
+ * @note       none
+ */
+static const uint8_t *a_ssd1351_get_glyph(uint8_t chr, uint8_t size, const ssd1351_packed_font_t *font, uint8_t *buf)
+{
+    int32_t index;
+    
+    if (font == NULL)                                                                        /* if built-in font */
+    {
+        if ((chr < ' ') || (chr > '~'))                                                      /* check char */
+        {
+            return NULL;                                                                     /* return null */
+        }
+#if (SSD1351_FONT_PACKED != 0)
+        font = a_ssd1351_get_packed_font(size);                                              /* get packed font */
+        if (font == NULL)                                                                    /* check font */
+        {
+            return NULL;                                                                     /* return null */
+        }
+#else
+        (void)buf;                                                                           /* not used */
+#if (SSD1351_FONT_12_ENABLE != 0)
+        if (size == 12)                                                                      /* if size 12 */
+        {
+            return gsc_ssd1351_ascii_1206[chr - ' '];                                        /* get ascii 1206 */
+        }
+#endif
+#if (SSD1351_FONT_16_ENABLE != 0)
+        if (size == 16)                                                                      /* if size 16 */
+        {
+            return gsc_ssd1351_ascii_1608[chr - ' '];                                        /* get ascii 1608 */
+        }
+#endif
+#if (SSD1351_FONT_24_ENABLE != 0)
+        if (size == 24)                                                                      /* if size 24 */
+        {
+            return gsc_ssd1351_ascii_2412[chr - ' '];                                        /* get ascii 2412 */
+        }
+#endif
+        
+        return NULL;                                                                         /* return null */
+#endif
+    }
+    index = a_ssd1351_packed_find(font, chr);                                                /* find glyph */
+    if (index < 0)                                                                           /* check index */
+    {
+        return NULL;                                                                         /* return null */
+    }
+    a_ssd1351_packed_decode(font, (uint16_t)index, buf);                                     /* decode glyph */
+    
+    return buf;                                                                              /* return glyph */
+}
+
+/**
+ * @brief     write packed data bytes to the inner buffer
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @param[in] *data pointer to a data buffer
+ * @param[in] len data length
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      the data goes to the framebuffer when it is enabled
+ */
+static uint8_t a_ssd1351_buffer_write_data(ssd1351_handle_t *handle, const uint8_t *data, uint32_t len)
+{
+    uint32_t i;
+    
+    if (handle->fb != NULL)                                                                  /* if framebuffer */
+    {
+        for (i = 0; i < len; i++)                                                            /* write all bytes */
+        {
+            a_ssd1351_framebuffer_write(handle, data[i]);                                    /* write framebuffer */
+        }
+        
+        return 0;                                                                            /* success return 0 */
+    }
+    
+    return a_ssd1351_buffer_append(handle, data, len);                                       /* append data */
+}
+
+/**
+ * @brief      expand a glyph into packed pixels
+ * @param[in]  *glyph pointer to the column-major glyph bits
+ * @param[in]  width glyph width
+ * @param[in]  height glyph height
+ * @param[in]  *fg pointer to the packed foreground pixel
+ * @param[in]  *bg pointer to the packed background pixel
+ * @param[in]  n packed pixel bytes
+ * @param[out] *buf pointer to a data buffer
+ * @return     packed length
+ * @note       the pixels are in the vertical address increment order
+ */
+static uint16_t a_ssd1351_glyph_render(const uint8_t *glyph, uint8_t width, uint8_t height, 
+                                       const uint8_t *fg, const uint8_t *bg, uint8_t n, uint8_t *buf)
+{
+    uint8_t csize = (height / 8 + ((height % 8) ? 1 : 0)) * width;                           /* get size */
+    uint8_t temp, t, t1;
+    uint8_t row;
+    uint16_t len;
+    
+    len = 0;                                                                                 /* init 0 */
+    row = 0;                                                                                 /* init 0 */
+    for (t = 0; t < csize; t++)                                                              /* write size */
+    {
+        temp = glyph[t];                                                                     /* get bits */
+        for (t1 = 0; t1 < 8; t1++)                                                           /* write one line */
+        {
+            memcpy(&buf[len], ((temp & 0x80) != 0) ? fg : bg, n);                            /* set pixel */
+            len += n;                                                                        /* len += n */
+            temp <<= 1;                                                                      /* left shift 1 */
+            row++;                                                                           /* row++ */
+            if (row == height)                                                               /* check column end */
+            {
+                row = 0;                                                                     /* reset row */
+                
+                break;                                                                       /* break */
+            }
+        }
+    }
+    
+    return len;                                                                              /* return length */
+}
+
+/**
+ * @brief      find a glyph in the glyph cache
+ * @param[in]  *handle pointer to an ssd1351 handle structure
+ * @param[in]  chr display char
+ * @param[in]  size display size
+ * @param[in]  format glyph format
+ * @param[in]  color display color
+ * @param[in]  background background color
+ * @param[out] **data pointer to a slot data pointer buffer
+ * @return     pointer to the glyph entry or NULL if the cache is disabled
+ * @note       a hit has a non-zero length, a miss returns the least recently used entry
+ *             with the new key and zero length so the caller renders it into the slot
+ */
+static ssd1351_glyph_entry_t *a_ssd1351_glyph_cache_find(ssd1351_handle_t *handle, uint8_t chr, uint8_t size, uint8_t format, 
+                                                         uint32_t color, uint32_t background, uint8_t **data)
+{
+    ssd1351_glyph_entry_t *entry;
+    uint16_t victim;
+    uint16_t i;
+    
+    if (handle->glyph_num == 0)                                                              /* check cache */
+    {
+        return NULL;                                                                         /* return null */
+    }
+    handle->glyph_stamp++;                                                                   /* stamp++ */
+    if (handle->glyph_stamp == 0)                                                            /* if wrapped */
+    {
+        for (i = 0; i < handle->glyph_num; i++)                                              /* reset all stamps */
+        {
+            handle->glyph_entry[i].stamp = 0;                                                /* reset stamp */
+        }
+        handle->glyph_stamp = 1;                                                             /* restart */
+    }
+    victim = 0;                                                                              /* init 0 */
+    for (i = 0; i < handle->glyph_num; i++)                                                  /* find the glyph */
+    {
+        entry = &handle->glyph_entry[i];                                                     /* get entry */
+        if ((entry->len != 0) && (entry->chr == chr) && (entry->font == size) && 
+            (entry->format == format) && (entry->color == color) && 
+            (entry->background == background))                                               /* check key */
+        {
+            entry->stamp = handle->glyph_stamp;                                              /* update stamp */
+            *data = &handle->glyph_data[(uint32_t)i * SSD1351_GLYPH_CACHE_SLOT_SIZE];        /* set data */
+            
+            return entry;                                                                    /* return hit */
+        }
+        if (entry->stamp < handle->glyph_entry[victim].stamp)                                /* check least recently used */
+        {
+            victim = i;                                                                      /* set victim */
+        }
+    }
+    entry = &handle->glyph_entry[victim];                                                    /* get victim */
+    entry->len = 0;                                                                          /* flag empty */
+    entry->chr = chr;                                                                        /* set char */
+    entry->font = size;                                                                      /* set font */
+    entry->format = format;                                                                  /* set format */
+    entry->color = color;                                                                    /* set color */
+    entry->background = background;                                                          /* set background */
+    entry->stamp = handle->glyph_stamp;                                                      /* set stamp */
+    *data = &handle->glyph_data[(uint32_t)victim * SSD1351_GLYPH_CACHE_SLOT_SIZE];           /* set data */
+    
+    return entry;                                                                            /* return miss */
+}
+
+/**
+ * @brief      get the horizontal runs of set pixels of a glyph
+ * @param[in]  *glyph pointer to the column-major glyph bits
+ * @param[in]  width glyph width
+ * @param[in]  height glyph height
+ * @param[in]  row first row
+ * @param[in]  end row after the last row
+ * @param[out] *buf pointer to a run buffer
+ * @return     run buffer length
+ * @note       each run is stored as row, column and length bytes
+ */
+static uint16_t a_ssd1351_glyph_runs(const uint8_t *glyph, uint8_t width, uint8_t height, uint8_t row, uint8_t end, 
+                                     uint8_t *buf)
+{
+    uint8_t bytes = height / 8 + ((height % 8) ? 1 : 0);                                     /* get column bytes */
+    uint8_t column;
+    uint8_t start;
+    uint16_t len;
+    
+    len = 0;                                                                                 /* init 0 */
+    for (; row < end; row++)                                                                 /* all rows */
+    {
+        column = 0;                                                                          /* init 0 */
+        while (column < width)                                                               /* all columns */
+        {
+            while ((column < width) && 
+                   ((glyph[column * bytes + row / 8] & (0x80 >> (row % 8))) == 0))           /* skip clear pixels */
+            {
+                column++;                                                                    /* column++ */
+            }
+            start = column;                                                                  /* run start */
+            while ((column < width) && 
+                   ((glyph[column * bytes + row / 8] & (0x80 >> (row % 8))) != 0))           /* find the run end */
+            {
+                column++;                                                                    /* column++ */
+            }
+            if (column != start)                                                             /* if run */
+            {
+                buf[len + 0] = row;                                                          /* set row */
+                buf[len + 1] = start;                                                        /* set column */
+                buf[len + 2] = column - start;                                               /* set length */
+                len += 3;                                                                    /* len += 3 */
+            }
+        }
+    }
+    
+    return len;                                                                              /* return length */
+}
+
+/**
+ * @brief     draw the horizontal runs of a glyph
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @param[in] x coordinate x
+ * @param[in] y coordinate y
+ * @param[in] *runs pointer to a run buffer
+ * @param[in] len run buffer length
+ * @param[in] *data pointer to the packed pixel
+ * @param[in] n packed pixel bytes
+ * @return    status code
+ *            - 0 success
+ *            - 1 draw runs failed
+ * @note      each run is one single row window and one burst,
+ *            while a strip is rendered the runs go into the strip
+ */
+static uint8_t a_ssd1351_draw_runs(ssd1351_handle_t *handle, uint8_t x, uint8_t y, const uint8_t *runs, uint16_t len, 
+                                   const uint8_t *data, uint8_t n)
+{
+    uint16_t i;
+    uint8_t left;
+    uint8_t top;
+    
+    for (i = 0; i < len; i += 3)                                                             /* draw all runs */
+    {
+        left = x + runs[i + 1];                                                              /* get left */
+        top = y + runs[i + 0];                                                               /* get top */
+        if (handle->strip != NULL)                                                           /* if render strip */
+        {
+            a_ssd1351_strip_fill(handle, left, top, left + runs[i + 2] - 1, top, data, n);   /* fill strip */
+            
+            continue;                                                                        /* next run */
+        }
+        if (a_ssd1351_set_window(handle, left, top, left + runs[i + 2] - 1, top, runs[i + 2]) != 0)  /* set window */
+        {
+            return 1;                                                                        /* return error */
+        }
+        if (a_ssd1351_buffer_write_packed(handle, data, n, runs[i + 2]) != 0)                /* write run */
+        {
+            handle->debug_print("ssd1351: write data failed.\n");                            /* write data failed */
+            
+            return 1;                                                                        /* return error */
+        }
+    }
+    
+    return 0;                                                                                /* success return 0 */
+}
+
+/**
+ * @brief     draw a line of opaque chars in one window
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @param[in] x coordinate x
+ * @param[in] y coordinate y
+ * @param[in] *str pointer to the chars
+ * @param[in] num char number
+ * @param[in] size built-in font size
+ * @param[in] *font pointer to a packed font or NULL for the built-in font
+ * @param[in] color display color
+ * @param[in] background background color
+ * @param[in] *fg pointer to the packed foreground pixel
+ * @param[in] *bg pointer to the packed background pixel
+ * @param[in] n packed pixel bytes
+ * @return    status code
+ *            - 0 success
+ *            - 1 show chars failed
+ * @note      the vertical address increment must be set, the glyph bits are column-major
+ *            so a cached glyph is copied as it is and an uncached glyph is streamed
+ *            in runs of equal pixels straight from the font
+ */
+static uint8_t a_ssd1351_show_chars_opaque(ssd1351_handle_t *handle, uint8_t x, uint8_t y, const char *str, uint8_t num, 
+                                           uint8_t size, const ssd1351_packed_font_t *font, 
+                                           uint32_t color, uint32_t background, 
+                                           const uint8_t *fg, const uint8_t *bg, uint8_t n)
+{
+    ssd1351_glyph_entry_t *entry;
+    const uint8_t *glyph;
+    uint8_t *cache;
+    uint8_t buf[SSD1351_GLYPH_MAX_SIZE * SSD1351_GLYPH_MAX_SIZE / 8];
+    uint8_t width;
+    uint8_t height;
+    uint8_t csize;
+    uint8_t temp, t, t1, i;
+    uint8_t row;
+    uint8_t bit;
+    uint8_t last;
+    uint32_t run;
+    
+    a_ssd1351_font_size(size, font, &width, &height);                                        /* get glyph size */
+    csize = (height / 8 + ((height % 8) ? 1 : 0)) * width;                                   /* get size */
+    if (a_ssd1351_set_window(handle, x, y, x + num * width - 1, y + height - 1, 
+                             (uint32_t)num * width * height) != 0)                           /* set window */
+    {
+        return 1;                                                                            /* return error */
+    }
+    for (i = 0; i < num; i++)                                                                /* write all chars */
+    {
+        glyph = a_ssd1351_get_glyph(str[i], size, font, buf);                                /* get glyph */
+        if (glyph == NULL)                                                                   /* check glyph */
+        {
+            return 1;                                                                        /* return error */
+        }
+        entry = NULL;                                                                        /* init null */
+        if ((font == NULL) && ((uint32_t)width * height * n <= SSD1351_GLYPH_CACHE_SLOT_SIZE))   /* check built-in font and slot size */
+        {
+            entry = a_ssd1351_glyph_cache_find(handle, str[i], size, 
+                                               SSD1351_CONF_DEPTH(handle) | SSD1351_CONF_SEQUENCE(handle), 
+                                               color, background, &cache);                   /* find glyph */
+        }
+        if (entry != NULL)                                                                   /* if cached */
+        {
+            if (entry->len == 0)                                                             /* if miss */
+            {
+                entry->len = a_ssd1351_glyph_render(glyph, width, height, fg, bg, n, cache); /* render glyph */
+            }
+            if (a_ssd1351_buffer_write_data(handle, cache, entry->len) != 0)                 /* write glyph */
+            {
+                handle->debug_print("ssd1351: write data failed.\n");                        /* write data failed */
+                
+                return 1;                                                                    /* return error */
+            }
+            
+            continue;                                                                        /* next char */
+        }
+        last = 0;                                                                            /* init 0 */
+        run = 0;                                                                             /* init 0 */
+        row = 0;                                                                             /* init 0 */
+        for (t = 0; t < csize; t++)                                                          /* write size */
+        {
+            temp = glyph[t];                                                                 /* get bits */
+            for (t1 = 0; t1 < 8; t1++)                                                       /* write one line */
+            {
+                bit = (temp >> 7) & 0x01;                                                    /* get bit */
+                temp <<= 1;                                                                  /* left shift 1 */
+                if ((bit != last) && (run != 0))                                             /* check run end */
+                {
+                    if (a_ssd1351_buffer_write_packed(handle, (last != 0) ? fg : bg, n, run) != 0)   /* write run */
+                    {
+                        handle->debug_print("ssd1351: write data failed.\n");                /* write data failed */
+                        
+                        return 1;                                                            /* return error */
+                    }
+                    run = 0;                                                                 /* reset run */
+                }
+                last = bit;                                                                  /* save bit */
+                run++;                                                                       /* run++ */
+                row++;                                                                       /* row++ */
+                if (row == height)                                                           /* check column end */
+                {
+                    row = 0;                                                                 /* reset row */
+                    
+                    break;                                                                   /* break */
+                }
+            }
+        }
+        if (a_ssd1351_buffer_write_packed(handle, (last != 0) ? fg : bg, n, run) != 0)       /* write the last run */
+        {
+            handle->debug_print("ssd1351: write data failed.\n");                            /* write data failed */
+            
+            return 1;                                                                        /* return error */
+        }
+    }
+    
+    return 0;                                                                                /* success return 0 */
+}
+
+/**
+ * @brief     draw a char in the display
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @param[in] x coordinate x
+ * @param[in] y coordinate y
+ * @param[in] chr display char
+ * @param[in] size built-in font size
+ * @param[in] *font pointer to a packed font or NULL for the built-in font
+ * @param[in] color display color
+ * @return    status code
+ *            - 0 success
+ *            - 1 show char failed
+ * @note      the set pixels are drawn as horizontal runs, the runs of a built-in
+ *            glyph are kept in the glyph cache when it is enabled
+ */
+static uint8_t a_ssd1351_show_char(ssd1351_handle_t *handle, uint8_t x, uint8_t y, uint8_t chr, uint8_t size, 
+                                   const ssd1351_packed_font_t *font, uint32_t color)
+{
+    ssd1351_glyph_entry_t *entry;
+    const uint8_t *glyph;
+    uint8_t *runs;
+    uint8_t buf[SSD1351_GLYPH_MAX_SIZE * SSD1351_GLYPH_MAX_SIZE / 8];
+    uint8_t row_runs[(SSD1351_GLYPH_MAX_SIZE + 1) / 2 * 3];
+    uint8_t data[3];
+    uint8_t n;
+    uint8_t row;
+    uint8_t width;
+    uint8_t height;
+    uint16_t len;
+    
+    glyph = a_ssd1351_get_glyph(chr, size, font, buf);                                       /* get glyph */
+    if (glyph == NULL)                                                                       /* check glyph */
+    {
+        return 1;                                                                            /* return error */
+    }
+    a_ssd1351_font_size(size, font, &width, &height);                                        /* get glyph size */
+    n = a_ssd1351_pack_pixel(handle, color, data);                                           /* pack pixel */
+    entry = NULL;                                                                            /* init null */
+    if ((font == NULL) && 
+        (1 + (uint32_t)height * ((width + 1) / 2) * 3 <= SSD1351_GLYPH_CACHE_SLOT_SIZE))     /* check built-in font and slot size */
+    {
+        entry = a_ssd1351_glyph_cache_find(handle, chr, size, SSD1351_GLYPH_FORMAT_RUNS, 
+                                           0, 0, &runs);                                     /* find runs */
+    }
+    if (entry != NULL)                                                                       /* if cached */
+    {
+        if (entry->len == 0)                                                                 /* if miss */
+        {
+            runs[0] = 0;                                                                     /* reserved */
+            entry->len = 1 + a_ssd1351_glyph_runs(glyph, width, height, 0, height, &runs[1]);    /* get runs */
+        }
+        
+        return a_ssd1351_draw_runs(handle, x, y, &runs[1], entry->len - 1, data, n);         /* draw runs */
+    }
+    for (row = 0; row < height; row++)                                                       /* all rows */
+    {
+        len = a_ssd1351_glyph_runs(glyph, width, height, row, row + 1, row_runs);            /* get row runs */
+        if (a_ssd1351_draw_runs(handle, x, y, row_runs, len, data, n) != 0)                  /* draw runs */
+        {
+            return 1;                                                                        /* return error */
+        }
+    }
+    
+    return 0;                                                                                /* success return 0 */
+}
+
+/**
+ * @brief     write a string
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @param[in] x coordinate x
+ * @param[in] y coordinate y
+ * @param[in] *str pointer to a written string address
+ * @param[in] len length of the string
+ * @param[in] color display color
+ * @param[in] size built-in font size
+ * @param[in] *font pointer to a packed font or NULL for the built-in font
+ * @return    status code
+ *            - 0 success
+ *            - 1 write string failed
+ * @note      the string stops at the first char that is not in the font
+ */
+static uint8_t a_ssd1351_write_string(ssd1351_handle_t *handle, uint8_t x, uint8_t y, const char *str, uint16_t len, 
+                                      uint32_t color, uint8_t size, const ssd1351_packed_font_t *font)
+{
+    uint8_t width;
+    uint8_t height;
+    
+    a_ssd1351_font_size(size, font, &width, &height);                                  /* get glyph size */
+    while ((len != 0) && (a_ssd1351_font_has_char((uint8_t)*str, font) != 0))         /* write all string */
+    {       
+        if (x > (127 - width))                                                         /* check x point */
+        {
+            x = 0;                                                                     /* set x */
+            y += height;                                                               /* set next row */
+        }
+        if (y > (127 - height))                                                        /* check y pont */
+        {
+            y = x = 0;                                                                 /* reset to 0 */
+        }
+        if (a_ssd1351_show_char(handle, x, y, (uint8_t)*str, size, font, color) != 0)  /* show a char */
+        {
+            return 1;                                                                  /* return error */
+        }
+        x += width;                                                                    /* x + width */
+        str++;                                                                         /* str address++ */
+        len--;                                                                         /* str length-- */
+    }
+    if ((handle->write_combine == 0) && (a_ssd1351_buffer_flush(handle) != 0))         /* flush buffer */
+    {
+        handle->debug_print("ssd1351: write data failed.\n");                          /* write data failed */
+        
+        return 1;                                                                      /* return error */
+    }
+    
+    return 0;                                                                          /* success return 0 */
+}
+
+/**
+ * @brief     write an opaque string
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @param[in] x coordinate x
+ * @param[in] y coordinate y
+ * @param[in] *str pointer to a written string address
+ * @param[in] len length of the string
+ * @param[in] color display color
+ * @param[in] background background color
+ * @param[in] size built-in font size
+ * @param[in] *font pointer to a packed font or NULL for the built-in font
+ * @return    status code
+ *            - 0 success
+ *            - 1 write string failed
+ * @note      each line is sent as one burst with the vertical address increment and
+ *            the address increment is restored at the end
+ */
+static uint8_t a_ssd1351_write_string_opaque(ssd1351_handle_t *handle, uint8_t x, uint8_t y, const char *str, uint16_t len, 
+                                             uint32_t color, uint32_t background, uint8_t size, 
+                                             const ssd1351_packed_font_t *font)
+{
+    uint8_t fg[3];
+    uint8_t bg[3];
+    uint8_t n;
+    uint8_t num;
+    uint8_t res;
+    uint8_t increment;
+    uint8_t width;
+    uint8_t height;
+    
+    a_ssd1351_font_size(size, font, &width, &height);                              /* get glyph size */
+    n = a_ssd1351_pack_pixel(handle, color, fg);                                   /* pack foreground */
+    (void)a_ssd1351_pack_pixel(handle, background, bg);                            /* pack background */
+    increment = a_ssd1351_get_increment(handle);                                   /* save address increment */
+    if (a_ssd1351_set_increment(handle, SSD1351_ADDRESS_INCREMENT_VERTICAL) != 0)  /* set vertical increment */
+    {
+        return 1;                                                                  /* return error */
+    }
+    res = 0;                                                                       /* init 0 */
+    while ((len != 0) && (a_ssd1351_font_has_char((uint8_t)*str, font) != 0))     /* write all string */
+    {
+        if (x > (127 - width))                                                     /* check x point */
+        {
+            x = 0;                                                                 /* set x */
+            y += height;                                                           /* set next row */
+        }
+        if (y > (127 - height))                                                    /* check y pont */
+        {
+            y = x = 0;                                                             /* reset to 0 */
+        }
+        num = 1;                                                                   /* the first char fits */
+        while ((num < len) && (a_ssd1351_font_has_char((uint8_t)str[num], font) != 0) && 
+               ((uint16_t)x + (uint16_t)(num + 1) * width <= 127))                 /* get the chars of this line */
+        {
+            num++;                                                                 /* num++ */
+        }
+        if (a_ssd1351_show_chars_opaque(handle, x, y, str, num, size, font, 
+                                        color, background, fg, bg, n) != 0)        /* show the chars */
+        {
+            res = 1;                                                               /* set error */
+            
+            break;                                                                 /* break */
+        }
+        x += (uint8_t)(num * width);                                               /* x + num * width */
+        str += num;                                                                /* str address += num */
+        len -= num;                                                                /* str length -= num */
+    }
+    if ((res == 0) && (a_ssd1351_buffer_flush(handle) != 0))                       /* flush buffer */
+    {
+        handle->debug_print("ssd1351: write data failed.\n");                      /* write data failed */
+        
+        res = 1;                                                                   /* set error */
+    }
+    if (a_ssd1351_set_increment(handle, increment) != 0)                           /* restore address increment */
+    {
+        return 1;                                                                  /* return error */
+    }
+    
+    return res;                                                                    /* return the result */
+}
+
+/**
+ * @brief     check a packed font
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @param[in] *font pointer to a packed font
+ * @return    status code
+ *            - 0 success
+ *            - 1 font is invalid
+ * @note      none
+ */
+static uint8_t a_ssd1351_check_packed_font(ssd1351_handle_t *handle, const ssd1351_packed_font_t *font)
+{
+    if ((font == NULL) || (font->index == NULL) || (font->data == NULL) || (font->num == 0) || 
+        (font->width == 0) || (font->width > SSD1351_GLYPH_MAX_SIZE) || 
+        (font->height == 0) || (font->height > SSD1351_GLYPH_MAX_SIZE))              /* check font */
+    {
+        handle->debug_print("ssd1351: font is invalid.\n");                          /* font is invalid */
+        
+        return 1;                                                                    /* return error */
+    }
+    
+    return 0;                                                                        /* success return 0 */
+}
+
+/**
+ * @brief     fill the rect
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @param[in] left left coordinate x
+ * @param[in] top top coordinate y
+ * @param[in] right right coordinate x
+ * @param[in] bottom bottom coordinate y
+ * @param[in] color display color
+ * @return    status code
+ *            - 0 success
+ *            - 1 fill rect failed
+ * @note      none
+ */
+static uint8_t a_ssd1351_fill_rect(ssd1351_handle_t *handle, uint8_t left, uint8_t top, uint8_t right, uint8_t bottom, uint32_t color)
+{
+    uint32_t total;
+    
+    total = (uint32_t)(right - left + 1) * (bottom - top + 1);                                   /* get total */
+    if (a_ssd1351_set_window(handle, left, top, right, bottom, total) != 0)                      /* set window */
+    {
+        return 1;                                                                                /* return error */
+    }
+    if (a_ssd1351_buffer_write_pixel(handle, color, total) != 0)                                 /* set data */
+    {
+        handle->debug_print("ssd1351: write data failed.\n");                                    /* write data failed */
+        
+        return 1;                                                                                /* return error */
+    }
+    if (a_ssd1351_buffer_flush(handle) != 0)                                                     /* flush buffer */
+    {
+        handle->debug_print("ssd1351: write data failed.\n");                                    /* write data failed */
+        
+        return 1;                                                                                /* return error */
+    }
+    
+    return 0;                                                                                    /* success return 0 */
+}
+
+/**
+ * @brief     fill a block clipped to the display
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @param[in] left left coordinate x
+ * @param[in] top top coordinate y
+ * @param[in] right right coordinate x
+ * @param[in] bottom bottom coordinate y
+ * @param[in] color display color
+ * @return    status code
+ *            - 0 success
+ *            - 1 fill block failed
+ * @note      the block is sent as one window and burst and is not flushed,
+ *            while a strip is rendered the block goes into the strip
+ */
+static uint8_t a_ssd1351_draw_block(ssd1351_handle_t *handle, int16_t left, int16_t top, int16_t right, int16_t bottom, uint32_t color)
+{
+    uint32_t total;
+    uint8_t data[3];
+    uint8_t n;
+    uint8_t res;
+    
+    if (left < 0)                                                                                /* check left */
+    {
+        left = 0;                                                                                /* clip left */
+    }
+    if (top < 0)                                                                                 /* check top */
+    {
+        top = 0;                                                                                 /* clip top */
+    }
+    if (right > 127)                                                                             /* check right */
+    {
+        right = 127;                                                                             /* clip right */
+    }
+    if (bottom > 127)                                                                            /* check bottom */
+    {
+        bottom = 127;                                                                            /* clip bottom */
+    }
+    if ((left > right) || (top > bottom))                                                        /* check clipped */
+    {
+        return 0;                                                                                /* success return 0 */
+    }
+    if (handle->strip != NULL)                                                                   /* if render strip */
+    {
+        n = a_ssd1351_pack_pixel(handle, color, data);                                           /* pack pixel */
+        a_ssd1351_strip_fill(handle, left, top, right, bottom, data, n);                         /* fill strip */
+        
+        return 0;                                                                                /* success return 0 */
+    }
+    total = (uint32_t)(right - left + 1) * (uint32_t)(bottom - top + 1);                         /* get total */
+    if (total == 1)                                                                              /* if single pixel */
+    {
+        res = a_ssd1351_set_window(handle, (uint8_t)left, (uint8_t)top, 127, 127, 1);            /* set window like a point */
+    }
+    else
+    {
+        res = a_ssd1351_set_window(handle, (uint8_t)left, (uint8_t)top, 
+                                   (uint8_t)right, (uint8_t)bottom, total);                      /* set window */
+    }
+    if (res != 0)                                                                                /* check result */
+    {
+        return 1;                                                                                /* return error */
+    }
+    if (a_ssd1351_buffer_write_pixel(handle, color, total) != 0)                                 /* set data */
+    {
+        handle->debug_print("ssd1351: write data failed.\n");                                    /* write data failed */
+        
+        return 1;                                                                                /* return error */
+    }
+    
+    return 0;                                                                                    /* success return 0 */
+}
+
+/**
+ * @brief     draw a horizontal or vertical span
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @param[in] x coordinate x of the first pixel
+ * @param[in] y coordinate y of the first pixel
+ * @param[in] len span length
+ * @param[in] vertical 0 for a horizontal span, 1 for a vertical span
+ * @param[in] *arc pointer to an arc structure or NULL
+ * @param[in] color display color
+ * @return    status code
+ *            - 0 success
+ *            - 1 draw span failed
+ * @note      with an arc only the runs inside the arc angles are drawn
+ */
+static uint8_t a_ssd1351_draw_span(ssd1351_handle_t *handle, int16_t x, int16_t y, int16_t len, uint8_t vertical, 
+                                   const ssd1351_arc_t *arc, uint32_t color)
+{
+    int16_t i;
+    int16_t start;
+    int32_t dx;
+    int32_t dy;
+    uint8_t in;
+    
+    if (arc == NULL)                                                                             /* if no arc */
+    {
+        if (vertical != 0)                                                                       /* if vertical */
+        {
+            return a_ssd1351_draw_block(handle, x, y, x, (int16_t)(y + len - 1), color);         /* draw block */
+        }
+        
+        return a_ssd1351_draw_block(handle, x, y, (int16_t)(x + len - 1), y, color);             /* draw block */
+    }
+    start = -1;                                                                                  /* no run */
+    for (i = 0; i <= len; i++)                                                                   /* loop all pixels */
+    {
+        in = 0;                                                                                  /* init 0 */
+        if (i < len)                                                                             /* check end */
+        {
+            dx = (vertical != 0) ? (x - arc->x) : (x + i - arc->x);                              /* get dx */
+            dy = (vertical != 0) ? (y + i - arc->y) : (y - arc->y);                              /* get dy */
+            if (arc->sweep >= 360)                                                               /* if full circle */
+            {
+                in = 1;                                                                          /* inside */
+            }
+            else if (arc->sweep <= 180)                                                          /* if not more than half */
+            {
+                in = (uint8_t)((arc->start_x * dy - arc->start_y * dx >= 0) && 
+                               (dx * arc->end_y - dy * arc->end_x >= 0));                        /* between start and end */
+            }
+            else
+            {
+                in = (uint8_t)(!((arc->end_x * dy - arc->end_y * dx > 0) && 
+                                 (dx * arc->start_y - dy * arc->start_x > 0)));                  /* not between end and start */
+            }
+        }
+        if ((in != 0) && (start < 0))                                                            /* if run starts */
+        {
+            start = i;                                                                           /* set start */
+        }
+        if ((in == 0) && (start >= 0))                                                           /* if run ends */
+        {
+            if (a_ssd1351_draw_span(handle, (int16_t)((vertical != 0) ? x : x + start), 
+                                    (int16_t)((vertical != 0) ? y + start : y), 
+                                    (int16_t)(i - start), vertical, NULL, color) != 0)           /* draw run */
+            {
+                return 1;                                                                        /* return error */
+            }
+            start = -1;                                                                          /* no run */
+        }
+    }
+    
+    return 0;                                                                                    /* success return 0 */
+}
+
+/**
+ * @brief     get the sine of an angle
+ * @param[in] angle angle in degrees
+ * @return    sine scaled by 1024
+ * @note      none
+ */
+static int32_t a_ssd1351_sin(uint16_t angle)
+{
+    angle = angle % 360;                                                     /* wrap angle */
+    if (angle <= 90)                                                         /* 0 - 90 */
+    {
+        return gsc_ssd1351_sin[angle];                                       /* return sine */
+    }
+    else if (angle <= 180)                                                   /* 90 - 180 */
+    {
+        return gsc_ssd1351_sin[180 - angle];                                 /* return sine */
+    }
+    else if (angle <= 270)                                                   /* 180 - 270 */
+    {
+        return -(int32_t)gsc_ssd1351_sin[angle - 180];                       /* return sine */
+    }
+    else                                                                     /* 270 - 360 */
+    {
+        return -(int32_t)gsc_ssd1351_sin[360 - angle];                       /* return sine */
+    }
+}
+
+/**
+ * @brief     draw the outline of a circle or a rounded rect
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @param[in] x center x of the top left quarter
+ * @param[in] y center y of the top left quarter
+ * @param[in] r radius
+ * @param[in] w distance of the right quarters
+ * @param[in] h distance of the bottom quarters
+ * @param[in] *arc pointer to an arc structure or NULL
+ * @param[in] color display color
+ * @return    status code
+ *            - 0 success
+ *            - 1 draw failed
+ * @note      every octant run of the midpoint circle is one span,
+ *            the straight edges join the first runs of the quarters
+ */
+static uint8_t a_ssd1351_draw_round(ssd1351_handle_t *handle, int16_t x, int16_t y, int16_t r, int16_t w, int16_t h, 
+                                    const ssd1351_arc_t *arc, uint32_t color)
+{
+    int16_t i;
+    int16_t j;
+    int16_t s;
+    int16_t next;
+    int16_t d;
+    int16_t n;
+    uint8_t res;
+    
+    i = 0;                                                                                       /* init 0 */
+    j = r;                                                                                       /* init r */
+    d = (int16_t)(1 - r);                                                                        /* init decision */
+    s = 0;                                                                                       /* run start */
+    while (i <= j)                                                                               /* loop the octant */
+    {
+        next = j;                                                                                /* keep y */
+        if (d < 0)                                                                               /* if keep y */
+        {
+            d = (int16_t)(d + 2 * i + 3);                                                        /* update decision */
+        }
+        else
+        {
+            d = (int16_t)(d + 2 * (i - j) + 5);                                                  /* update decision */
+            next--;                                                                              /* y-- */
+        }
+        if ((next != j) || (i + 1 > next))                                                       /* if run ends */
+        {
+            n = (int16_t)(i - s + 1);                                                            /* get run length */
+            if (s == 0)                                                                          /* if joined with the edges */
+            {
+                res = a_ssd1351_draw_span(handle, (int16_t)(x - i), (int16_t)(y - j), 
+                                          (int16_t)(w + 2 * i + 1), 0, arc, color);              /* top */
+                res |= a_ssd1351_draw_span(handle, (int16_t)(x - i), (int16_t)(y + h + j), 
+                                           (int16_t)(w + 2 * i + 1), 0, arc, color);             /* bottom */
+                res |= a_ssd1351_draw_span(handle, (int16_t)(x - j), (int16_t)(y - i), 
+                                           (int16_t)(h + 2 * i + 1), 1, arc, color);             /* left */
+                res |= a_ssd1351_draw_span(handle, (int16_t)(x + w + j), (int16_t)(y - i), 
+                                           (int16_t)(h + 2 * i + 1), 1, arc, color);             /* right */
+            }
+            else
+            {
+                res = a_ssd1351_draw_span(handle, (int16_t)(x + w + s), (int16_t)(y - j), n, 0, arc, color);      /* top right */
+                res |= a_ssd1351_draw_span(handle, (int16_t)(x - i), (int16_t)(y - j), n, 0, arc, color);         /* top left */
+                res |= a_ssd1351_draw_span(handle, (int16_t)(x + w + s), (int16_t)(y + h + j), n, 0, arc, color); /* bottom right */
+                res |= a_ssd1351_draw_span(handle, (int16_t)(x - i), (int16_t)(y + h + j), n, 0, arc, color);     /* bottom left */
+                res |= a_ssd1351_draw_span(handle, (int16_t)(x + w + j), (int16_t)(y + h + s), n, 1, arc, color); /* right bottom */
+                res |= a_ssd1351_draw_span(handle, (int16_t)(x - j), (int16_t)(y + h + s), n, 1, arc, color);     /* left bottom */
+                res |= a_ssd1351_draw_span(handle, (int16_t)(x + w + j), (int16_t)(y - i), n, 1, arc, color);     /* right top */
+                res |= a_ssd1351_draw_span(handle, (int16_t)(x - j), (int16_t)(y - i), n, 1, arc, color);         /* left top */
+            }
+            if (res != 0)                                                                        /* check result */
+            {
+                return 1;                                                                        /* return error */
+            }
+            s = (int16_t)(i + 1);                                                                /* next run start */
+        }
+        j = next;                                                                                /* set y */
+        i++;                                                                                     /* x++ */
+    }
+    
+    return 0;                                                                                    /* success return 0 */
+}
+
+/**
+ * @brief     fill a circle or a rounded rect
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @param[in] x center x of the top left quarter
+ * @param[in] y center y of the top left quarter
+ * @param[in] r radius
+ * @param[in] w distance of the right quarters
+ * @param[in] h distance of the bottom quarters
+ * @param[in] color display color
+ * @return    status code
+ *            - 0 success
+ *            - 1 fill failed
+ * @note      the middle band is one block and every other row is one span
+ */
+static uint8_t a_ssd1351_fill_round(ssd1351_handle_t *handle, int16_t x, int16_t y, int16_t r, int16_t w, int16_t h, 
+                                    uint32_t color)
+{
+    int16_t i;
+    int16_t j;
+    int16_t next;
+    int16_t d;
+    
+    if (a_ssd1351_draw_block(handle, (int16_t)(x - r), y, (int16_t)(x + w + r), 
+                             (int16_t)(y + h), color) != 0)                                      /* fill the middle band */
+    {
+        return 1;                                                                                /* return error */
+    }
+    i = 0;                                                                                       /* init 0 */
+    j = r;                                                                                       /* init r */
+    d = (int16_t)(1 - r);                                                                        /* init decision */
+    while (i <= j)                                                                               /* loop the octant */
+    {
+        if (i != 0)                                                                              /* check row */
+        {
+            if ((a_ssd1351_draw_block(handle, (int16_t)(x - j), (int16_t)(y - i), 
+                                      (int16_t)(x + w + j), (int16_t)(y - i), color) != 0) || 
+                (a_ssd1351_draw_block(handle, (int16_t)(x - j), (int16_t)(y + h + i), 
+                                      (int16_t)(x + w + j), (int16_t)(y + h + i), color) != 0))  /* fill the rows of x */
+            {
+                return 1;                                                                        /* return error */
+            }
+        }
+        next = j;                                                                                /* keep y */
+        if (d < 0)                                                                               /* if keep y */
+        {
+            d = (int16_t)(d + 2 * i + 3);                                                        /* update decision */
+        }
+        else
+        {
+            d = (int16_t)(d + 2 * (i - j) + 5);                                                  /* update decision */
+            next--;                                                                              /* y-- */
+        }
+        if (((next != j) || (i + 1 > next)) && (j != i))                                         /* if the widest run of y */
+        {
+            if ((a_ssd1351_draw_block(handle, (int16_t)(x - i), (int16_t)(y - j), 
+                                      (int16_t)(x + w + i), (int16_t)(y - j), color) != 0) || 
+                (a_ssd1351_draw_block(handle, (int16_t)(x - i), (int16_t)(y + h + j), 
+                                      (int16_t)(x + w + i), (int16_t)(y + h + j), color) != 0))  /* fill the rows of y */
+            {
+                return 1;                                                                        /* return error */
+            }
+        }
+        j = next;                                                                                /* set y */
+        i++;                                                                                     /* x++ */
+    }
+    
+    return 0;                                                                                    /* success return 0 */
+}
+
+/**
+ * @brief     draw a line
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @param[in] x0 coordinate x of the first point
+ * @param[in] y0 coordinate y of the first point
+ * @param[in] x1 coordinate x of the second point
+ * @param[in] y1 coordinate y of the second point
+ * @param[in] color display color
+ * @return    status code
+ *            - 0 success
+ *            - 1 draw line failed
+ * @note      the bresenham pixels of one row or column are sent as one span
+ */
+static uint8_t a_ssd1351_draw_line(ssd1351_handle_t *handle, int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint32_t color)
+{
+    int16_t dx;
+    int16_t dy;
+    int16_t sx;
+    int16_t sy;
+    int16_t err;
+    int16_t e2;
+    int16_t rx;
+    int16_t ry;
+    int16_t n;
+    uint8_t steep;
+    
+    dx = (int16_t)((x1 > x0) ? (x1 - x0) : (x0 - x1));                                           /* get dx */
+    dy = (int16_t)((y1 > y0) ? (y0 - y1) : (y1 - y0));                                           /* get -dy */
+    sx = (int16_t)((x0 < x1) ? 1 : -1);                                                          /* x step */
+    sy = (int16_t)((y0 < y1) ? 1 : -1);                                                          /* y step */
+    steep = (uint8_t)(-dy > dx);                                                                 /* check the major axis */
+    err = (int16_t)(dx + dy);                                                                    /* init error */
+    rx = x0;                                                                                     /* run start x */
+    ry = y0;                                                                                     /* run start y */
+    n = 0;                                                                                       /* run length */
+    while (1)                                                                                    /* loop all pixels */
+    {
+        if (((steep == 0) && (y0 != ry)) || ((steep != 0) && (x0 != rx)))                        /* if the run ends */
+        {
+            if (a_ssd1351_draw_span(handle, (int16_t)((sx < 0) && (steep == 0) ? rx - n + 1 : rx), 
+                                    (int16_t)((sy < 0) && (steep != 0) ? ry - n + 1 : ry), 
+                                    n, steep, NULL, color) != 0)                                 /* draw run */
+            {
+                return 1;                                                                        /* return error */
+            }
+            rx = x0;                                                                             /* next run x */
+            ry = y0;                                                                             /* next run y */
+            n = 0;                                                                               /* reset length */
+        }
+        n++;                                                                                     /* length++ */
+        if ((x0 == x1) && (y0 == y1))                                                            /* check end */
+        {
+            break;                                                                               /* break */
+        }
+        e2 = (int16_t)(2 * err);                                                                 /* get 2 * error */
+        if (e2 >= dy)                                                                            /* x step */
+        {
+            err = (int16_t)(err + dy);                                                           /* update error */
+            x0 = (int16_t)(x0 + sx);                                                             /* x += sx */
+        }
+        if (e2 <= dx)                                                                            /* y step */
+        {
+            err = (int16_t)(err + dx);                                                           /* update error */
+            y0 = (int16_t)(y0 + sy);                                                             /* y += sy */
+        }
+    }
+    
+    return a_ssd1351_draw_span(handle, (int16_t)((sx < 0) && (steep == 0) ? rx - n + 1 : rx), 
+                               (int16_t)((sy < 0) && (steep != 0) ? ry - n + 1 : ry), 
+                               n, steep, NULL, color);                                           /* draw the last run */
+}
+
+/**
+ * @brief     fill a triangle
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @param[in] x0 coordinate x of the first point
+ * @param[in] y0 coordinate y of the first point
+ * @param[in] x1 coordinate x of the second point
+ * @param[in] y1 coordinate y of the second point
+ * @param[in] x2 coordinate x of the third point
+ * @param[in] y2 coordinate y of the third point
+ * @param[in] color display color
+ * @return    status code
+ *            - 0 success
+ *            - 1 fill triangle failed
+ * @note      every row is one span
+ */
+static uint8_t a_ssd1351_fill_triangle(ssd1351_handle_t *handle, int16_t x0, int16_t y0, int16_t x1, int16_t y1, 
+                                       int16_t x2, int16_t y2, uint32_t color)
+{
+    int16_t t;
+    int16_t a;
+    int16_t b;
+    int16_t y;
+    int16_t last;
+    int32_t sa;
+    int32_t sb;
+    
+    if (y0 > y1)                                                                                 /* sort by y */
+    {
+        t = y0; y0 = y1; y1 = t;                                                                 /* swap y */
+        t = x0; x0 = x1; x1 = t;                                                                 /* swap x */
+    }
+    if (y1 > y2)                                                                                 /* sort by y */
+    {
+        t = y1; y1 = y2; y2 = t;                                                                 /* swap y */
+        t = x1; x1 = x2; x2 = t;                                                                 /* swap x */
+    }
+    if (y0 > y1)                                                                                 /* sort by y */
+    {
+        t = y0; y0 = y1; y1 = t;                                                                 /* swap y */
+        t = x0; x0 = x1; x1 = t;                                                                 /* swap x */
+    }
+    if (y0 == y2)                                                                                /* if one row */
+    {
+        a = b = x0;                                                                              /* init x0 */
+        a = (x1 < a) ? x1 : a;                                                                   /* min */
+        a = (x2 < a) ? x2 : a;                                                                   /* min */
+        b = (x1 > b) ? x1 : b;                                                                   /* max */
+        b = (x2 > b) ? x2 : b;                                                                   /* max */
+        
+        return a_ssd1351_draw_block(handle, a, y0, b, y0, color);                                /* draw the row */
+    }
+    last = (y1 == y2) ? y1 : (int16_t)(y1 - 1);                                                  /* last row of the upper part */
+    sa = 0;                                                                                      /* init 0 */
+    sb = 0;                                                                                      /* init 0 */
+    for (y = y0; y <= last; y++)                                                                 /* upper part */
+    {
+        a = (int16_t)(x0 + sa / (y1 - y0));                                                      /* edge 0 - 1 */
+        b = (int16_t)(x0 + sb / (y2 - y0));                                                      /* edge 0 - 2 */
+        sa += x1 - x0;                                                                           /* step */
+        sb += x2 - x0;                                                                           /* step */
+        if (a > b)                                                                               /* check order */
+        {
+            t = a; a = b; b = t;                                                                 /* swap */
+        }
+        if (a_ssd1351_draw_block(handle, a, y, b, y, color) != 0)                                /* draw the row */
+        {
+            return 1;                                                                            /* return error */
+        }
+    }
+    sa = (int32_t)(x2 - x1) * (y - y1);                                                          /* init edge 1 - 2 */
+    sb = (int32_t)(x2 - x0) * (y - y0);                                                          /* init edge 0 - 2 */
+    for (; y <= y2; y++)                                                                         /* lower part */
+    {
+        a = (int16_t)(x1 + sa / (y2 - y1));                                                      /* edge 1 - 2 */
+        b = (int16_t)(x0 + sb / (y2 - y0));                                                      /* edge 0 - 2 */
+        sa += x2 - x1;                                                                           /* step */
+        sb += x2 - x0;                                                                           /* step */
+        if (a > b)                                                                               /* check order */
+        {
+            t = a; a = b; b = t;                                                                 /* swap */
+        }
+        if (a_ssd1351_draw_block(handle, a, y, b, y, color) != 0)                                /* draw the row */
+        {
+            return 1;                                                                            /* return error */
+        }
+    }
+    
+    return 0;                                                                                    /* success return 0 */
+}
+
+/**
+ * @brief     draw an arc
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @param[in] x center coordinate x
+ * @param[in] y center coordinate y
+ * @param[in] r radius
+ * @param[in] start_angle start angle in degrees
+ * @param[in] end_angle end angle in degrees
+ * @param[in] color display color
+ * @return    status code
+ *            - 0 success
+ *            - 1 draw arc failed
+ * @note      the arc is not flushed
+ */
+static uint8_t a_ssd1351_draw_arc(ssd1351_handle_t *handle, int16_t x, int16_t y, int16_t r, 
+                                  uint16_t start_angle, uint16_t end_angle, uint32_t color)
+{
+    ssd1351_arc_t arc;
+    
+    if (end_angle >= start_angle)                                                                /* check angle order */
+    {
+        arc.sweep = (uint16_t)(end_angle - start_angle);                                         /* get sweep */
+    }
+    else
+    {
+        arc.sweep = (uint16_t)(end_angle + 360 - start_angle);                                   /* get sweep */
+    }
+    if (arc.sweep == 0)                                                                          /* check sweep */
+    {
+        return 0;                                                                                /* success return 0 */
+    }
+    arc.x = x;                                                                                   /* set center x */
+    arc.y = y;                                                                                   /* set center y */
+    arc.start_x = a_ssd1351_sin((uint16_t)(start_angle + 90));                                   /* start cosine */
+    arc.start_y = a_ssd1351_sin(start_angle);                                                    /* start sine */
+    arc.end_x = a_ssd1351_sin((uint16_t)(end_angle + 90));                                       /* end cosine */
+    arc.end_y = a_ssd1351_sin(end_angle);                                                        /* end sine */
+    
+    return a_ssd1351_draw_round(handle, x, y, r, 0, 0, &arc, color);                             /* draw arc */
+}
+
+/**
+ * @brief     end a shape
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 flush failed
+ * @note      the buffer is flushed unless the write combine mode is enabled
+ */
+static uint8_t a_ssd1351_shape_end(ssd1351_handle_t *handle)
+{
+    if ((handle->write_combine == 0) && (a_ssd1351_buffer_flush(handle) != 0))                   /* flush buffer */
+    {
+        handle->debug_print("ssd1351: write data failed.\n");                                    /* write data failed */
+        
+        return 1;                                                                                /* return error */
+    }
+    
+    return 0;                                                                                    /* success return 0 */
+}
+
+/**
+ * @brief     unpack one pixel of the current color format
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @param[in] *buf pointer to a packed pixel
+ * @return    pixel color
+ * @note      the inverse of the selected packer
+ */
+static uint32_t a_ssd1351_unpack_pixel(ssd1351_handle_t *handle, const uint8_t *buf)
+{
+    uint32_t color;
+    
+    if (SSD1351_CONF_DEPTH(handle) == 0)                                                         /* if 256 */
+    {
+        return buf[0];                                                                           /* return color */
+    }
+    else if (SSD1351_CONF_DEPTH(handle) == 0x40)                                                 /* if 65K */
+    {
+        color = ((uint32_t)buf[0] << 8) | buf[1];                                                /* get color */
+#if (SSD1351_AUTO_COLOR_CONVERT == 1)                                                            /* if auto color convert */
+        if (SSD1351_CONF_SEQUENCE(handle) == 0)                                                  /* if swapped */
+        {
+            color = ((color & 0xF800) >> 11) | (color & 0x07E0) | ((color & 0x001F) << 11);      /* red green blue */
+        }
+#endif
+    }
+    else                                                                                         /* if 262K */
+    {
+        color = ((uint32_t)buf[0] << 16) | ((uint32_t)buf[1] << 8) | buf[2];                     /* get color */
+#if (SSD1351_AUTO_COLOR_CONVERT == 1)                                                            /* if auto color convert */
+        if (SSD1351_CONF_SEQUENCE(handle) == 0)                                                  /* if swapped */
+        {
+            color = ((uint32_t)buf[2] << 16) | ((uint32_t)buf[1] << 8) | buf[0];                 /* red green blue */
+        }
+#endif
+    }
+    
+    return color;                                                                                /* return color */
+}
+
+/**
+ * @brief     blend two colors of the current color depth
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @param[in] fg foreground color
+ * @param[in] bg background color
+ * @param[in] alpha foreground weight 0 - 256
+ * @return    blended color
+ * @note      every color component is blended on its own
+ */
+static uint32_t a_ssd1351_blend(ssd1351_handle_t *handle, uint32_t fg, uint32_t bg, uint16_t alpha)
+{
+    static const uint32_t mask[3][3] =
+    {
+        {0x0000E0, 0x00001C, 0x000003},                                                          /* 256 */
+        {0x00F800, 0x0007E0, 0x00001F},                                                          /* 65K */
+        {0x3F0000, 0x003F00, 0x00003F},                                                          /* 262K */
+    };
+    const uint32_t *m;
+    uint32_t color;
+    uint8_t i;
+    
+    m = mask[a_ssd1351_pixel_bytes(handle) - 1];                                                 /* get masks */
+    color = 0;                                                                                   /* init 0 */
+    for (i = 0; i < 3; i++)                                                                      /* blend all components */
+    {
+        color |= ((((fg & m[i]) * alpha) + ((bg & m[i]) * (256U - alpha))) >> 8) & m[i];        /* blend */
+    }
+    
+    return color;                                                                                /* return color */
+}
+
+/**
+ * @brief     add the coverage of a span to a row
+ * @param[in] *cov pointer to a coverage row
+ * @param[in] width row width in pixels
+ * @param[in] a span start in 1/16 pixel
+ * @param[in] b span end in 1/16 pixel
+ * @note      the span is clipped to the row
+ */
+static void a_ssd1351_coverage_add(uint16_t *cov, uint8_t width, int32_t a, int32_t b)
+{
+    int32_t pa;
+    int32_t pb;
+    int32_t i;
+    
+    if (a < 0)                                                                                   /* check start */
+    {
+        a = 0;                                                                                   /* clip start */
+    }
+    if (b > (int32_t)width * 16)                                                                 /* check end */
+    {
+        b = (int32_t)width * 16;                                                                 /* clip end */
+    }
+    if (a >= b)                                                                                  /* check empty */
+    {
+        return;                                                                                  /* return */
+    }
+    pa = a >> 4;                                                                                 /* start pixel */
+    pb = b >> 4;                                                                                 /* end pixel */
+    if (pa == pb)                                                                                /* if one pixel */
+    {
+        cov[pa] = (uint16_t)(cov[pa] + (b - a));                                                 /* partial coverage */
+        
+        return;                                                                                  /* return */
+    }
+    cov[pa] = (uint16_t)(cov[pa] + 16 - (a & 15));                                               /* start coverage */
+    for (i = pa + 1; i < pb; i++)                                                                /* full pixels */
+    {
+        cov[i] = (uint16_t)(cov[i] + 16);                                                        /* full coverage */
+    }
+    if (pb < width)                                                                              /* check end pixel */
+    {
+        cov[pb] = (uint16_t)(cov[pb] + (b & 15));                                                /* end coverage */
+    }
+}
+
+/**
+ * @brief      get the band buffer
+ * @param[in]  *handle pointer to an ssd1351 handle structure
+ * @param[in]  row_len bytes of one band row
+ * @param[out] **band pointer to a band buffer pointer
+ * @param[out] *rows pointer to the rows of one band
+ * @return     status code
+ *             - 0 success
+ *             - 1 send failed
+ *             - 2 band buffer is too small
+ * @note       the inner buffer is sent and used when no band buffer is set or it can't hold a row,
+ *             it fails while an async transfer reads the inner buffer
+ */
+static uint8_t a_ssd1351_band_get(ssd1351_handle_t *handle, uint32_t row_len, uint8_t **band, uint16_t *rows)
+{
+    uint32_t len;
+    
+    if (handle->async_status == SSD1351_ASYNC_STATUS_BUSY)                                       /* check async status */
+    {
+        handle->debug_print("ssd1351: async is busy.\n");                                        /* async is busy */
+        
+        return 1;                                                                                /* return error */
+    }
+    if ((handle->band != NULL) && (handle->band_len >= row_len))                                 /* if band buffer */
+    {
+        *band = handle->band;                                                                    /* use band buffer */
+        len = handle->band_len;                                                                  /* get length */
+    }
+    else
+    {
+        if (a_ssd1351_buffer_send(handle) != 0)                                                  /* send pending data */
+        {
+            handle->debug_print("ssd1351: write data failed.\n");                                /* write data failed */
+            
+            return 1;                                                                            /* return error */
+        }
+        *band = handle->buf;                                                                     /* use inner buffer */
+        len = SSD1351_BUFFER_SIZE;                                                               /* get length */
+    }
+    *rows = (uint16_t)(((len > 65535) ? 65535 : len) / row_len);                                /* rows of one burst */
+    if (*rows == 0)                                                                              /* check rows */
+    {
+        return 2;                                                                                /* return error */
+    }
+    
+    return 0;                                                                                    /* success return 0 */
+}
+
+/**
+ * @brief     send a band of packed rows
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @param[in] *band pointer to a band buffer
+ * @param[in] left left coordinate x
+ * @param[in] top top coordinate y
+ * @param[in] right right coordinate x
+ * @param[in] bottom bottom coordinate y
+ * @return    status code
+ *            - 0 success
+ *            - 1 send failed
+ * @note      the rows are sent as one burst with the horizontal address increment
+ */
+static uint8_t a_ssd1351_band_send(ssd1351_handle_t *handle, uint8_t *band, uint8_t left, uint8_t top, 
+                                   uint8_t right, uint8_t bottom)
+{
+    uint32_t total;
+    
+    total = (uint32_t)(right - left + 1) * (uint32_t)(bottom - top + 1);                         /* get total */
+    if (a_ssd1351_set_window(handle, left, top, right, bottom, total) != 0)                      /* set window */
+    {
+        return 1;                                                                                /* return error */
+    }
+    if (a_ssd1351_write_bytes(handle, band, (uint16_t)(total * a_ssd1351_pixel_bytes(handle)), 
+                              SSD1351_DATA) != 0)                                                /* write band */
+    {
+        handle->debug_print("ssd1351: write data failed.\n");                                    /* write data failed */
+        
+        return 1;                                                                                /* return error */
+    }
+    
+    return 0;                                                                                    /* success return 0 */
+}
+
+/**
+ * @brief     fill a polygon with anti-aliased edges
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @param[in] *point pointer to a point buffer in 1/16 pixel
+ * @param[in] num point number
+ * @param[in] color display color
+ * @param[in] background background color
+ * @return    status code
+ *            - 0 success
+ *            - 1 fill polygon failed
+ *            - 2 band buffer is too small
+ * @note      the active edges are walked with the non-zero winding rule on SSD1351_POLYGON_SUBSAMPLE
+ *            sub-scanlines per row and the coverage picks one of the pre-blended colors,
+ *            the bounding box is sent band by band or blended into the framebuffer
+ */
+static uint8_t a_ssd1351_fill_polygon(ssd1351_handle_t *handle, const ssd1351_point_t *point, uint8_t num, 
+                                      uint32_t color, uint32_t background)
+{
+    ssd1351_edge_t edge[SSD1351_POLYGON_MAX_POINTS];
+    uint8_t order[SSD1351_POLYGON_MAX_POINTS];
+    uint8_t active[SSD1351_POLYGON_MAX_POINTS];
+    uint16_t cov[128];
+    uint8_t palette[(16 * SSD1351_POLYGON_SUBSAMPLE + 1) * 3];
+    uint8_t *band;
+    uint8_t *p;
+    const ssd1351_point_t *p0;
+    const ssd1351_point_t *p1;
+    const ssd1351_point_t *pt;
+    int32_t min_x, max_x, min_y, max_y;
+    int32_t ys;
+    int32_t xa;
+    int32_t xb;
+    uint32_t row_len;
+    uint16_t rows;
+    uint16_t c;
+    uint8_t left, right, top, bottom;
+    uint8_t band_top;
+    uint8_t width;
+    uint8_t n;
+    uint8_t num_edge;
+    uint8_t num_active;
+    uint8_t next;
+    uint8_t i, j, k, s;
+    uint8_t y;
+    int16_t winding;
+    uint8_t increment;
+    uint8_t res;
+    
+    min_x = max_x = point[0].x;                                                                  /* init bounds */
+    min_y = max_y = point[0].y;                                                                  /* init bounds */
+    num_edge = 0;                                                                                /* init 0 */
+    for (i = 0; i < num; i++)                                                                    /* build the edge table */
+    {
+        p0 = &point[i];                                                                          /* get start */
+        p1 = &point[(i + 1) % num];                                                              /* get end */
+        min_x = (p0->x < min_x) ? p0->x : min_x;                                                 /* update bounds */
+        max_x = (p0->x > max_x) ? p0->x : max_x;                                                 /* update bounds */
+        min_y = (p0->y < min_y) ? p0->y : min_y;                                                 /* update bounds */
+        max_y = (p0->y > max_y) ? p0->y : max_y;                                                 /* update bounds */
+        if (p0->y == p1->y)                                                                      /* skip horizontal edge */
+        {
+            continue;                                                                            /* next edge */
+        }
+        if (p0->y > p1->y)                                                                       /* if upward */
+        {
+            edge[num_edge].dir = -1;                                                             /* set direction */
+            pt = p0;                                                                             /* swap */
+            p0 = p1;                                                                             /* swap */
+            p1 = pt;                                                                             /* swap */
+        }
+        else
+        {
+            edge[num_edge].dir = 1;                                                              /* set direction */
+        }
+        edge[num_edge].top = p0->y;                                                              /* set top */
+        edge[num_edge].bottom = p1->y;                                                           /* set bottom */
+        edge[num_edge].x = (int32_t)p0->x * 4096;                                                /* set x at top */
+        edge[num_edge].dx = (((int32_t)p1->x - p0->x) * 4096) / ((int32_t)p1->y - p0->y);        /* set slope */
+        k = num_edge;                                                                            /* insert sorted by top */
+        while ((k > 0) && (edge[order[k - 1]].top > edge[num_edge].top))                         /* find position */
+        {
+            order[k] = order[k - 1];                                                             /* move */
+            k--;                                                                                 /* k-- */
+        }
+        order[k] = num_edge;                                                                     /* insert */
+        num_edge++;                                                                              /* edge++ */
+    }
+    if ((max_x <= 0) || (max_y <= 0) || (min_x >= 128 * 16) || (min_y >= 128 * 16) || 
+        (min_x == max_x) || (min_y == max_y))                                                    /* check visible */
+    {
+        return 0;                                                                                /* success return 0 */
+    }
+    left = (uint8_t)((min_x < 0) ? 0 : (min_x >> 4));                                            /* get left */
+    top = (uint8_t)((min_y < 0) ? 0 : (min_y >> 4));                                             /* get top */
+    right = (uint8_t)((max_x > 128 * 16) ? 127 : ((max_x + 15) >> 4) - 1);                       /* get right */
+    bottom = (uint8_t)((max_y > 128 * 16) ? 127 : ((max_y + 15) >> 4) - 1);                      /* get bottom */
+    width = (uint8_t)(right - left + 1);                                                         /* get width */
+    n = a_ssd1351_pixel_bytes(handle);                                                           /* get pixel bytes */
+    row_len = (uint32_t)width * n;                                                               /* get row length */
+    res = a_ssd1351_band_get(handle, row_len, &band, &rows);                                     /* get band */
+    if (res == 1)                                                                                /* check result */
+    {
+        return 1;                                                                                /* return error */
+    }
+    if ((handle->fb == NULL) && (res == 2))                                                      /* check band length */
+    {
+        handle->debug_print("ssd1351: band buffer is too small.\n");                             /* band buffer is too small */
+        
+        return 2;                                                                                /* return error */
+    }
+    for (c = 0; c <= 16 * SSD1351_POLYGON_SUBSAMPLE; c++)                                        /* pre-blend all coverages */
+    {
+        (void)a_ssd1351_pack_pixel(handle, 
+                                   a_ssd1351_blend(handle, color, background, 
+                                                   (uint16_t)(c * 256 / (16 * SSD1351_POLYGON_SUBSAMPLE))), 
+                                   &palette[c * n]);                                             /* pack blended color */
+    }
+    increment = a_ssd1351_get_increment(handle);                                                 /* save address increment */
+    if (handle->fb != NULL)                                                                      /* if framebuffer */
+    {
+        if (a_ssd1351_set_window(handle, left, top, right, bottom, 
+                                 (uint32_t)width * (bottom - top + 1)) != 0)                     /* check and mark the box */
+        {
+            return 1;                                                                            /* return error */
+        }
+    }
+    else
+    {
+        if (a_ssd1351_set_increment(handle, SSD1351_ADDRESS_INCREMENT_HORIZONTAL) != 0)          /* set horizontal increment */
+        {
+            return 1;                                                                            /* return error */
+        }
+    }
+    res = 0;                                                                                     /* init 0 */
+    num_active = 0;                                                                              /* init 0 */
+    next = 0;                                                                                    /* init 0 */
+    band_top = top;                                                                              /* init top */
+    for (y = top; ; y++)                                                                         /* loop all rows */
+    {
+        memset(cov, 0, sizeof(uint16_t) * width);                                                /* clear coverage */
+        for (s = 0; s < SSD1351_POLYGON_SUBSAMPLE; s++)                                          /* loop all sub-scanlines */
+        {
+            ys = (int32_t)y * 16 + (2 * s + 1) * 8 / SSD1351_POLYGON_SUBSAMPLE;                  /* get sample y */
+            while ((next < num_edge) && (edge[order[next]].top <= ys))                           /* activate edges */
+            {
+                k = order[next];                                                                 /* get edge */
+                edge[k].x += (int32_t)(((int64_t)edge[k].dx * (ys - edge[k].top)));              /* move to the sample */
+                active[num_active] = k;                                                          /* add edge */
+                num_active++;                                                                    /* active++ */
+                next++;                                                                          /* next++ */
+            }
+            for (i = 0, j = 0; i < num_active; i++)                                              /* drop finished edges */
+            {
+                if (edge[active[i]].bottom > ys)                                                 /* check bottom */
+                {
+                    active[j] = active[i];                                                       /* keep edge */
+                    j++;                                                                         /* j++ */
+                }
+            }
+            num_active = j;                                                                      /* set active number */
+            for (i = 1; i < num_active; i++)                                                     /* sort by x */
+            {
+                k = active[i];                                                                   /* get edge */
+                j = i;                                                                           /* init i */
+                while ((j > 0) && (edge[active[j - 1]].x > edge[k].x))                           /* find position */
+                {
+                    active[j] = active[j - 1];                                                   /* move */
+                    j--;                                                                         /* j-- */
+                }
+                active[j] = k;                                                                   /* insert */
+            }
+            winding = 0;                                                                         /* init 0 */
+            xa = 0;                                                                              /* init 0 */
+            for (i = 0; i < num_active; i++)                                                     /* walk the crossings */
+            {
+                k = active[i];                                                                   /* get edge */
+                if (winding == 0)                                                                /* if span starts */
+                {
+                    xa = ((edge[k].x + 2048) >> 12) - (int32_t)left * 16;                          /* set start */
+                }
+                winding = (int16_t)(winding + edge[k].dir);                                      /* update winding */
+                if (winding == 0)                                                                /* if span ends */
+                {
+                    xb = ((edge[k].x + 2048) >> 12) - (int32_t)left * 16;                          /* set end */
+                    a_ssd1351_coverage_add(cov, width, xa, xb);                                  /* add coverage */
+                }
+                edge[k].x += edge[k].dx * (16 / SSD1351_POLYGON_SUBSAMPLE);                      /* step to the next sample */
+            }
+        }
+        if (handle->fb != NULL)                                                                  /* if framebuffer */
+        {
+            p = &handle->fb[((uint32_t)y * 128 + left) * n];                                     /* get row */
+            for (i = 0; i < width; i++)                                                          /* blend the row */
+            {
+                c = cov[i];                                                                      /* get coverage */
+                if (c >= 16 * SSD1351_POLYGON_SUBSAMPLE)                                         /* if full */
+                {
+                    memcpy(&p[i * n], &palette[16 * SSD1351_POLYGON_SUBSAMPLE * n], n);         /* set color */
+                }
+                else if (c != 0)                                                                 /* if edge */
+                {
+                    (void)a_ssd1351_pack_pixel(handle, 
+                                               a_ssd1351_blend(handle, color, 
+                                                               a_ssd1351_unpack_pixel(handle, &p[i * n]), 
+                                                               (uint16_t)(c * 256 / (16 * SSD1351_POLYGON_SUBSAMPLE))), 
+                                               &p[i * n]);                                       /* blend over the pixel */
+                }
+            }
+        }
+        else
+        {
+            p = &band[(uint32_t)(y - band_top) * row_len];                                       /* get band row */
+            for (i = 0; i < width; i++)                                                          /* render the row */
+            {
+                c = (cov[i] > 16 * SSD1351_POLYGON_SUBSAMPLE) ? 16 * SSD1351_POLYGON_SUBSAMPLE : cov[i];  /* get coverage */
+                memcpy(&p[i * n], &palette[c * n], n);                                           /* set pixel */
+            }
+            if ((y == bottom) || ((uint16_t)(y - band_top + 1) >= rows))                         /* if the band is full */
+            {
+                if (a_ssd1351_band_send(handle, band, left, band_top, right, y) != 0)            /* send band */
+                {
+                    res = 1;                                                                     /* set error */
+                    
+                    break;                                                                       /* break */
+                }
+                band_top = (uint8_t)(y + 1);                                                     /* next band */
+            }
+        }
+        if (y == bottom)                                                                         /* check end */
+        {
+            break;                                                                               /* break */
+        }
+    }
+    if (handle->fb != NULL)                                                                      /* if framebuffer */
+    {
+        return 0;                                                                                /* success return 0 */
+    }
+    if (a_ssd1351_set_increment(handle, increment) != 0)                                         /* restore address increment */
+    {
+        return 1;                                                                                /* return error */
+    }
+    
+    return res;                                                                                  /* return the result */
+}
+
+/**
+ * @brief     draw the picture
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @param[in] left left coordinate x
+ * @param[in] top top coordinate y
+ * @param[in] right right coordinate x
+ * @param[in] bottom bottom coordinate y
+ * @param[in] *color pointer to an image buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 draw picture failed
+ * @note      none
+ */
+static uint8_t a_ssd1351_draw_picture(ssd1351_handle_t *handle, uint8_t left, uint8_t top, uint8_t right, uint8_t bottom, const uint32_t *color)
+{
+    uint32_t p;
+    uint32_t total;
+    
+    total = (uint32_t)(right - left + 1) * (bottom - top + 1);                                   /* get pixel number */
+    if (a_ssd1351_set_window(handle, left, top, right, bottom, total) != 0)                      /* set window */
+    {
+        return 1;                                                                                /* return error */
+    }
+    for (p = 0; p < total; p++)                                                                  /* all pixels */
+    {
+        if (a_ssd1351_buffer_write_pixel(handle, color[p], 1) != 0)                              /* write pixel */
+        {
+            handle->debug_print("ssd1351: write data failed.\n");                                /* write data failed */
+            
+            return 1;                                                                            /* return error */
+        }
+    }
+    if (a_ssd1351_buffer_flush(handle) != 0)                                                     /* flush buffer */
+    {
+        handle->debug_print("ssd1351: write data failed.\n");                                    /* write data failed */
+        
+        return 1;                                                                                /* return error */
+    }
+    
+    return 0;                                                                                    /* success return 0 */
+}
+
+/**
+ * @brief     draw the 16 bits picture
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @param[in] left left coordinate x
+ * @param[in] top top coordinate y
+ * @param[in] right right coordinate x
+ * @param[in] bottom bottom coordinate y
+ * @param[in] *color pointer to an image buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 draw picture failed
+ * @note      none
+ */
+static uint8_t a_ssd1351_draw_picture_16_bits(ssd1351_handle_t *handle, uint8_t left, uint8_t top, uint8_t right, uint8_t bottom, const uint16_t *color)
+{
+    uint32_t p;
+    uint32_t total;
+    
+    if (SSD1351_CONF_DEPTH(handle) > 0x40)                                                       /* if 262K */
+    {
+        handle->debug_print("ssd1351: 262K color format can't use this function.\n");            /* 262K can't use this function */
+        
+        return 1;                                                                                /* return error */
+    }
+    total = (uint32_t)(right - left + 1) * (bottom - top + 1);                                   /* get pixel number */
+    if (a_ssd1351_set_window(handle, left, top, right, bottom, total) != 0)                      /* set window */
+    {
+        return 1;                                                                                /* return error */
+    }
+    for (p = 0; p < total; p++)                                                                  /* all pixels */
+    {
+        if (a_ssd1351_buffer_write_pixel(handle, color[p], 1) != 0)                              /* write pixel */
+        {
+            handle->debug_print("ssd1351: write data failed.\n");                                /* write data failed */
+            
+            return 1;                                                                            /* return error */
+        }
+    }
+    if (a_ssd1351_buffer_flush(handle) != 0)                                                     /* flush buffer */
+    {
+        handle->debug_print("ssd1351: write data failed.\n");                                    /* write data failed */
+        
+        return 1;                                                                                /* return error */
+    }
+    
+    return 0;                                                                                    /* success return 0 */
+}
+
+/**
+ * @brief     check a display list item
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @param[in] *item pointer to a display list item
+ * @return    status code
+ *            - 0 success
+ *            - 1 item is invalid
+ * @note      the item is checked like the matching draw function
+ */
+static uint8_t a_ssd1351_check_item(ssd1351_handle_t *handle, const ssd1351_draw_item_t *item)
+{
+    if ((item->x0 > 127) || (item->y0 > 127) || (item->x1 > 127) || (item->y1 > 127) || 
+        (item->x2 > 127) || (item->y2 > 127))                                                    /* check points */
+    {
+        return 1;                                                                                /* return error */
+    }
+    switch (item->type)
+    {
+        case SSD1351_DRAW_FILL_RECT :
+        case SSD1351_DRAW_PICTURE :
+        case SSD1351_DRAW_PICTURE_16BITS :
+        case SSD1351_DRAW_ROUND_RECT :
+        case SSD1351_DRAW_FILL_ROUND_RECT :
+        {
+            if ((item->x0 > item->x1) || (item->y0 > item->y1))                                  /* check box */
+            {
+                return 1;                                                                        /* return error */
+            }
+            if (((item->type == SSD1351_DRAW_ROUND_RECT) || (item->type == SSD1351_DRAW_FILL_ROUND_RECT)) && 
+                ((2 * item->param > item->x1 - item->x0) || (2 * item->param > item->y1 - item->y0)))  /* check radius */
+            {
+                return 1;                                                                        /* return error */
+            }
+            if ((item->type == SSD1351_DRAW_PICTURE) || (item->type == SSD1351_DRAW_PICTURE_16BITS))   /* if picture */
+            {
+                if (item->data == NULL)                                                          /* check image */
+                {
+                    return 1;                                                                    /* return error */
+                }
+                if ((item->type == SSD1351_DRAW_PICTURE_16BITS) && (SSD1351_CONF_DEPTH(handle) > 0x40))  /* if 262K */
+                {
+                    return 1;                                                                    /* return error */
+                }
+            }
+            
+            return 0;                                                                            /* success return 0 */
+        }
+        case SSD1351_DRAW_LINE :
+        case SSD1351_DRAW_CIRCLE :
+        case SSD1351_DRAW_FILL_CIRCLE :
+        case SSD1351_DRAW_FILL_TRIANGLE :
+        {
+            return 0;                                                                            /* success return 0 */
+        }
+        case SSD1351_DRAW_ARC :
+        {
+            return ((item->start_angle > 360) || (item->end_angle > 360)) ? 1 : 0;               /* check angles */
+        }
+        case SSD1351_DRAW_STRING :
+        case SSD1351_DRAW_STRING_OPAQUE :
+        {
+            if ((item->param != SSD1351_FONT_12) && (item->param != SSD1351_FONT_16) && 
+                (item->param != SSD1351_FONT_24))                                                /* check font */
+            {
+                return 1;                                                                        /* return error */
+            }
+            if ((item->data == NULL) && (item->len != 0))                                        /* check string */
+            {
+                return 1;                                                                        /* return error */
+            }
+            
+            return 0;                                                                            /* success return 0 */
+        }
+        default :
+        {
+            return 1;                                                                            /* return error */
+        }
+    }
+}
+
+/**
+ * @brief      get the box covered by a display list item
+ * @param[in]  *item pointer to a display list item
+ * @param[out] *box pointer to a box structure
+ * @return     1 if the item covers pixels, 0 otherwise
+ * @note       the box is clipped to the display and a string is laid out like ssd1351_write_string
+ */
+static uint8_t a_ssd1351_item_box(const ssd1351_draw_item_t *item, ssd1351_box_t *box)
+{
+    const char *str;
+    uint16_t len;
+    uint8_t x;
+    uint8_t y;
+    uint8_t width;
+    uint8_t height;
+    
+    switch (item->type)
+    {
+        case SSD1351_DRAW_LINE :
+        {
+            box->left = (item->x0 < item->x1) ? item->x0 : item->x1;                             /* set left */
+            box->top = (item->y0 < item->y1) ? item->y0 : item->y1;                              /* set top */
+            box->right = (item->x0 > item->x1) ? item->x0 : item->x1;                            /* set right */
+            box->bottom = (item->y0 > item->y1) ? item->y0 : item->y1;                           /* set bottom */
+            
+            break;
+        }
+        case SSD1351_DRAW_CIRCLE :
+        case SSD1351_DRAW_FILL_CIRCLE :
+        case SSD1351_DRAW_ARC :
+        {
+            box->left = (int16_t)(item->x0 - item->param);                                       /* set left */
+            box->top = (int16_t)(item->y0 - item->param);                                        /* set top */
+            box->right = (int16_t)(item->x0 + item->param);                                      /* set right */
+            box->bottom = (int16_t)(item->y0 + item->param);                                     /* set bottom */
+            
+            break;
+        }
+        case SSD1351_DRAW_FILL_TRIANGLE :
+        {
+            box->left = (item->x0 < item->x1) ? item->x0 : item->x1;                             /* set left */
+            box->left = (item->x2 < box->left) ? item->x2 : box->left;                           /* set left */
+            box->top = (item->y0 < item->y1) ? item->y0 : item->y1;                              /* set top */
+            box->top = (item->y2 < box->top) ? item->y2 : box->top;                              /* set top */
+            box->right = (item->x0 > item->x1) ? item->x0 : item->x1;                            /* set right */
+            box->right = (item->x2 > box->right) ? item->x2 : box->right;                        /* set right */
+            box->bottom = (item->y0 > item->y1) ? item->y0 : item->y1;                           /* set bottom */
+            box->bottom = (item->y2 > box->bottom) ? item->y2 : box->bottom;                     /* set bottom */
+            
+            break;
+        }
+        case SSD1351_DRAW_STRING :
+        case SSD1351_DRAW_STRING_OPAQUE :
+        {
+            a_ssd1351_font_size(item->param, NULL, &width, &height);                             /* get glyph size */
+            str = (const char *)item->data;                                                      /* get string */
+            len = item->len;                                                                     /* get length */
+            x = item->x0;                                                                        /* get x */
+            y = item->y0;                                                                        /* get y */
+            box->left = 127;                                                                     /* nothing yet */
+            box->top = 127;                                                                      /* nothing yet */
+            box->right = 0;                                                                      /* nothing yet */
+            box->bottom = -1;                                                                    /* nothing yet */
+            while ((len != 0) && (a_ssd1351_font_has_char((uint8_t)*str, NULL) != 0))            /* lay out the string */
+            {
+                if (x > (127 - width))                                                           /* check x point */
+                {
+                    x = 0;                                                                       /* set x */
+                    y += height;                                                                 /* set next row */
+                }
+                if (y > (127 - height))                                                          /* check y pont */
+                {
+                    y = x = 0;                                                                   /* reset to 0 */
+                }
+                box->left = (x < box->left) ? x : box->left;                                     /* update left */
+                box->top = (y < box->top) ? y : box->top;                                        /* update top */
+                box->right = (x + width - 1 > box->right) ? (int16_t)(x + width - 1) : box->right;       /* update right */
+                box->bottom = (y + height - 1 > box->bottom) ? (int16_t)(y + height - 1) : box->bottom;  /* update bottom */
+                x += width;                                                                      /* x + width */
+                str++;                                                                           /* str address++ */
+                len--;                                                                           /* str length-- */
+            }
+            
+            break;
+        }
+        default :
+        {
+            box->left = item->x0;                                                                /* set left */
+            box->top = item->y0;                                                                 /* set top */
+            box->right = item->x1;                                                               /* set right */
+            box->bottom = item->y1;                                                              /* set bottom */
+            
+            break;
+        }
+    }
+    box->left = (box->left < 0) ? 0 : box->left;                                                 /* clip left */
+    box->top = (box->top < 0) ? 0 : box->top;                                                    /* clip top */
+    box->right = (box->right > 127) ? 127 : box->right;                                          /* clip right */
+    box->bottom = (box->bottom > 127) ? 127 : box->bottom;                                       /* clip bottom */
+    
+    return ((box->left <= box->right) && (box->top <= box->bottom)) ? 1 : 0;                     /* check empty */
+}
+
+/**
+ * @brief     render a display list item
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @param[in] *item pointer to a display list item
+ * @param[in] increment address increment of the picture data
+ * @return    status code
+ *            - 0 success
+ *            - 1 render failed
+ * @note      only the rows of the strip are written,
+ *            without a strip the item is drawn like the matching draw function and is not flushed
+ */
+static uint8_t a_ssd1351_render_item(ssd1351_handle_t *handle, const ssd1351_draw_item_t *item, uint8_t increment)
+{
+    const char *str;
+    uint8_t *p;
+    uint32_t index;
+    uint16_t len;
+    int16_t top;
+    int16_t bottom;
+    int16_t y;
+    uint8_t x;
+    uint8_t sy;
+    uint8_t width;
+    uint8_t height;
+    uint8_t n;
+    uint8_t i;
+    
+    switch (item->type)
+    {
+        case SSD1351_DRAW_FILL_RECT :
+        {
+            return a_ssd1351_draw_block(handle, item->x0, item->y0, item->x1, item->y1, item->color);   /* fill rect */
+        }
+        case SSD1351_DRAW_LINE :
+        {
+            return a_ssd1351_draw_line(handle, item->x0, item->y0, item->x1, item->y1, item->color);    /* draw line */
+        }
+        case SSD1351_DRAW_CIRCLE :
+        {
+            return a_ssd1351_draw_round(handle, item->x0, item->y0, item->param, 0, 0, NULL, item->color);  /* draw circle */
+        }
+        case SSD1351_DRAW_FILL_CIRCLE :
+        {
+            return a_ssd1351_fill_round(handle, item->x0, item->y0, item->param, 0, 0, item->color);  /* fill circle */
+        }
+        case SSD1351_DRAW_ARC :
+        {
+            return a_ssd1351_draw_arc(handle, item->x0, item->y0, item->param, item->start_angle, 
+                                      item->end_angle, item->color);                             /* draw arc */
+        }
+        case SSD1351_DRAW_FILL_TRIANGLE :
+        {
+            return a_ssd1351_fill_triangle(handle, item->x0, item->y0, item->x1, item->y1, 
+                                           item->x2, item->y2, item->color);                     /* fill triangle */
+        }
+        case SSD1351_DRAW_ROUND_RECT :
+        {
+            return a_ssd1351_draw_round(handle, (int16_t)(item->x0 + item->param), (int16_t)(item->y0 + item->param), 
+                                        item->param, (int16_t)(item->x1 - item->x0 - 2 * item->param), 
+                                        (int16_t)(item->y1 - item->y0 - 2 * item->param), 
+                                        NULL, item->color);                                      /* draw rounded rect */
+        }
+        case SSD1351_DRAW_FILL_ROUND_RECT :
+        {
+            return a_ssd1351_fill_round(handle, (int16_t)(item->x0 + item->param), (int16_t)(item->y0 + item->param), 
+                                        item->param, (int16_t)(item->x1 - item->x0 - 2 * item->param), 
+                                        (int16_t)(item->y1 - item->y0 - 2 * item->param), 
+                                        item->color);                                            /* fill rounded rect */
+        }
+        case SSD1351_DRAW_STRING :
+        case SSD1351_DRAW_STRING_OPAQUE :
+        {
+            if ((handle->strip == NULL) && (item->type == SSD1351_DRAW_STRING))                  /* if display */
+            {
+                return a_ssd1351_write_string(handle, item->x0, item->y0, (const char *)item->data, item->len, 
+                                              item->color, item->param, NULL);                   /* write string */
+            }
+            if (handle->strip == NULL)                                                           /* if display */
+            {
+                return a_ssd1351_write_string_opaque(handle, item->x0, item->y0, (const char *)item->data, item->len, 
+                                                     item->color, item->background, item->param, NULL);  /* write opaque string */
+            }
+            a_ssd1351_font_size(item->param, NULL, &width, &height);                             /* get glyph size */
+            str = (const char *)item->data;                                                      /* get string */
+            len = item->len;                                                                     /* get length */
+            x = item->x0;                                                                        /* get x */
+            sy = item->y0;                                                                       /* get y */
+            while ((len != 0) && (a_ssd1351_font_has_char((uint8_t)*str, NULL) != 0))            /* write all string */
+            {
+                if (x > (127 - width))                                                           /* check x point */
+                {
+                    x = 0;                                                                       /* set x */
+                    sy += height;                                                                /* set next row */
+                }
+                if (sy > (127 - height))                                                         /* check y pont */
+                {
+                    sy = x = 0;                                                                  /* reset to 0 */
+                }
+                if ((sy <= handle->strip_bottom) && (sy + height - 1 >= handle->strip_top))      /* check strip */
+                {
+                    if ((item->type == SSD1351_DRAW_STRING_OPAQUE) && 
+                        (a_ssd1351_draw_block(handle, x, sy, (int16_t)(x + width - 1), 
+                                              (int16_t)(sy + height - 1), item->background) != 0))   /* fill the cell */
+                    {
+                        return 1;                                                                /* return error */
+                    }
+                    if (a_ssd1351_show_char(handle, x, sy, (uint8_t)*str, item->param, 
+                                            NULL, item->color) != 0)                             /* show a char */
+                    {
+                        return 1;                                                                /* return error */
+                    }
+                }
+                x += width;                                                                      /* x + width */
+                str++;                                                                           /* str address++ */
+                len--;                                                                           /* str length-- */
+            }
+            
+            return 0;                                                                            /* success return 0 */
+        }
+        default :
+        {
+            if ((handle->strip == NULL) && (item->type == SSD1351_DRAW_PICTURE))                 /* if display */
+            {
+                return a_ssd1351_draw_picture(handle, item->x0, item->y0, item->x1, item->y1, 
+                                              (const uint32_t *)item->data);                     /* draw picture */
+            }
+            if (handle->strip == NULL)                                                           /* if display */
+            {
+                return a_ssd1351_draw_picture_16_bits(handle, item->x0, item->y0, item->x1, item->y1, 
+                                                      (const uint16_t *)item->data);             /* draw picture */
+            }
+            width = (uint8_t)(item->x1 - item->x0 + 1);                                          /* get width */
+            height = (uint8_t)(item->y1 - item->y0 + 1);                                         /* get height */
+            top = (item->y0 > handle->strip_top) ? item->y0 : handle->strip_top;                 /* clip top */
+            bottom = (item->y1 < handle->strip_bottom) ? item->y1 : handle->strip_bottom;        /* clip bottom */
+            n = a_ssd1351_pixel_bytes(handle);                                                   /* get pixel bytes */
+            for (y = top; y <= bottom; y++)                                                      /* all rows */
+            {
+                p = &handle->strip[((uint32_t)(y - handle->strip_top) * 128 + item->x0) * n];    /* get row */
+                for (i = 0; i < width; i++)                                                      /* all columns */
+                {
+                    if (increment != 0)                                                          /* if vertical */
+                    {
+                        index = (uint32_t)i * height + (uint32_t)(y - item->y0);                 /* column-major */
+                    }
+                    else
+                    {
+                        index = (uint32_t)(y - item->y0) * width + i;                            /* row-major */
+                    }
+                    if (item->type == SSD1351_DRAW_PICTURE)                                      /* if 32 bits */
+                    {
+                        (void)a_ssd1351_pack_pixel(handle, ((const uint32_t *)item->data)[index], &p[i * n]);  /* pack pixel */
+                    }
+                    else
+                    {
+                        (void)a_ssd1351_pack_pixel(handle, ((const uint16_t *)item->data)[index], &p[i * n]);  /* pack pixel */
+                    }
+                }
+            }
+            
+            return 0;                                                                            /* success return 0 */
+        }
+    }
+}
+
+/**
+ * @brief     render a display list strip by strip
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @param[in] *list pointer to a display list
+ * @param[in] num item number
+ * @param[in] background background color
+ * @return    status code
+ *            - 0 success
+ *            - 1 render list failed
+ *            - 2 band buffer is too small
+ * @note      every strip of full rows is cleared, gets all items that cross it in the list order
+ *            and is sent as one window and one burst with the horizontal address increment,
+ *            with the framebuffer the whole screen is rendered as one strip
+ */
+static uint8_t a_ssd1351_render_list(ssd1351_handle_t *handle, const ssd1351_draw_item_t *list, uint16_t num, 
+                                     uint32_t background)
+{
+    uint8_t data[3];
+    uint8_t *band;
+    uint16_t rows;
+    uint16_t top;
+    uint16_t bottom;
+    uint16_t i;
+    ssd1351_box_t box;
+    uint8_t increment;
+    uint8_t n;
+    uint8_t res;
+    
+    n = a_ssd1351_pack_pixel(handle, background, data);                                          /* pack background */
+    increment = a_ssd1351_get_increment(handle);                                                 /* save address increment */
+    if (handle->fb != NULL)                                                                      /* if framebuffer */
+    {
+        band = handle->fb;                                                                       /* render in place */
+        rows = 128;                                                                              /* one strip */
+        if (a_ssd1351_set_window(handle, 0, 0, 127, 127, 128 * 128) != 0)                        /* check and mark the screen */
+        {
+            return 1;                                                                            /* return error */
+        }
+    }
+    else
+    {
+        res = a_ssd1351_band_get(handle, 128 * (uint32_t)n, &band, &rows);                       /* get band */
+        if (res != 0)                                                                            /* check result */
+        {
+            if (res == 2)                                                                        /* if too small */
+            {
+                handle->debug_print("ssd1351: band buffer is too small.\n");                     /* band buffer is too small */
+            }
+            
+            return res;                                                                          /* return error */
+        }
+        if (a_ssd1351_set_increment(handle, SSD1351_ADDRESS_INCREMENT_HORIZONTAL) != 0)          /* set horizontal increment */
+        {
+            return 1;                                                                            /* return error */
+        }
+    }
+    res = 0;                                                                                     /* init 0 */
+    handle->strip = band;                                                                        /* set strip */
+    for (top = 0; top < 128; top += rows)                                                        /* all strips */
+    {
+        bottom = (top + rows > 128) ? 127 : (uint16_t)(top + rows - 1);                          /* get bottom */
+        handle->strip_top = (uint8_t)top;                                                        /* set strip top */
+        handle->strip_bottom = (uint8_t)bottom;                                                  /* set strip bottom */
+        a_ssd1351_pattern_fill(band, data, n, (uint32_t)(bottom - top + 1) * 128);               /* clear strip */
+        for (i = 0; i < num; i++)                                                                /* all items */
+        {
+            if ((a_ssd1351_item_box(&list[i], &box) == 0) || 
+                (box.bottom < (int16_t)top) || (box.top > (int16_t)bottom))                      /* check strip */
+            {
+                continue;                                                                        /* next item */
+            }
+            if (a_ssd1351_render_item(handle, &list[i], increment) != 0)                         /* render item */
+            {
+                res = 1;                                                                         /* set error */
+                
+                break;                                                                           /* break */
+            }
+        }
+        if (res != 0)                                                                            /* check result */
+        {
+            break;                                                                               /* break */
+        }
+        if ((handle->fb == NULL) && 
+            (a_ssd1351_band_send(handle, band, 0, (uint8_t)top, 127, (uint8_t)bottom) != 0))     /* send strip */
+        {
+            res = 1;                                                                             /* set error */
+            
+            break;                                                                               /* break */
+        }
+    }
+    handle->strip = NULL;                                                                        /* leave strip */
+    if (handle->fb != NULL)                                                                      /* if framebuffer */
+    {
+        return res;                                                                              /* return the result */
+    }
+    if (a_ssd1351_set_increment(handle, increment) != 0)                                         /* restore address increment */
+    {
+        return 1;                                                                                /* return error */
+    }
+    
+    return res;                                                                                  /* return the result */
+}
+
+/**
+ * @brief      check whether a display list item paints its whole box
+ * @param[in]  *item pointer to a display list item
+ * @param[out] *box pointer to the item box
+ * @return     1 if the item is opaque, 0 otherwise
+ * @note       an opaque string is opaque when it fits in one line
+ */
+static uint8_t a_ssd1351_item_opaque(const ssd1351_draw_item_t *item, ssd1351_box_t *box)
+{
+    if ((item->type == SSD1351_DRAW_FILL_RECT) || (item->type == SSD1351_DRAW_PICTURE) || 
+        (item->type == SSD1351_DRAW_PICTURE_16BITS))                                             /* if rect */
+    {
+        return a_ssd1351_item_box(item, box);                                                    /* opaque */
+    }
+    if ((item->type == SSD1351_DRAW_STRING_OPAQUE) && (a_ssd1351_item_box(item, box) != 0) && 
+        (box->bottom - box->top + 1 == item->param))                                             /* if one line */
+    {
+        return 1;                                                                                /* opaque */
+    }
+    
+    return 0;                                                                                    /* not opaque */
+}
+
+/**
+ * @brief     cull and merge a display list in place
+ * @param[in] *list pointer to a display list
+ * @param[in] num item number
+ * @return    item number left
+ * @note      an item is culled when it is empty or a later opaque item covers its box,
+ *            a fill is merged into the fill before it when both have the same color
+ *            and their union is a rect
+ */
+static uint16_t a_ssd1351_list_optimize(ssd1351_draw_item_t *list, uint16_t num)
+{
+    ssd1351_box_t box;
+    ssd1351_box_t cover;
+    ssd1351_draw_item_t *prev;
+    ssd1351_draw_item_t *item;
+    uint16_t i;
+    uint16_t j;
+    uint16_t k;
+    
+    for (i = num; i > 0; i--)                                                                    /* walk back to front */
+    {
+        item = &list[i - 1];                                                                     /* get item */
+        if (a_ssd1351_item_box(item, &box) == 0)                                                 /* check empty */
+        {
+            item->type = SSD1351_DRAW_NONE;                                                      /* cull item */
+            
+            continue;                                                                            /* next item */
+        }
+        for (j = i; j < num; j++)                                                                /* all later items */
+        {
+            if ((list[j].type == SSD1351_DRAW_NONE) || (a_ssd1351_item_opaque(&list[j], &cover) == 0))   /* check occluder */
+            {
+                continue;                                                                        /* next item */
+            }
+            if ((cover.left <= box.left) && (cover.top <= box.top) && 
+                (cover.right >= box.right) && (cover.bottom >= box.bottom))                      /* check cover */
+            {
+                item->type = SSD1351_DRAW_NONE;                                                  /* cull item */
+                
+                break;                                                                           /* break */
+            }
+        }
+    }
+    k = 0;                                                                                       /* init 0 */
+    for (i = 0; i < num; i++)                                                                    /* compact and merge */
+    {
+        item = &list[i];                                                                         /* get item */
+        if (item->type == SSD1351_DRAW_NONE)                                                     /* check culled */
+        {
+            continue;                                                                            /* next item */
+        }
+        prev = (k > 0) ? &list[k - 1] : NULL;                                                    /* get the item before */
+        if ((prev != NULL) && (prev->type == SSD1351_DRAW_FILL_RECT) && 
+            (item->type == SSD1351_DRAW_FILL_RECT) && (prev->color == item->color))              /* if two fills */
+        {
+            if ((prev->x0 == item->x0) && (prev->x1 == item->x1) && 
+                (item->y0 <= prev->y1 + 1) && (item->y1 + 1 >= prev->y0))                        /* if vertical neighbours */
+            {
+                prev->y0 = (item->y0 < prev->y0) ? item->y0 : prev->y0;                          /* merge top */
+                prev->y1 = (item->y1 > prev->y1) ? item->y1 : prev->y1;                          /* merge bottom */
+                
+                continue;                                                                        /* next item */
+            }
+            if ((prev->y0 == item->y0) && (prev->y1 == item->y1) && 
+                (item->x0 <= prev->x1 + 1) && (item->x1 + 1 >= prev->x0))                        /* if horizontal neighbours */
+            {
+                prev->x0 = (item->x0 < prev->x0) ? item->x0 : prev->x0;                          /* merge left */
+                prev->x1 = (item->x1 > prev->x1) ? item->x1 : prev->x1;                          /* merge right */
+                
+                continue;                                                                        /* next item */
+            }
+            if ((prev->x0 <= item->x0) && (prev->y0 <= item->y0) && 
+                (prev->x1 >= item->x1) && (prev->y1 >= item->y1))                                /* if inside */
+            {
+                continue;                                                                        /* drop item */
+            }
+        }
+        if (k != i)                                                                              /* check position */
+        {
+            list[k] = *item;                                                                     /* move item */
+        }
+        k++;                                                                                     /* k++ */
+    }
+    
+    return k;                                                                                    /* return item number */
+}
+
+/**
+ * @brief     replay a display list
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @param[in] *list pointer to a display list
+ * @param[in] num item number
+ * @return    status code
+ *            - 0 success
+ *            - 1 replay failed
+ * @note      a list that starts with a full screen fill is composed in strips so every pixel
+ *            is sent once, otherwise the items are drawn one by one
+ */
+static uint8_t a_ssd1351_list_replay(ssd1351_handle_t *handle, const ssd1351_draw_item_t *list, uint16_t num)
+{
+    uint16_t i;
+    uint8_t increment;
+    uint8_t res;
+    
+    if ((handle->fb == NULL) && (num > 1) && (list[0].type == SSD1351_DRAW_FILL_RECT) && 
+        (list[0].x0 == 0) && (list[0].y0 == 0) && (list[0].x1 == 127) && (list[0].y1 == 127))   /* if full screen fill */
+    {
+        res = a_ssd1351_render_list(handle, &list[1], num - 1, list[0].color);                   /* render in strips */
+        if (res != 2)                                                                            /* check band */
+        {
+            return res;                                                                          /* return the result */
+        }
+    }
+    increment = a_ssd1351_get_increment(handle);                                                 /* get address increment */
+    for (i = 0; i < num; i++)                                                                    /* draw all items */
+    {
+        if (a_ssd1351_render_item(handle, &list[i], increment) != 0)                             /* draw item */
+        {
+            return 1;                                                                            /* return error */
+        }
+    }
+    
+    return a_ssd1351_shape_end(handle);                                                          /* flush buffer */
+}
+
+/**
+ * @brief      get the screen box of a sprite
+ * @param[in]  *sprite pointer to a sprite structure
+ * @param[out] *box pointer to a box structure
+ * @return     1 if the sprite is visible on the screen else 0
+ * @note       the box is clipped to the screen
+ */
+static uint8_t a_ssd1351_sprite_box(const ssd1351_sprite_t *sprite, ssd1351_box_t *box)
+{
+    int32_t right;
+    int32_t bottom;
+    
+    if (sprite->visible == 0)                                                                    /* check visible */
+    {
+        return 0;                                                                                /* hidden */
+    }
+    right = (int32_t)sprite->x + sprite->width - 1;                                              /* get right */
+    bottom = (int32_t)sprite->y + sprite->height - 1;                                            /* get bottom */
+    box->left = (sprite->x < 0) ? 0 : sprite->x;                                                 /* clip left */
+    box->top = (sprite->y < 0) ? 0 : sprite->y;                                                  /* clip top */
+    box->right = (int16_t)((right > 127) ? 127 : right);                                         /* clip right */
+    box->bottom = (int16_t)((bottom > 127) ? 127 : bottom);                                      /* clip bottom */
+    
+    return (uint8_t)((box->left <= box->right) && (box->top <= box->bottom));                    /* return the result */
+}
+
+/**
+ * @brief     get the cost of sending a box
+ * @param[in] *box pointer to a box structure
+ * @param[in] bytes pixel bytes
+ * @return    cost in bytes
+ * @note      none
+ */
+static uint32_t a_ssd1351_box_cost(const ssd1351_box_t *box, uint8_t bytes)
+{
+    return SSD1351_WINDOW_SETUP_BYTES + (uint32_t)(box->right - box->left + 1) * 
+           (uint32_t)(box->bottom - box->top + 1) * bytes;
+}
+
+/**
+ * @brief     merge the sprite boxes
+ * @param[in] *box pointer to a box buffer
+ * @param[in] num box number
+ * @param[in] bytes pixel bytes
+ * @return    box number
+ * @note      two boxes are merged when their bounding box costs no more than sending both
+ */
+static uint8_t a_ssd1351_sprite_merge(ssd1351_box_t *box, uint8_t num, uint8_t bytes)
+{
+    ssd1351_box_t b;
+    uint8_t merged;
+    uint8_t i;
+    uint8_t j;
+    
+    do
+    {
+        merged = 0;                                                                              /* init 0 */
+        for (i = 0; (i < num) && (merged == 0); i++)                                             /* loop all */
+        {
+            for (j = i + 1; (j < num) && (merged == 0); j++)                                     /* loop others */
+            {
+                b.left = (box[i].left < box[j].left) ? box[i].left : box[j].left;                /* get left */
+                b.top = (box[i].top < box[j].top) ? box[i].top : box[j].top;                     /* get top */
+                b.right = (box[i].right > box[j].right) ? box[i].right : box[j].right;           /* get right */
+                b.bottom = (box[i].bottom > box[j].bottom) ? box[i].bottom : box[j].bottom;      /* get bottom */
+                if (a_ssd1351_box_cost(&b, bytes) > 
+                    a_ssd1351_box_cost(&box[i], bytes) + a_ssd1351_box_cost(&box[j], bytes))
+                {
+                    continue;                                                                    /* merging costs more */
+                }
+                box[i] = b;                                                                      /* merge */
+                box[j] = box[num - 1];                                                           /* remove */
+                num--;                                                                           /* num-- */
+                merged = 1;                                                                      /* flag merged */
+            }
+        }
+    } while (merged != 0);
+    
+    return num;                                                                                  /* return number */
+}
+
+/**
+ * @brief     compose one row of the sprite layer
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @param[in] *sprite pointer to a sprite buffer
+ * @param[in] num sprite number
+ * @param[in] y coordinate y
+ * @param[in] left left coordinate x
+ * @param[in] right right coordinate x
+ * @param[in] *buf pointer to a packed row buffer
+ * @note      the background row is packed first and the opaque sprite pixels are packed over it
+ */
+static void a_ssd1351_sprite_row(ssd1351_handle_t *handle, const ssd1351_sprite_t *sprite, uint8_t num, 
+                                 uint8_t y, uint8_t left, uint8_t right, uint8_t *buf)
+{
+    const uint16_t *image;
+    const uint8_t *mask;
+    int32_t x0;
+    int32_t x1;
+    int32_t x;
+    int32_t c;
+    uint8_t n;
+    uint8_t i;
+    
+    n = a_ssd1351_pixel_bytes(handle);                                                           /* get pixel bytes */
+    image = &handle->sprite_background[(uint32_t)y * 128];                                       /* get background row */
+    for (x = left; x <= right; x++)                                                              /* pack the background */
+    {
+        (void)a_ssd1351_pack_pixel(handle, image[x], &buf[(x - left) * n]);                      /* pack pixel */
+    }
+    for (i = 0; i < num; i++)                                                                    /* draw the sprites in order */
+    {
+        if ((sprite[i].visible == 0) || (y < sprite[i].y) || 
+            (y >= (int32_t)sprite[i].y + sprite[i].height))                                      /* check row */
+        {
+            continue;                                                                            /* next sprite */
+        }
+        x0 = (sprite[i].x > left) ? sprite[i].x : left;                                          /* get start */
+        x1 = (int32_t)sprite[i].x + sprite[i].width - 1;                                         /* get end */
+        x1 = (x1 < right) ? x1 : right;                                                          /* clip end */
+        image = &sprite[i].image[(uint32_t)(y - sprite[i].y) * sprite[i].width];                 /* get image row */
+        mask = NULL;                                                                             /* init NULL */
+        if (sprite[i].mask != NULL)                                                              /* if mask */
+        {
+            mask = &sprite[i].mask[(uint32_t)(y - sprite[i].y) * ((sprite[i].width + 7) / 8)];   /* get mask row */
+        }
+        for (x = x0; x <= x1; x++)                                                               /* loop the covered pixels */
+        {
+            c = x - sprite[i].x;                                                                 /* get image column */
+            if (mask != NULL)                                                                    /* if mask */
+            {
+                if ((mask[c >> 3] & (0x80 >> (c & 7))) == 0)                                     /* check mask bit */
+                {
+                    continue;                                                                    /* transparent */
+                }
+            }
+            else if (image[c] == sprite[i].key)                                                  /* check color key */
+            {
+                continue;                                                                        /* transparent */
+            }
+            (void)a_ssd1351_pack_pixel(handle, image[c], &buf[(x - left) * n]);                  /* pack pixel */
+        }
+    }
+}
+
+/**
+ * @brief     compose and send a box of the sprite layer
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @param[in] *sprite pointer to a sprite buffer
+ * @param[in] num sprite number
+ * @param[in] *box pointer to a box structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 send failed
+ *            - 2 band buffer is too small
+ * @note      the box is sent band by band or composed into the framebuffer
+ */
+static uint8_t a_ssd1351_sprite_compose(ssd1351_handle_t *handle, const ssd1351_sprite_t *sprite, uint8_t num, 
+                                        const ssd1351_box_t *box)
+{
+    uint8_t *band;
+    uint32_t row_len;
+    uint16_t rows;
+    uint8_t left, top, right, bottom;
+    uint8_t band_top;
+    uint8_t increment;
+    uint8_t n;
+    uint8_t y;
+    uint8_t res;
+    
+    left = (uint8_t)box->left;                                                                   /* get left */
+    top = (uint8_t)box->top;                                                                     /* get top */
+    right = (uint8_t)box->right;                                                                 /* get right */
+    bottom = (uint8_t)box->bottom;                                                               /* get bottom */
+    n = a_ssd1351_pixel_bytes(handle);                                                           /* get pixel bytes */
+    if (handle->fb != NULL)                                                                      /* if framebuffer */
+    {
+        if (a_ssd1351_set_window(handle, left, top, right, bottom, 
+                                 (uint32_t)(right - left + 1) * (bottom - top + 1)) != 0)        /* check and mark the box */
+        {
+            return 1;                                                                            /* return error */
+        }
+        for (y = top; y <= bottom; y++)                                                          /* compose all rows */
+        {
+            a_ssd1351_sprite_row(handle, sprite, num, y, left, right, 
+                                 &handle->fb[((uint32_t)y * 128 + left) * n]);                   /* compose row */
+        }
+        
+        return 0;                                                                                /* success return 0 */
+    }
+    row_len = (uint32_t)(right - left + 1) * n;                                                  /* get row length */
+    res = a_ssd1351_band_get(handle, row_len, &band, &rows);                                     /* get band */
+    if (res != 0)                                                                                /* check result */
+    {
+        return res;                                                                              /* return error */
+    }
+    increment = a_ssd1351_get_increment(handle);                                                 /* save address increment */
+    if (a_ssd1351_set_increment(handle, SSD1351_ADDRESS_INCREMENT_HORIZONTAL) != 0)              /* set horizontal increment */
+    {
+        return 1;                                                                                /* return error */
+    }
+    band_top = top;                                                                              /* init top */
+    for (y = top; y <= bottom; y++)                                                              /* compose all rows */
+    {
+        a_ssd1351_sprite_row(handle, sprite, num, y, left, right, 
+                             &band[(uint32_t)(y - band_top) * row_len]);                         /* compose row */
+        if ((y == bottom) || ((uint16_t)(y - band_top + 1) >= rows))                             /* if the band is full */
+        {
+            if (a_ssd1351_band_send(handle, band, left, band_top, right, y) != 0)                /* send band */
+            {
+                res = 1;                                                                         /* set error */
+                
+                break;                                                                           /* break */
+            }
+            band_top = (uint8_t)(y + 1);                                                         /* next band */
+        }
+    }
+    if (a_ssd1351_set_increment(handle, increment) != 0)                                         /* restore address increment */
+    {
+        return 1;                                                                                /* return error */
+    }
+    
+    return res;                                                                                  /* return the result */
+}
+
+/**
+ * @brief     draw a point in the display
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @param[in] x coordinate x
+ * @param[in] y coordinate y
+ * @param[in] color point color
+ * @return    status code
+ *            - 0 success
+ *            - 1 draw point failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 x is over 127
+ *            - 5 y is over 127
+ * @note      x <= 127 && y <= 127
+ */
+uint8_t ssd1351_draw_point(ssd1351_handle_t *handle, uint8_t x, uint8_t y, uint32_t color)
+{
+    if (handle == NULL)                                          /* check handle */
+    {
+        return 2;                                                /* return error */
+    }
+    if (handle->inited != 1)                                     /* check handle initialization */
+    {
+        return 3;                                                /* return error */
+    }
+    if (x > 127)                                                 /* check x */
+    {
+        handle->debug_print("ssd1351: x is over 127.\n");        /* x is over 127 */
+        
+        return 4;                                                /* return error */
+    }
+    if (y > 127)                                                 /* check y */
+    {
+        handle->debug_print("ssd1351: y is over 127.\n");        /* y is over 127 */
+        
+        return 5;                                                /* return error */
+    }
+    
+    if (handle->list_buf != NULL)                                /* if recording */
+    {
+        if (a_ssd1351_list_record(handle, SSD1351_DRAW_FILL_RECT, 
+                                  x, y, x, y, 0, color) == NULL) /* record point */
+        {
+            return 1;                                            /* return error */
+        }
+        
+        return 0;                                                /* success return 0 */
+    }
+    
+    return a_ssd1351_draw_point(handle, x, y, color);            /* draw point */
+}
+
+/**
+ * @brief     enable or disable the write combine mode
  * @param[in] *handle pointer to an ssd1351 handle structure
- * @param[in] l start line
+ * @param[in] enable bool value
  * @return    status code
  *            - 0 success
- *            - 1 set display start line failed
+ *            - 1 set write combine failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- *            - 4 line is over 127
- * @note      line <= 127
+ * @note      none
  */
-uint8_t ssd1351_set_display_start_line(ssd1351_handle_t *handle, uint8_t l)
+uint8_t ssd1351_set_write_combine(ssd1351_handle_t *handle, ssd1351_bool_t enable)
 {
-    if (handle == NULL)                                                                      /* check handle */
+    if (handle == NULL)                                          /* check handle */
     {
-        return 2;                                                                            /* return error */
+        return 2;                                                /* return error */
     }
-    if (handle->inited != 1)                                                                 /* check handle initialization */
+    if (handle->inited != 1)                                     /* check handle initialization */
     {
-        return 3;                                                                            /* return error */
+        return 3;                                                /* return error */
     }
-    if (l > 127)                                                                             /* check line */
+    
+    handle->write_combine = (uint8_t)enable;                     /* set write combine */
+    if (a_ssd1351_buffer_send(handle) != 0)                      /* flush buffer */
     {
-        handle->debug_print("ssd1351: line is over 127.\n");                                 /* line is over 127 */
+        handle->debug_print("ssd1351: write data failed.\n");    /* write data failed */
         
-        return 4;                                                                            /* return error */
+        return 1;                                                /* return error */
     }
     
-    if (a_ssd1351_write_byte(handle, SSD1351_CMD_SET_DISPLAY_START_LINE, SSD1351_CMD) != 0)  /* set display start line */
+    return 0;                                                    /* success return 0 */
+}
+
+/**
+ * @brief     flush the pending data to the display
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 flush failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t ssd1351_flush(ssd1351_handle_t *handle)
+{
+    if (handle == NULL)                                                              /* check handle */
     {
-        handle->debug_print("ssd1351: write start line failed.\n");                          /* write start line failed */
+        return 2;                                                                    /* return error */
+    }
+    if (handle->inited != 1)                                                         /* check handle initialization */
+    {
+        return 3;                                                                    /* return error */
+    }
+    
+    if (a_ssd1351_buffer_send(handle) != 0)                                          /* flush buffer */
+    {
+        handle->debug_print("ssd1351: write data failed.\n");                        /* write data failed */
         
-        return 1;                                                                            /* return error */
+        return 1;                                                                    /* return error */
     }
-    if (a_ssd1351_write_byte(handle, l, SSD1351_DATA) != 0)                                  /* set display start line */
+    if (handle->fb == NULL)                                                          /* check framebuffer */
     {
-        handle->debug_print("ssd1351: write data failed.\n");                                /* write data failed */
+        return 0;                                                                    /* success return 0 */
+    }
+    if (handle->fb_len < (uint32_t)128 * 128 * a_ssd1351_pixel_bytes(handle))        /* check framebuffer length */
+    {
+        handle->debug_print("ssd1351: framebuffer is too small.\n");                 /* framebuffer is too small */
         
-        return 1;                                                                            /* return error */
+        return 1;                                                                    /* return error */
+    }
+    if (a_ssd1351_framebuffer_flush(handle, handle->fb, handle->dirty) != 0)         /* flush framebuffer */
+    {
+        return 1;                                                                    /* return error */
     }
+    memset(handle->dirty, 0, sizeof(handle->dirty));                                 /* flag clean */
+    
+    return 0;                                                                        /* success return 0 */
+}
 
-    return 0;                                                                                /* success return 0 */
+/**
+ * @brief      get the statistics of the last framebuffer flush
+ * @param[in]  *handle pointer to an ssd1351 handle structure
+ * @param[out] *stats pointer to a flush stats structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t ssd1351_get_flush_stats(ssd1351_handle_t *handle, ssd1351_flush_stats_t *stats)
+{
+    if (handle == NULL)                                                  /* check handle */
+    {
+        return 2;                                                        /* return error */
+    }
+    if (handle->inited != 1)                                             /* check handle initialization */
+    {
+        return 3;                                                        /* return error */
+    }
+    
+    memcpy(stats, &handle->stats, sizeof(ssd1351_flush_stats_t));        /* copy stats */
+    
+    return 0;                                                            /* success return 0 */
 }
 
 /**
- * @brief     set the display offset
+ * @brief     set the shadow framebuffer
  * @param[in] *handle pointer to an ssd1351 handle structure
- * @param[in] offset display offset
+ * @param[in] *buf pointer to a framebuffer
+ * @param[in] len framebuffer length
  * @return    status code
  *            - 0 success
- *            - 1 set display offset failed
+ *            - 1 set framebuffer failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- *            - 4 offset is over 127
- * @note      offset <= 127
+ *            - 4 len is too small
+ * @note      buf == NULL disables the framebuffer
  */
-uint8_t ssd1351_set_display_offset(ssd1351_handle_t *handle, uint8_t offset)
+uint8_t ssd1351_set_framebuffer(ssd1351_handle_t *handle, uint8_t *buf, uint32_t len)
 {
-    if (handle == NULL)                                                                  /* check handle */
+    if (handle == NULL)                                                              /* check handle */
     {
-        return 2;                                                                        /* return error */
+        return 2;                                                                    /* return error */
     }
-    if (handle->inited != 1)                                                             /* check handle initialization */
+    if (handle->inited != 1)                                                         /* check handle initialization */
     {
-        return 3;                                                                        /* return error */
+        return 3;                                                                    /* return error */
     }
-    if (offset > 127)                                                                    /* check offset */
+    if ((buf != NULL) && (len < (uint32_t)128 * 128 * a_ssd1351_pixel_bytes(handle)))  /* check length */
     {
-        handle->debug_print("ssd1351: offset is over 127.\n");                           /* offset is over 127 */
+        handle->debug_print("ssd1351: len is too small.\n");                         /* len is too small */
         
-        return 4;                                                                        /* return error */
+        return 4;                                                                    /* return error */
     }
-  
-    if (a_ssd1351_write_byte(handle, SSD1351_CMD_SET_DISPLAY_OFFSET, SSD1351_CMD) != 0)  /* set display offset */ 
+    
+    if (a_ssd1351_buffer_send(handle) != 0)                                          /* flush buffer */
     {
-        handle->debug_print("ssd1351: write display offset failed.\n");                  /* write display offset failed */
+        handle->debug_print("ssd1351: write data failed.\n");                        /* write data failed */
         
-        return 1;                                                                        /* return error */
+        return 1;                                                                    /* return error */
     }
-    if (a_ssd1351_write_byte(handle, offset, SSD1351_DATA) != 0)                         /* set display offset */
+    handle->fb = buf;                                                                /* set framebuffer */
+    handle->fb_len = len;                                                            /* set framebuffer length */
+    handle->fb_increment = handle->conf_1 & 0x01;                                    /* follow the panel increment */
+    memset(handle->dirty, 0, sizeof(handle->dirty));                                 /* flag clean */
+    if (buf != NULL)                                                                 /* if enable */
     {
-        handle->debug_print("ssd1351: write data failed.\n");                            /* write data failed */
-        
-        return 1;                                                                        /* return error */
+        a_ssd1351_framebuffer_mark(handle, 0, 0, 127, 127);                          /* mark all */
     }
-
-    return 0;                                                                            /* success return 0 */
+    
+    return 0;                                                                        /* success return 0 */
 }
 
 /**
- * @brief     set the display mode
+ * @brief     set the glyph cache
  * @param[in] *handle pointer to an ssd1351 handle structure
- * @param[in] mode display mode
+ * @param[in] *buf pointer to a glyph cache buffer
+ * @param[in] len glyph cache buffer length
  * @return    status code
  *            - 0 success
- *            - 1 set display mode failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- * @note      none
+ *            - 4 len is too small
+ * @note      buf == NULL disables the glyph cache, len is the memory budget and holds
+ *            len / (sizeof(ssd1351_glyph_entry_t) + SSD1351_GLYPH_CACHE_SLOT_SIZE) glyphs
+ *            ssd1351_write_string_opaque keeps the packed glyphs keyed by font, colors and color format
+ *            and evicts the least recently used glyph when the cache is full
  */
-uint8_t ssd1351_set_display_mode(ssd1351_handle_t *handle, ssd1351_display_mode_t mode)
+uint8_t ssd1351_set_glyph_cache(ssd1351_handle_t *handle, uint8_t *buf, uint32_t len)
 {
-    if (handle == NULL)                                                      /* check handle */
+    uint32_t offset;
+    uint32_t num;
+    
+    if (handle == NULL)                                                                    /* check handle */
     {
-        return 2;                                                            /* return error */
+        return 2;                                                                          /* return error */
     }
-    if (handle->inited != 1)                                                 /* check handle initialization */
+    if (handle->inited != 1)                                                               /* check handle initialization */
     {
-        return 3;                                                            /* return error */
+        return 3;                                                                          /* return error */
+    }
+    
+    handle->glyph_entry = NULL;                                                            /* clear entries */
+    handle->glyph_data = NULL;                                                             /* clear slots */
+    handle->glyph_num = 0;                                                                 /* clear number */
+    handle->glyph_stamp = 0;                                                               /* clear stamp */
+    if (buf == NULL)                                                                       /* if disable */
+    {
+        return 0;                                                                          /* success return 0 */
+    }
+    offset = (uint32_t)((sizeof(uint32_t) - ((uintptr_t)buf % sizeof(uint32_t))) % 
+                        sizeof(uint32_t));                                                 /* align the entries */
+    num = (len > offset) ? 
+          ((len - offset) / (sizeof(ssd1351_glyph_entry_t) + SSD1351_GLYPH_CACHE_SLOT_SIZE)) : 0;  /* get slot number */
+    if (num == 0)                                                                          /* check slot number */
+    {
+        handle->debug_print("ssd1351: len is too small.\n");                               /* len is too small */
+        
+        return 4;                                                                          /* return error */
+    }
+    if (num > 0xFFFFU)                                                                     /* check max */
+    {
+        num = 0xFFFFU;                                                                     /* set max */
     }
+    handle->glyph_entry = (ssd1351_glyph_entry_t *)(buf + offset);                         /* set entries */
+    handle->glyph_data = buf + offset + num * sizeof(ssd1351_glyph_entry_t);               /* set slots */
+    memset(handle->glyph_entry, 0, num * sizeof(ssd1351_glyph_entry_t));                   /* flag empty */
+    handle->glyph_num = (uint16_t)num;                                                     /* set number */
+    
+    return 0;                                                                              /* success return 0 */
+}
 
-    if (a_ssd1351_write_byte(handle, mode, SSD1351_CMD) != 0)                /* set display mode */
+/**
+ * @brief      swap the shadow framebuffer
+ * @param[in]  *handle pointer to an ssd1351 handle structure
+ * @param[in]  *buf pointer to the next framebuffer
+ * @param[out] *dirty pointer to a dirty tile bitmap buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 framebuffer is not enabled
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 buf or dirty is NULL
+ *             - 5 buf is the current framebuffer
+ * @note       none
+ */
+uint8_t ssd1351_swap_framebuffer(ssd1351_handle_t *handle, uint8_t *buf, uint16_t dirty[16])
+{
+    uint8_t bytes;
+    uint8_t i;
+    uint8_t j;
+    uint8_t k;
+    uint32_t offset;
+    
+    if (handle == NULL)                                                                      /* check handle */
     {
-        handle->debug_print("ssd1351: write display mode failed.\n");        /* write display mode failed */
+        return 2;                                                                            /* return error */
+    }
+    if (handle->inited != 1)                                                                 /* check handle initialization */
+    {
+        return 3;                                                                            /* return error */
+    }
+    if (handle->fb == NULL)                                                                  /* check framebuffer */
+    {
+        handle->debug_print("ssd1351: framebuffer is not enabled.\n");                       /* framebuffer is not enabled */
         
-        return 1;                                                            /* return error */
+        return 1;                                                                            /* return error */
+    }
+    if ((buf == NULL) || (dirty == NULL))                                                    /* check buf and dirty */
+    {
+        handle->debug_print("ssd1351: buf or dirty is NULL.\n");                             /* buf or dirty is NULL */
+        
+        return 4;                                                                            /* return error */
+    }
+    if (buf == handle->fb)                                                                   /* check buf */
+    {
+        handle->debug_print("ssd1351: buf is the current framebuffer.\n");                   /* buf is the current framebuffer */
+        
+        return 5;                                                                            /* return error */
     }
     
-    return 0;                                                                /* success return 0 */
+    bytes = a_ssd1351_pixel_bytes(handle);                                                   /* get pixel bytes */
+    for (i = 0; i < SSD1351_TILE_NUM; i++)                                                   /* loop tile rows */
+    {
+        j = 0;                                                                               /* init 0 */
+        while (j < SSD1351_TILE_NUM)                                                         /* loop tile columns */
+        {
+            if ((handle->dirty[i] & (1U << j)) == 0)                                         /* check tile */
+            {
+                j++;                                                                         /* next tile */
+                
+                continue;                                                                    /* continue */
+            }
+            k = j;                                                                           /* run start */
+            while ((j < SSD1351_TILE_NUM) && ((handle->dirty[i] & (1U << j)) != 0))          /* find run end */
+            {
+                j++;                                                                         /* next tile */
+            }
+            for (offset = 0; offset < SSD1351_TILE_SIZE; offset++)                           /* copy the run */
+            {
+                memcpy(&buf[(((uint32_t)i * SSD1351_TILE_SIZE + offset) * 128 + 
+                             (uint32_t)k * SSD1351_TILE_SIZE) * bytes], 
+                       &handle->fb[(((uint32_t)i * SSD1351_TILE_SIZE + offset) * 128 + 
+                                    (uint32_t)k * SSD1351_TILE_SIZE) * bytes], 
+                       (uint32_t)(j - k) * SSD1351_TILE_SIZE * bytes);                       /* copy row */
+            }
+        }
+    }
+    memcpy(dirty, handle->dirty, sizeof(handle->dirty));                                     /* output dirty tiles */
+    memset(handle->dirty, 0, sizeof(handle->dirty));                                         /* flag clean */
+    handle->fb = buf;                                                                        /* set framebuffer */
+    
+    return 0;                                                                                /* success return 0 */
 }
 
 /**
- * @brief     set the select vdd
+ * @brief     send the dirty tiles of a framebuffer
  * @param[in] *handle pointer to an ssd1351 handle structure
- * @param[in] vdd chip vdd
+ * @param[in] *buf pointer to a framebuffer
+ * @param[in] *dirty pointer to a dirty tile bitmap
  * @return    status code
  *            - 0 success
- *            - 1 set select vdd failed
+ *            - 1 flush failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- * @note      none
+ * @note      buf has the same layout as the shadow framebuffer and the handle framebuffer is not touched,
+ *            only the bus state of the handle is used, which is the inner buffer, the dc level,
+ *            the gram window cache and the flush stats, so another thread can flush through a copy of the handle
  */
-uint8_t ssd1351_set_select_vdd(ssd1351_handle_t *handle, ssd1351_select_vdd_t vdd)
+uint8_t ssd1351_flush_framebuffer(ssd1351_handle_t *handle, const uint8_t *buf, const uint16_t dirty[16])
 {
-    if (handle == NULL)                                                                  /* check handle */
+    if (handle == NULL)                                                              /* check handle */
     {
-        return 2;                                                                        /* return error */
+        return 2;                                                                    /* return error */
     }
-    if (handle->inited != 1)                                                             /* check handle initialization */
+    if (handle->inited != 1)                                                         /* check handle initialization */
     {
-        return 3;                                                                        /* return error */
+        return 3;                                                                    /* return error */
+    }
+    
+    if (a_ssd1351_buffer_send(handle) != 0)                                          /* flush buffer */
+    {
+        handle->debug_print("ssd1351: write data failed.\n");                        /* write data failed */
+        
+        return 1;                                                                    /* return error */
+    }
+    if (a_ssd1351_framebuffer_flush(handle, buf, dirty) != 0)                        /* flush framebuffer */
+    {
+        return 1;                                                                    /* return error */
     }
+    
+    return 0;                                                                        /* success return 0 */
+}
 
-    handle->conf_2 &= ~ (1 << 0);                                                        /* clear config */
-    handle->conf_2 |= vdd << 0;                                                          /* set vdd */
-    if (a_ssd1351_write_byte(handle, SSD1351_CMD_FUNCTION_SELECTION, SSD1351_CMD) != 0)  /* set select vdd */
+/**
+ * @brief     write a string in the display
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @param[in] x coordinate x
+ * @param[in] y coordinate y
+ * @param[in] *str pointer to a written string address
+ * @param[in] len length of the string
+ * @param[in] color display color
+ * @param[in] font string font
+ * @return    status code
+ *            - 0 success
+ *            - 1 draw point failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 x or y is invalid
+ * @note      x <= 127 && y <= 127
+ */
+uint8_t ssd1351_write_string(ssd1351_handle_t *handle, uint8_t x, uint8_t y, const char *str, uint16_t len, uint32_t color, ssd1351_font_t font)
+{    
+    if (handle == NULL)                                                      /* check handle */
+    {
+        return 2;                                                            /* return error */
+    }
+    if (handle->inited != 1)                                                 /* check handle initialization */
+    {
+        return 3;                                                            /* return error */
+    }
+    if((x > 127) || (y > 127))                                               /* check x, y */
     {
-        handle->debug_print("ssd1351: write function selection failed.\n");              /* write function selection failed */
+        handle->debug_print("ssd1351: x or y is invalid.\n");                /* x or y is invalid */
         
-        return 1;                                                                        /* return error */
+        return 4;                                                            /* return error */
     }
-    if (a_ssd1351_write_byte(handle, handle->conf_2, SSD1351_DATA) != 0)                 /* set select vdd */
+    
+    if (handle->list_buf != NULL)                                            /* if recording */
     {
-        handle->debug_print("ssd1351: write function selection failed.\n");              /* write function selection failed */
-        
-        return 1;                                                                        /* return error */
+        return a_ssd1351_list_record_string(handle, SSD1351_DRAW_STRING, x, y, str, len, 
+                                            color, 0, (uint8_t)font);        /* record string */
     }
     
-    return 0;                                                                            /* success return 0 */
+    return a_ssd1351_write_string(handle, x, y, str, len, color, (uint8_t)font, NULL);  /* write string */
 }
 
 /**
- * @brief     set the interface parallel bits
+ * @brief     write an opaque string in the display
  * @param[in] *handle pointer to an ssd1351 handle structure
- * @param[in] parallel_bits interface parallel bits
+ * @param[in] x coordinate x
+ * @param[in] y coordinate y
+ * @param[in] *str pointer to a written string address
+ * @param[in] len length of the string
+ * @param[in] color display color
+ * @param[in] background background color
+ * @param[in] font string font
  * @return    status code
  *            - 0 success
- *            - 1 set parallel bits failed
+ *            - 1 write string failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- * @note      none
+ *            - 4 x or y is invalid
+ * @note      x <= 127 && y <= 127
+ *            the string wraps like ssd1351_write_string and every char cell is filled,
+ *            each line is sent as one burst with the vertical address increment and
+ *            the address increment is restored at the end
  */
-uint8_t ssd1351_set_parallel_bits(ssd1351_handle_t *handle, ssd1351_select_parallel_bits_t parallel_bits)
+uint8_t ssd1351_write_string_opaque(ssd1351_handle_t *handle, uint8_t x, uint8_t y, const char *str, uint16_t len, 
+                                    uint32_t color, uint32_t background, ssd1351_font_t font)
 {
-    if (handle == NULL)                                                                  /* check handle */
+    if (handle == NULL)                                                            /* check handle */
     {
-        return 2;                                                                        /* return error */
+        return 2;                                                                  /* return error */
     }
-    if (handle->inited != 1)                                                             /* check handle initialization */
+    if (handle->inited != 1)                                                       /* check handle initialization */
     {
-        return 3;                                                                        /* return error */
+        return 3;                                                                  /* return error */
     }
-
-    handle->conf_2 &= ~ (3 << 6);                                                        /* clear config */
-    handle->conf_2 |= parallel_bits << 6;                                                /* set bits */
-    if (a_ssd1351_write_byte(handle, SSD1351_CMD_FUNCTION_SELECTION, SSD1351_CMD) != 0)  /* set parallel bits */
+    if((x > 127) || (y > 127))                                                     /* check x, y */
     {
-        handle->debug_print("ssd1351: write parallel bits failed.\n");                   /* write parallel bits failed */
+        handle->debug_print("ssd1351: x or y is invalid.\n");                      /* x or y is invalid */
         
-        return 1;                                                                        /* return error */
+        return 4;                                                                  /* return error */
     }
-    if (a_ssd1351_write_byte(handle, handle->conf_2, SSD1351_DATA) != 0)                 /* set parallel bits */
+    
+    if (handle->list_buf != NULL)                                                  /* if recording */
     {
-        handle->debug_print("ssd1351: write parallel bits failed.\n");                   /* write parallel bits failed */
-        
-        return 1;                                                                        /* return error */
+        return a_ssd1351_list_record_string(handle, SSD1351_DRAW_STRING_OPAQUE, x, y, str, len, 
+                                            color, background, (uint8_t)font);     /* record string */
     }
     
-    return 0;                                                                            /* success return 0 */
+    return a_ssd1351_write_string_opaque(handle, x, y, str, len, color, background, 
+                                         (uint8_t)font, NULL);                    /* write string */
 }
 
 /**
- * @brief     set the sleep mode
+ * @brief     write a string in a packed font
  * @param[in] *handle pointer to an ssd1351 handle structure
- * @param[in] enable bool value
+ * @param[in] x coordinate x
+ * @param[in] y coordinate y
+ * @param[in] *str pointer to a written string address
+ * @param[in] len length of the string
+ * @param[in] color display color
+ * @param[in] *font pointer to a packed font
  * @return    status code
  *            - 0 success
- *            - 1 set sleep mode failed
+ *            - 1 write string failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- * @note      none
+ *            - 4 x or y is invalid
+ *            - 5 font is invalid
+ * @note      x <= 127 && y <= 127 && font->width <= 32 && font->height <= 32
+ *            the string stops at the first char that is not in the font
  */
-uint8_t ssd1351_set_sleep_mode(ssd1351_handle_t *handle, ssd1351_bool_t enable)
+uint8_t ssd1351_write_string_packed(ssd1351_handle_t *handle, uint8_t x, uint8_t y, const char *str, uint16_t len, 
+                                    uint32_t color, const ssd1351_packed_font_t *font)
 {
-    if (handle == NULL)                                                                      /* check handle */
-    {
-        return 2;                                                                            /* return error */
-    }
-    if (handle->inited != 1)                                                                 /* check handle initialization */
+    if (handle == NULL)                                                            /* check handle */
     {
-        return 3;                                                                            /* return error */
+        return 2;                                                                  /* return error */
     }
-    
-    if (enable == SSD1351_BOOL_TRUE)                                                         /* if sleep mode on */
+    if (handle->inited != 1)                                                       /* check handle initialization */
     {
-        if (a_ssd1351_write_byte(handle, SSD1351_CMD_SET_SLEEP_MODE_ON, SSD1351_CMD) != 0)   /* set sleep mode on */
-        {
-            handle->debug_print("ssd1351: set sleep mode on failed.\n");                     /* set sleep mode on failed */
-            
-            return 1;                                                                        /* return error */
-        }
-        
-        return 0;                                                                            /* success return 0 */
+        return 3;                                                                  /* return error */
     }
-    else if (enable == SSD1351_BOOL_FALSE)                                                   /* if sleep mode off */
+    if((x > 127) || (y > 127))                                                     /* check x, y */
     {
-        if (a_ssd1351_write_byte(handle, SSD1351_CMD_SET_SLEEP_MODE_OFF, SSD1351_CMD) != 0)  /* set sleep mode off */ 
-        {
-            handle->debug_print("ssd1351: set sleep mode off failed.\n");                    /* set sleep mode off failed */
-            
-            return 1;                                                                        /* return error */
-        }
+        handle->debug_print("ssd1351: x or y is invalid.\n");                      /* x or y is invalid */
         
-        return 0;                                                                            /* success return 0 */
+        return 4;                                                                  /* return error */
     }
-    else
+    if (a_ssd1351_check_packed_font(handle, font) != 0)                            /* check font */
     {
-        handle->debug_print("ssd1351: param is invalid.\n");                                 /* param is invalid */
-        
-        return 1;                                                                            /* return error */
+        return 5;                                                                  /* return error */
     }
+    
+    return a_ssd1351_write_string(handle, x, y, str, len, color, 0, font);         /* write string */
 }
 
 /**
- * @brief     set the phase period
+ * @brief     write an opaque string in a packed font
  * @param[in] *handle pointer to an ssd1351 handle structure
- * @param[in] phase1_period phase 1 period
- * @param[in] phase2_period phase 2 period
+ * @param[in] x coordinate x
+ * @param[in] y coordinate y
+ * @param[in] *str pointer to a written string address
+ * @param[in] len length of the string
+ * @param[in] color display color
+ * @param[in] background background color
+ * @param[in] *font pointer to a packed font
  * @return    status code
  *            - 0 success
- *            - 1 set phase period failed
+ *            - 1 write string failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- *            - 4 phase1_period is less than 2
- *            - 5 phase1_period is over 15
- *            - 6 phase2_period is less than 3
- *            - 7 phase2_period is over 15
- * @note      2 <= phase1_period <=15 && 3 <= phase2_period <= 15
+ *            - 4 x or y is invalid
+ *            - 5 font is invalid
+ * @note      x <= 127 && y <= 127 && font->width <= 32 && font->height <= 32
+ *            the string stops at the first char that is not in the font
  */
-uint8_t ssd1351_set_phase_period(ssd1351_handle_t *handle, uint8_t phase1_period, uint8_t phase2_period)
+uint8_t ssd1351_write_string_packed_opaque(ssd1351_handle_t *handle, uint8_t x, uint8_t y, const char *str, uint16_t len, 
+                                           uint32_t color, uint32_t background, const ssd1351_packed_font_t *font)
 {
-    if (handle == NULL)                                                                           /* check handle */
-    {
-        return 2;                                                                                 /* return error */
-    }
-    if (handle->inited != 1)                                                                      /* check handle initialization */
-    {
-        return 3;                                                                                 /* return error */
-    }
-    if (phase1_period < 2)                                                                        /* check phase1 */
-    {
-        handle->debug_print("ssd1351: phase1_period is less than 2.\n");                          /* phase1_period is less than 2 */
-        
-        return 4;                                                                                 /* return error */
-    }
-    if (phase1_period > 15)                                                                       /* check phase1 */
-    {
-        handle->debug_print("ssd1351: phase1_period is over 15.\n");                              /* phase1_period is over 15 */
-        
-        return 5;                                                                                 /* return error */
-    }
-    if (phase2_period < 3)                                                                        /* check phase2 */
+    if (handle == NULL)                                                            /* check handle */
     {
-        handle->debug_print("ssd1351: phase2_period is less than 3.\n");                          /* phase2_period is less than 3 */
-        
-        return 6;                                                                                 /* return error */
+        return 2;                                                                  /* return error */
     }
-    if (phase2_period > 15)                                                                       /* check phase2 */
+    if (handle->inited != 1)                                                       /* check handle initialization */
     {
-        handle->debug_print("ssd1351: phase2_period is over 15.\n");                              /* phase2_period is over 15 */
-        
-        return 7;                                                                                 /* return error */
+        return 3;                                                                  /* return error */
     }
-
-    if (a_ssd1351_write_byte(handle, SSD1351_CMD_SET_RESET_PRE_CHARGE_PERIOD, SSD1351_CMD) != 0)  /* set reset pre charge period */
+    if((x > 127) || (y > 127))                                                     /* check x, y */
     {
-        handle->debug_print("ssd1351: write reset pre charge period failed.\n");                  /* write reset pre-charge period failed */
+        handle->debug_print("ssd1351: x or y is invalid.\n");                      /* x or y is invalid */
         
-        return 1;                                                                                 /* return error */
+        return 4;                                                                  /* return error */
     }
-    if (a_ssd1351_write_byte(handle, (phase2_period << 4) | phase1_period, SSD1351_DATA) != 0)    /* set phase period */
+    if (a_ssd1351_check_packed_font(handle, font) != 0)                            /* check font */
     {
-        handle->debug_print("ssd1351: write reset pre charge period failed.\n");                  /* write reset pre-charge period failed */
-        
-        return 1;                                                                                 /* return error */
+        return 5;                                                                  /* return error */
     }
     
-    return 0;                                                                                     /* success return 0 */
+    return a_ssd1351_write_string_opaque(handle, x, y, str, len, color, background, 0, font);  /* write string */
 }
 
 /**
- * @brief     set the front clock oscillator frequency
+ * @brief     fill the rect
  * @param[in] *handle pointer to an ssd1351 handle structure
- * @param[in] d clock div
- * @param[in] frequency clock frequency
+ * @param[in] left left coordinate x
+ * @param[in] top top coordinate y
+ * @param[in] right right coordinate x
+ * @param[in] bottom bottom coordinate y
+ * @param[in] color display color
  * @return    status code
  *            - 0 success
- *            - 1 set front clock oscillator frequency failed
+ *            - 1 fill rect failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- *            - 4 div is over 11
- *            - 5 frequency is over 15
- * @note      div < 11 && frequency <= 15
+ *            - 4 left is over 127
+ *            - 5 right is over 127
+ *            - 6 left > right
+ *            - 7 top is over 127
+ *            - 8 bottom is over 127
+ *            - 9 top > bottom
+ * @note      left <= 127 && right <= 127 && left <= right && top <= 127 && bottom <= 127 && top <= bottom
  */
-uint8_t ssd1351_set_front_clock_oscillator_frequency(ssd1351_handle_t *handle, uint8_t d, uint8_t frequency)
+uint8_t ssd1351_fill_rect(ssd1351_handle_t *handle, uint8_t left, uint8_t top, uint8_t right, uint8_t bottom, uint32_t color)
 {
-    if (handle == NULL)                                                                            /* check handle */
+    if (handle == NULL)                                                        /* check handle */
     {
-        return 2;                                                                                  /* return error */
+        return 2;                                                              /* return error */
     }
-    if (handle->inited != 1)                                                                       /* check handle initialization */
+    if (handle->inited != 1)                                                   /* check handle initialization */
     {
-        return 3;                                                                                  /* return error */
+        return 3;                                                              /* return error */
     }
-    if (d >= 11)                                                                                   /* check div */
+    if (left > 127)                                                            /* check left */
     {
-        handle->debug_print("ssd1351: div is over 11.\n");                                         /* div is over 11 */
+        handle->debug_print("ssd1351: left is over 127.\n");                   /* left is over 127 */
         
-        return 4;                                                                                  /* return error */
+        return 4;                                                              /* return error */
     }
-    if (frequency > 15)                                                                            /* check frequency */
+    if (right > 127)                                                           /* check right */
     {
-        handle->debug_print("ssd1351: frequency is over 15.\n");                                   /* frequency is over 15 */
+        handle->debug_print("ssd1351: right is over 127.\n");                  /* right is over 127 */
         
-        return 5;                                                                                  /* return error */
+        return 5;                                                              /* return error */
     }
-    
-    if (a_ssd1351_write_byte(handle, SSD1351_CMD_FRONT_CLOCK_DIVIDER_OSC_FREQ, SSD1351_CMD) != 0)  /* set front clock divider osc freq */
+    if (left > right)                                                          /* check left and right */
     {
-        handle->debug_print("ssd1351: write front clock divider osc freq failed.\n");              /* write front clock divider osc freq failed */
+        handle->debug_print("ssd1351: left > right.\n");                       /* left > right */
         
-        return 1;                                                                                  /* return error */
+        return 6;                                                              /* return error */
     }
-    if (a_ssd1351_write_byte(handle, (frequency << 4) | d, SSD1351_DATA) != 0)                     /* set front clock divider osc freq */
+    if (top > 127)                                                             /* check top */
     {
-        handle->debug_print("ssd1351: write front clock divider osc freq failed.\n");              /* write front clock divider osc freq failed */
+        handle->debug_print("ssd1351: top is over 127.\n");                    /* top is over 127 */
         
-        return 1;                                                                                  /* return error */
+        return 7;                                                              /* return error */
+    }
+    if (bottom > 127)                                                          /* check bottom */
+    {
+        handle->debug_print("ssd1351: bottom is over 127.\n");                 /* bottom is over 127 */
+        
+        return 8;                                                              /* return error */
+    }
+    if (top > bottom)                                                          /* check top and bottom */
+    {
+        handle->debug_print("ssd1351: top > bottom.\n");                       /* top > bottom */
+        
+        return 9;                                                              /* return error */
     }
     
-    return 0;                                                                                      /* success return 0 */
+    if (handle->list_buf != NULL)                                              /* if recording */
+    {
+        if (a_ssd1351_list_record(handle, SSD1351_DRAW_FILL_RECT, 
+                                  left, top, right, bottom, 0, color) == NULL) /* record fill rect */
+        {
+            return 1;                                                          /* return error */
+        }
+        
+        return 0;                                                              /* success return 0 */
+    }
+    
+    return a_ssd1351_fill_rect(handle, left, top, right, bottom, color);       /* fill rect */
 }
 
 /**
- * @brief     set the segment low voltage
+ * @brief     draw a line
  * @param[in] *handle pointer to an ssd1351 handle structure
- * @param[in] segment segment low voltage
+ * @param[in] x0 coordinate x of the first point
+ * @param[in] y0 coordinate y of the first point
+ * @param[in] x1 coordinate x of the second point
+ * @param[in] y1 coordinate y of the second point
+ * @param[in] color display color
  * @return    status code
  *            - 0 success
- *            - 1 set segment low voltage failed
+ *            - 1 draw line failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- * @note      none
+ *            - 4 x or y is invalid
+ * @note      x0 <= 127 && y0 <= 127 && x1 <= 127 && y1 <= 127
+ *            the pixels of one row or column are sent as one window and burst
  */
-uint8_t ssd1351_set_segment_low_voltage(ssd1351_handle_t *handle, ssd1351_segment_low_voltage_t segment)
+uint8_t ssd1351_draw_line(ssd1351_handle_t *handle, uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1, uint32_t color)
 {
-    if (handle == NULL)                                                                       /* check handle */
-    {
-        return 2;                                                                             /* return error */
-    }
-    if (handle->inited != 1)                                                                  /* check handle initialization */
+    if (handle == NULL)                                                        /* check handle */
     {
-        return 3;                                                                             /* return error */
+        return 2;                                                              /* return error */
     }
-    
-    if (a_ssd1351_write_byte(handle, SSD1351_CMD_SET_SEGMENT_LOW_VOLTAGE, SSD1351_CMD) != 0)  /* set segment low voltage */
+    if (handle->inited != 1)                                                   /* check handle initialization */
     {
-        handle->debug_print("ssd1351: write segment low voltage failed.\n");                  /* write segment low voltage failed */
-        
-        return 1;                                                                             /* return error */
+        return 3;                                                              /* return error */
     }
-    if (a_ssd1351_write_byte(handle, (uint8_t)(0xA0 | segment), SSD1351_DATA) != 0)           /* set segment low voltage */
+    if ((x0 > 127) || (y0 > 127) || (x1 > 127) || (y1 > 127))                  /* check x, y */
     {
-        handle->debug_print("ssd1351: write segment low voltage failed.\n");                  /* write segment low voltage failed */
+        handle->debug_print("ssd1351: x or y is invalid.\n");                  /* x or y is invalid */
         
-        return 1;                                                                             /* return error */
+        return 4;                                                              /* return error */
     }
-    if (a_ssd1351_write_byte(handle, 0xB5, SSD1351_DATA) != 0)                                /* set segment low voltage */
+    
+    if (handle->list_buf != NULL)                                              /* if recording */
     {
-        handle->debug_print("ssd1351: write segment low voltage failed.\n");                  /* write segment low voltage failed */
+        if (a_ssd1351_list_record(handle, SSD1351_DRAW_LINE, 
+                                  x0, y0, x1, y1, 0, color) == NULL)           /* record line */
+        {
+            return 1;                                                          /* return error */
+        }
         
-        return 1;                                                                             /* return error */
+        return 0;                                                              /* success return 0 */
     }
-    if (a_ssd1351_write_byte(handle, 0x55, SSD1351_DATA) != 0)                                /* set segment low voltage */
+    
+    if (a_ssd1351_draw_line(handle, x0, y0, x1, y1, color) != 0)               /* draw line */
     {
-        handle->debug_print("ssd1351: write segment low voltage failed.\n");                  /* write segment low voltage failed */
-        
-        return 1;                                                                             /* return error */
+        return 1;                                                              /* return error */
     }
-        
-    return 0;                                                                                 /* success return 0 */
+    
+    return a_ssd1351_shape_end(handle);                                        /* flush buffer */
 }
 
 /**
- * @brief     set the gpio pin
+ * @brief     draw a circle
  * @param[in] *handle pointer to an ssd1351 handle structure
- * @param[in] gpio0 gpio 0 pin
- * @param[in] gpio1 gpio 1 pin
+ * @param[in] x center coordinate x
+ * @param[in] y center coordinate y
+ * @param[in] r radius
+ * @param[in] color display color
  * @return    status code
  *            - 0 success
- *            - 1 set gpio failed
+ *            - 1 draw circle failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- * @note      none
+ *            - 4 x or y is invalid
+ * @note      x <= 127 && y <= 127
+ *            the circle is clipped to the display
  */
-uint8_t ssd1351_set_gpio(ssd1351_handle_t *handle, ssd1351_gpio_pin_t gpio0, ssd1351_gpio_pin_t gpio1)
+uint8_t ssd1351_draw_circle(ssd1351_handle_t *handle, uint8_t x, uint8_t y, uint8_t r, uint32_t color)
 {
     if (handle == NULL)                                                        /* check handle */
     {
@@ -986,1756 +6732,1276 @@ uint8_t ssd1351_set_gpio(ssd1351_handle_t *handle, ssd1351_gpio_pin_t gpio0, ssd
     {
         return 3;                                                              /* return error */
     }
-    
-    if (a_ssd1351_write_byte(handle, SSD1351_CMD_SET_GPIO, SSD1351_CMD) != 0)  /* set gpio */
+    if ((x > 127) || (y > 127))                                                /* check x, y */
     {
-        handle->debug_print("ssd1351: write gpio failed.\n");                  /* write gpio failed */
+        handle->debug_print("ssd1351: x or y is invalid.\n");                  /* x or y is invalid */
         
-        return 1;                                                              /* return error */
+        return 4;                                                              /* return error */
     }
-    if (a_ssd1351_write_byte(handle, 
-                            (uint8_t)((gpio1 << 2) | gpio0),
-                             SSD1351_DATA) != 0)                               /* set gpio */
+    
+    if (handle->list_buf != NULL)                                              /* if recording */
     {
-        handle->debug_print("ssd1351: write gpio failed.\n");                  /* write gpio failed */
+        if (a_ssd1351_list_record(handle, SSD1351_DRAW_CIRCLE, 
+                                  x, y, 0, 0, r, color) == NULL)               /* record circle */
+        {
+            return 1;                                                          /* return error */
+        }
         
+        return 0;                                                              /* success return 0 */
+    }
+    
+    if (a_ssd1351_draw_round(handle, x, y, r, 0, 0, NULL, color) != 0)         /* draw circle */
+    {
         return 1;                                                              /* return error */
     }
     
-    return 0;                                                                  /* success return 0 */
+    return a_ssd1351_shape_end(handle);                                        /* flush buffer */
 }
 
 /**
- * @brief     set the second pre charge period
+ * @brief     fill a circle
  * @param[in] *handle pointer to an ssd1351 handle structure
- * @param[in] period pre charge period
+ * @param[in] x center coordinate x
+ * @param[in] y center coordinate y
+ * @param[in] r radius
+ * @param[in] color display color
  * @return    status code
  *            - 0 success
- *            - 1 set second pre charge period failed
+ *            - 1 fill circle failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- *            - 4 period is over 15
- * @note      none
+ *            - 4 x or y is invalid
+ * @note      x <= 127 && y <= 127
+ *            the circle is clipped to the display
  */
-uint8_t ssd1351_set_second_pre_charge_period(ssd1351_handle_t *handle, uint8_t period)
+uint8_t ssd1351_fill_circle(ssd1351_handle_t *handle, uint8_t x, uint8_t y, uint8_t r, uint32_t color)
 {
-    if (handle == NULL)                                                                            /* check handle */
+    if (handle == NULL)                                                        /* check handle */
     {
-        return 2;                                                                                  /* return error */
+        return 2;                                                              /* return error */
     }
-    if (handle->inited != 1)                                                                       /* check handle initialization */
+    if (handle->inited != 1)                                                   /* check handle initialization */
     {
-        return 3;                                                                                  /* return error */
+        return 3;                                                              /* return error */
     }
-    if (period > 15)                                                                               /* check period */
+    if ((x > 127) || (y > 127))                                                /* check x, y */
     {
-        handle->debug_print("ssd1351: period is over 15.\n");                                      /* period is over 15 */
+        handle->debug_print("ssd1351: x or y is invalid.\n");                  /* x or y is invalid */
         
-        return 4;                                                                                  /* return error */
+        return 4;                                                              /* return error */
     }
     
-    if (a_ssd1351_write_byte(handle, SSD1351_CMD_SET_SECOND_PRE_CHARGE_PERIOD, SSD1351_CMD) != 0)  /* set second pre-charge period */
+    if (handle->list_buf != NULL)                                              /* if recording */
     {
-        handle->debug_print("ssd1351: write second pre charge period failed.\n");                  /* write second pre-charge period failed */
+        if (a_ssd1351_list_record(handle, SSD1351_DRAW_FILL_CIRCLE, 
+                                  x, y, 0, 0, r, color) == NULL)               /* record filled circle */
+        {
+            return 1;                                                          /* return error */
+        }
         
-        return 1;                                                                                  /* return error */
+        return 0;                                                              /* success return 0 */
     }
-    if (a_ssd1351_write_byte(handle, period, SSD1351_DATA) != 0)                                   /* set second pre-charge period */
+    
+    if (a_ssd1351_fill_round(handle, x, y, r, 0, 0, color) != 0)               /* fill circle */
     {
-        handle->debug_print("ssd1351: write second pre charge period failed.\n");                  /* write second pre-charge period failed */
-        
-        return 1;                                                                                  /* return error */
+        return 1;                                                              /* return error */
     }
     
-    return 0;                                                                                      /* success return 0 */
+    return a_ssd1351_shape_end(handle);                                        /* flush buffer */
 }
 
 /**
- * @brief     set the gray scale pulse width
+ * @brief     draw an arc
  * @param[in] *handle pointer to an ssd1351 handle structure
- * @param[in] *gamma pointer to a gamma table buffer
+ * @param[in] x center coordinate x
+ * @param[in] y center coordinate y
+ * @param[in] r radius
+ * @param[in] start_angle start angle in degrees
+ * @param[in] end_angle end angle in degrees
+ * @param[in] color display color
  * @return    status code
  *            - 0 success
- *            - 1 set gray scale pulse width failed
+ *            - 1 draw arc failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- * @note      none
+ *            - 4 x or y is invalid
+ *            - 5 angle is over 360
+ * @note      x <= 127 && y <= 127 && start_angle <= 360 && end_angle <= 360
+ *            0 degree points to the right and the arc runs clockwise from start_angle to end_angle,
+ *            the arc is clipped to the display
  */
-uint8_t ssd1351_set_gray_scale_pulse_width(ssd1351_handle_t *handle, uint8_t gamma[63])
+uint8_t ssd1351_draw_arc(ssd1351_handle_t *handle, uint8_t x, uint8_t y, uint8_t r, 
+                         uint16_t start_angle, uint16_t end_angle, uint32_t color)
 {
-    uint8_t i;
+    ssd1351_draw_item_t *item;
     
-    if (handle == NULL)                                                                      /* check handle */
+    if (handle == NULL)                                                        /* check handle */
     {
-        return 2;                                                                            /* return error */
+        return 2;                                                              /* return error */
     }
-    if (handle->inited != 1)                                                                 /* check handle initialization */
+    if (handle->inited != 1)                                                   /* check handle initialization */
     {
-        return 3;                                                                            /* return error */
+        return 3;                                                              /* return error */
     }
-    
-    if (a_ssd1351_write_byte(handle, SSD1351_CMD_GRAY_SCALE_PULSE_WIDTH, SSD1351_CMD) != 0)  /* set gray scale pulse width */
+    if ((x > 127) || (y > 127))                                                /* check x, y */
     {
-        handle->debug_print("ssd1351: write gray scale pulse width failed.\n");              /* write gray scale pulse width failed */
+        handle->debug_print("ssd1351: x or y is invalid.\n");                  /* x or y is invalid */
         
-        return 1;                                                                            /* return error */
+        return 4;                                                              /* return error */
     }
-    for (i = 0; i < 63; i++)                                                                 /* 64 times */
+    if ((start_angle > 360) || (end_angle > 360))                              /* check angle */
     {
-        if (a_ssd1351_write_byte(handle, gamma[i], SSD1351_DATA) != 0)                       /* set gamma */
+        handle->debug_print("ssd1351: angle is over 360.\n");                  /* angle is over 360 */
+        
+        return 5;                                                              /* return error */
+    }
+    
+    if (handle->list_buf != NULL)                                              /* if recording */
+    {
+        item = a_ssd1351_list_record(handle, SSD1351_DRAW_ARC, x, y, 0, 0, r, color); /* record arc */
+        if (item == NULL)                                                      /* check item */
         {
-            handle->debug_print("ssd1351: write gamma failed.\n");                           /* write gamma failed */
-            
-            return 1;                                                                        /* return error */
+            return 1;                                                          /* return error */
         }
+        item->start_angle = start_angle;                                       /* set start angle */
+        item->end_angle = end_angle;                                           /* set end angle */
+        
+        return 0;                                                              /* success return 0 */
     }
     
-    return 0;                                                                                /* success return 0 */
+    if (a_ssd1351_draw_arc(handle, x, y, r, start_angle, end_angle, color) != 0)   /* draw arc */
+    {
+        return 1;                                                              /* return error */
+    }
+    
+    return a_ssd1351_shape_end(handle);                                        /* flush buffer */
 }
 
 /**
- * @brief     use built in linear lut
+ * @brief     fill a triangle
  * @param[in] *handle pointer to an ssd1351 handle structure
+ * @param[in] x0 coordinate x of the first point
+ * @param[in] y0 coordinate y of the first point
+ * @param[in] x1 coordinate x of the second point
+ * @param[in] y1 coordinate y of the second point
+ * @param[in] x2 coordinate x of the third point
+ * @param[in] y2 coordinate y of the third point
+ * @param[in] color display color
  * @return    status code
  *            - 0 success
- *            - 1 set use built in linear lut failed
+ *            - 1 fill triangle failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- * @note      none
+ *            - 4 x or y is invalid
+ * @note      x0 <= 127 && y0 <= 127 && x1 <= 127 && y1 <= 127 && x2 <= 127 && y2 <= 127
+ *            every row is sent as one window and burst
  */
-uint8_t ssd1351_set_use_built_in_linear_lut(ssd1351_handle_t *handle)
+uint8_t ssd1351_fill_triangle(ssd1351_handle_t *handle, uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1, 
+                              uint8_t x2, uint8_t y2, uint32_t color)
 {
-    if (handle == NULL)                                                                       /* check handle */
+    ssd1351_draw_item_t *item;
+    
+    if (handle == NULL)                                                        /* check handle */
     {
-        return 2;                                                                             /* return error */
+        return 2;                                                              /* return error */
     }
-    if (handle->inited != 1)                                                                  /* check handle initialization */
+    if (handle->inited != 1)                                                   /* check handle initialization */
     {
-        return 3;                                                                             /* return error */
+        return 3;                                                              /* return error */
+    }
+    if ((x0 > 127) || (y0 > 127) || (x1 > 127) || 
+        (y1 > 127) || (x2 > 127) || (y2 > 127))                                /* check x, y */
+    {
+        handle->debug_print("ssd1351: x or y is invalid.\n");                  /* x or y is invalid */
+        
+        return 4;                                                              /* return error */
     }
     
-    if (a_ssd1351_write_byte(handle, SSD1351_CMD_USE_BUILT_IN_LINEAR_LUT, SSD1351_CMD) != 0)  /* set use built in linear lut */
+    if (handle->list_buf != NULL)                                              /* if recording */
     {
-        handle->debug_print("ssd1351: use built in linear lut failed.\n");                    /* write use built in linear lut failed */
+        item = a_ssd1351_list_record(handle, SSD1351_DRAW_FILL_TRIANGLE, 
+                                     x0, y0, x1, y1, 0, color);                /* record triangle */
+        if (item == NULL)                                                      /* check item */
+        {
+            return 1;                                                          /* return error */
+        }
+        item->x2 = x2;                                                         /* set x2 */
+        item->y2 = y2;                                                         /* set y2 */
         
-        return 1;                                                                             /* return error */
+        return 0;                                                              /* success return 0 */
     }
     
-    return 0;                                                                                 /* success return 0 */
+    if (a_ssd1351_fill_triangle(handle, x0, y0, x1, y1, x2, y2, color) != 0)   /* fill triangle */
+    {
+        return 1;                                                              /* return error */
+    }
+    
+    return a_ssd1351_shape_end(handle);                                        /* flush buffer */
 }
 
 /**
- * @brief     set the pre charge voltage
+ * @brief     draw a rounded rect
  * @param[in] *handle pointer to an ssd1351 handle structure
- * @param[in] voltage_level pre charge voltage level
+ * @param[in] left left coordinate x
+ * @param[in] top top coordinate y
+ * @param[in] right right coordinate x
+ * @param[in] bottom bottom coordinate y
+ * @param[in] r corner radius
+ * @param[in] color display color
  * @return    status code
  *            - 0 success
- *            - 1 set pre charge voltage failed
+ *            - 1 draw round rect failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- *            - 4 voltage level is over 0x1F
- * @note      voltage_level <= 0x1F
+ *            - 4 left is over 127
+ *            - 5 right is over 127
+ *            - 6 left > right
+ *            - 7 top is over 127
+ *            - 8 bottom is over 127
+ *            - 9 top > bottom
+ *            - 10 r is too large
+ * @note      left <= 127 && right <= 127 && left <= right && top <= 127 && bottom <= 127 && top <= bottom
+ *            2 * r <= right - left && 2 * r <= bottom - top
  */
-uint8_t ssd1351_set_pre_charge_voltage(ssd1351_handle_t *handle, uint8_t voltage_level)
+uint8_t ssd1351_draw_round_rect(ssd1351_handle_t *handle, uint8_t left, uint8_t top, uint8_t right, uint8_t bottom, 
+                                uint8_t r, uint32_t color)
 {
-    if (handle == NULL)                                                                      /* check handle */
+    if (handle == NULL)                                                        /* check handle */
     {
-        return 2;                                                                            /* return error */
+        return 2;                                                              /* return error */
     }
-    if (handle->inited != 1)                                                                 /* check handle initialization */
+    if (handle->inited != 1)                                                   /* check handle initialization */
     {
-        return 3;                                                                            /* return error */
+        return 3;                                                              /* return error */
     }
-    if (voltage_level > 0x1F)                                                                /* check voltage level */
+    if (left > 127)                                                            /* check left */
     {
-        handle->debug_print("ssd1351: voltage level is over 0x1F.\n");                       /* voltage level is over 0x1F */
+        handle->debug_print("ssd1351: left is over 127.\n");                   /* left is over 127 */
         
-        return 4;                                                                            /* return error */
+        return 4;                                                              /* return error */
     }
-    
-    if (a_ssd1351_write_byte(handle, SSD1351_CMD_SET_PRE_CHARGE_VOLTAGE, SSD1351_CMD) != 0)  /* set pre charge voltage */
+    if (right > 127)                                                           /* check right */
     {
-        handle->debug_print("ssd1351: write pre charge voltage failed.\n");                  /* write pre-charge voltage failed */
+        handle->debug_print("ssd1351: right is over 127.\n");                  /* right is over 127 */
         
-        return 1;                                                                            /* return error */
+        return 5;                                                              /* return error */
     }
-    if (a_ssd1351_write_byte(handle, voltage_level, SSD1351_DATA) != 0)                      /* set pre charge voltage */
+    if (left > right)                                                          /* check left and right */
     {
-        handle->debug_print("ssd1351: write pre charge voltage failed.\n");                  /* write pre-charge voltage failed */
+        handle->debug_print("ssd1351: left > right.\n");                       /* left > right */
         
-        return 1;                                                                            /* return error */
+        return 6;                                                              /* return error */
+    }
+    if (top > 127)                                                             /* check top */
+    {
+        handle->debug_print("ssd1351: top is over 127.\n");                    /* top is over 127 */
+        
+        return 7;                                                              /* return error */
+    }
+    if (bottom > 127)                                                          /* check bottom */
+    {
+        handle->debug_print("ssd1351: bottom is over 127.\n");                 /* bottom is over 127 */
+        
+        return 8;                                                              /* return error */
+    }
+    if (top > bottom)                                                          /* check top and bottom */
+    {
+        handle->debug_print("ssd1351: top > bottom.\n");                       /* top > bottom */
+        
+        return 9;                                                              /* return error */
+    }
+    if ((2 * r > right - left) || (2 * r > bottom - top))                      /* check radius */
+    {
+        handle->debug_print("ssd1351: r is too large.\n");                     /* r is too large */
+        
+        return 10;                                                             /* return error */
     }
     
-    return 0;                                                                                /* success return 0 */
+    if (handle->list_buf != NULL)                                              /* if recording */
+    {
+        if (a_ssd1351_list_record(handle, SSD1351_DRAW_ROUND_RECT, 
+                                  left, top, right, bottom, r, color) == NULL) /* record rounded rect */
+        {
+            return 1;                                                          /* return error */
+        }
+        
+        return 0;                                                              /* success return 0 */
+    }
+    
+    if (a_ssd1351_draw_round(handle, (int16_t)(left + r), (int16_t)(top + r), r, 
+                             (int16_t)(right - left - 2 * r), (int16_t)(bottom - top - 2 * r), 
+                             NULL, color) != 0)                                /* draw rounded rect */
+    {
+        return 1;                                                              /* return error */
+    }
+    
+    return a_ssd1351_shape_end(handle);                                        /* flush buffer */
 }
 
 /**
- * @brief     set the vcomh voltage
+ * @brief     fill a rounded rect
  * @param[in] *handle pointer to an ssd1351 handle structure
- * @param[in] voltage_level vcomh voltage level
+ * @param[in] left left coordinate x
+ * @param[in] top top coordinate y
+ * @param[in] right right coordinate x
+ * @param[in] bottom bottom coordinate y
+ * @param[in] r corner radius
+ * @param[in] color display color
  * @return    status code
  *            - 0 success
- *            - 1 set vcomh voltage failed
+ *            - 1 fill round rect failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- *            - 4 voltage level is over 0x07
- * @note      voltage_level <= 0x07
+ *            - 4 left is over 127
+ *            - 5 right is over 127
+ *            - 6 left > right
+ *            - 7 top is over 127
+ *            - 8 bottom is over 127
+ *            - 9 top > bottom
+ *            - 10 r is too large
+ * @note      left <= 127 && right <= 127 && left <= right && top <= 127 && bottom <= 127 && top <= bottom
+ *            2 * r <= right - left && 2 * r <= bottom - top
  */
-uint8_t ssd1351_set_vcomh_voltage(ssd1351_handle_t *handle, uint8_t voltage_level)
+uint8_t ssd1351_fill_round_rect(ssd1351_handle_t *handle, uint8_t left, uint8_t top, uint8_t right, uint8_t bottom, 
+                                uint8_t r, uint32_t color)
 {
-    if (handle == NULL)                                                                 /* check handle */
+    if (handle == NULL)                                                        /* check handle */
+    {
+        return 2;                                                              /* return error */
+    }
+    if (handle->inited != 1)                                                   /* check handle initialization */
+    {
+        return 3;                                                              /* return error */
+    }
+    if (left > 127)                                                            /* check left */
+    {
+        handle->debug_print("ssd1351: left is over 127.\n");                   /* left is over 127 */
+        
+        return 4;                                                              /* return error */
+    }
+    if (right > 127)                                                           /* check right */
+    {
+        handle->debug_print("ssd1351: right is over 127.\n");                  /* right is over 127 */
+        
+        return 5;                                                              /* return error */
+    }
+    if (left > right)                                                          /* check left and right */
+    {
+        handle->debug_print("ssd1351: left > right.\n");                       /* left > right */
+        
+        return 6;                                                              /* return error */
+    }
+    if (top > 127)                                                             /* check top */
+    {
+        handle->debug_print("ssd1351: top is over 127.\n");                    /* top is over 127 */
+        
+        return 7;                                                              /* return error */
+    }
+    if (bottom > 127)                                                          /* check bottom */
     {
-        return 2;                                                                       /* return error */
+        handle->debug_print("ssd1351: bottom is over 127.\n");                 /* bottom is over 127 */
+        
+        return 8;                                                              /* return error */
     }
-    if (handle->inited != 1)                                                            /* check handle initialization */
+    if (top > bottom)                                                          /* check top and bottom */
     {
-        return 3;                                                                       /* return error */
+        handle->debug_print("ssd1351: top > bottom.\n");                       /* top > bottom */
+        
+        return 9;                                                              /* return error */
     }
-    if (voltage_level > 0x07)                                                           /* check voltage level */
+    if ((2 * r > right - left) || (2 * r > bottom - top))                      /* check radius */
     {
-        handle->debug_print("ssd1351: voltage level is over 0x07.\n");                  /* voltage level is over 0x07 */
+        handle->debug_print("ssd1351: r is too large.\n");                     /* r is too large */
         
-        return 4;                                                                       /* return error */
+        return 10;                                                             /* return error */
     }
     
-    if (a_ssd1351_write_byte(handle, SSD1351_CMD_SET_VCOMH_VOLTAGE, SSD1351_CMD) != 0)  /* set vcomh voltage */
+    if (handle->list_buf != NULL)                                              /* if recording */
     {
-        handle->debug_print("ssd1351: write vcomh voltage failed.\n");                  /* write vcomh voltage failed */
+        if (a_ssd1351_list_record(handle, SSD1351_DRAW_FILL_ROUND_RECT, 
+                                  left, top, right, bottom, r, color) == NULL) /* record rounded rect */
+        {
+            return 1;                                                          /* return error */
+        }
         
-        return 1;                                                                       /* return error */
+        return 0;                                                              /* success return 0 */
     }
-    if (a_ssd1351_write_byte(handle, voltage_level, SSD1351_DATA) != 0)                 /* set vcomh voltage */
+    
+    if (a_ssd1351_fill_round(handle, (int16_t)(left + r), (int16_t)(top + r), r, 
+                             (int16_t)(right - left - 2 * r), (int16_t)(bottom - top - 2 * r), 
+                             color) != 0)                                      /* fill rounded rect */
     {
-        handle->debug_print("ssd1351: write vcomh voltage failed.\n");                  /* write vcomh voltage failed */
-        
-        return 1;                                                                       /* return error */
+        return 1;                                                              /* return error */
     }
     
-    return 0;                                                                           /* success return 0 */
+    return a_ssd1351_shape_end(handle);                                        /* flush buffer */
 }
 
 /**
- * @brief     set the display contrast
+ * @brief     set the band buffer
  * @param[in] *handle pointer to an ssd1351 handle structure
- * @param[in] a contrast a
- * @param[in] b contrast b
- * @param[in] c contrast c
+ * @param[in] *buf pointer to a band buffer
+ * @param[in] len band buffer length
  * @return    status code
  *            - 0 success
- *            - 1 set contrast failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- * @note      none
+ * @note      buf == NULL renders the bands in the inner buffer,
+ *            a band holds len / (width * pixel bytes) rows and is sent as one burst
  */
-uint8_t ssd1351_set_contrast(ssd1351_handle_t *handle, uint8_t a, uint8_t b, uint8_t c)
+uint8_t ssd1351_set_band_buffer(ssd1351_handle_t *handle, uint8_t *buf, uint32_t len)
 {
-    if (handle == NULL)                                                            /* check handle */
+    if (handle == NULL)                                                        /* check handle */
     {
-        return 2;                                                                  /* return error */
+        return 2;                                                              /* return error */
     }
-    if (handle->inited != 1)                                                       /* check handle initialization */
+    if (handle->inited != 1)                                                   /* check handle initialization */
     {
-        return 3;                                                                  /* return error */
+        return 3;                                                              /* return error */
     }
     
-    if (a_ssd1351_write_byte(handle, SSD1351_CMD_SET_CONTRAST, SSD1351_CMD) != 0)  /* set contrast */
-    {
-        handle->debug_print("ssd1351: write contrast failed.\n");                  /* write contrast failed */
-        
-        return 1;                                                                  /* return error */
-    }
-    if (a_ssd1351_write_byte(handle, a, SSD1351_DATA) != 0)                        /* set a */
-    {
-        handle->debug_print("ssd1351: write a failed.\n");                         /* write a failed */
-        
-        return 1;                                                                  /* return error */
-    }
-    if (a_ssd1351_write_byte(handle, b, SSD1351_DATA) != 0)                        /* set b */
-    {
-        handle->debug_print("ssd1351: write b failed.\n");                         /* write b failed */
-        
-        return 1;                                                                  /* return error */
-    }
-    if (a_ssd1351_write_byte(handle, c, SSD1351_DATA) != 0)                        /* set c */
-    {
-        handle->debug_print("ssd1351: write c failed.\n");                         /* write c failed */
-        
-        return 1;                                                                  /* return error */
-    }
+    handle->band = buf;                                                        /* set band buffer */
+    handle->band_len = (buf != NULL) ? len : 0;                                /* set band length */
     
-    return 0;                                                                      /* success return 0 */
+    return 0;                                                                  /* success return 0 */
 }
 
 /**
- * @brief     set the master contrast current
+ * @brief     fill a polygon with anti-aliased edges
  * @param[in] *handle pointer to an ssd1351 handle structure
- * @param[in] current master contrast current
+ * @param[in] *point pointer to a point buffer
+ * @param[in] num point number
+ * @param[in] color display color
+ * @param[in] background background color
  * @return    status code
  *            - 0 success
- *            - 1 set master contrast current failed
+ *            - 1 fill polygon failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- *            - 4 master contrast current is over 0x0F
- * @note      current <= 0x0F
+ *            - 4 point is invalid
+ *            - 5 num is invalid
+ *            - 6 band buffer is too small
+ * @note      3 <= num <= SSD1351_POLYGON_MAX_POINTS and the points are in 1/16 pixel
+ *            within -16384 - 16383, the polygon is filled with the non-zero winding rule and clipped,
+ *            the bounding box is filled with the background color and sent band by band,
+ *            with the framebuffer the edges are blended over the framebuffer and background is not used
  */
-uint8_t ssd1351_set_master_contrast_current(ssd1351_handle_t *handle, uint8_t current)
+uint8_t ssd1351_fill_polygon(ssd1351_handle_t *handle, const ssd1351_point_t *point, uint8_t num, 
+                             uint32_t color, uint32_t background)
 {
-    if (handle == NULL)                                                                       /* check handle */
+    uint8_t i;
+    uint8_t res;
+    
+    if (handle == NULL)                                                        /* check handle */
     {
-        return 2;                                                                             /* return error */
+        return 2;                                                              /* return error */
     }
-    if (handle->inited != 1)                                                                  /* check handle initialization */
+    if (handle->inited != 1)                                                   /* check handle initialization */
     {
-        return 3;                                                                             /* return error */
+        return 3;                                                              /* return error */
     }
-    if (current > 0x0F)                                                                       /* check master contrast current */
+    if (point == NULL)                                                         /* check point */
     {
-        handle->debug_print("ssd1351: master contrast current is over 0x0F.\n");              /* master contrast current is over 0x0F */
+        handle->debug_print("ssd1351: point is invalid.\n");                   /* point is invalid */
         
-        return 4;                                                                             /* return error */
+        return 4;                                                              /* return error */
     }
-    
-    if (a_ssd1351_write_byte(handle, SSD1351_CMD_MASTER_CONTRAST_CONTROL, SSD1351_CMD) != 0)  /* set master contrast current */
+    if ((num < 3) || (num > SSD1351_POLYGON_MAX_POINTS))                       /* check num */
     {
-        handle->debug_print("ssd1351: write master contrast current failed.\n");              /* write master contrast current failed */
+        handle->debug_print("ssd1351: num is invalid.\n");                     /* num is invalid */
         
-        return 1;                                                                             /* return error */
+        return 5;                                                              /* return error */
     }
-    if (a_ssd1351_write_byte(handle, current, SSD1351_DATA) != 0)                             /* set master contrast current */
+    for (i = 0; i < num; i++)                                                  /* check all points */
     {
-        handle->debug_print("ssd1351: write master contrast current failed.\n");              /* write master contrast current failed */
-        
-        return 1;                                                                             /* return error */
+        if ((point[i].x < -16384) || (point[i].x > 16383) || 
+            (point[i].y < -16384) || (point[i].y > 16383))                     /* check range */
+        {
+            handle->debug_print("ssd1351: point is invalid.\n");               /* point is invalid */
+            
+            return 4;                                                          /* return error */
+        }
     }
-        
-    return 0;                                                                                 /* success return 0 */
+    
+    res = a_ssd1351_fill_polygon(handle, point, num, color, background);       /* fill polygon */
+    if (res != 0)                                                              /* check result */
+    {
+        return (res == 2) ? 6 : 1;                                             /* return error */
+    }
+    
+    return 0;                                                                  /* success return 0 */
 }
 
 /**
- * @brief     set the mux ratio
+ * @brief     draw an anti-aliased thick line
  * @param[in] *handle pointer to an ssd1351 handle structure
- * @param[in] ratio mux ratio
+ * @param[in] x0 coordinate x of the first point in 1/16 pixel
+ * @param[in] y0 coordinate y of the first point in 1/16 pixel
+ * @param[in] x1 coordinate x of the second point in 1/16 pixel
+ * @param[in] y1 coordinate y of the second point in 1/16 pixel
+ * @param[in] width line width in 1/16 pixel
+ * @param[in] color display color
+ * @param[in] background background color
  * @return    status code
  *            - 0 success
- *            - 1 set mux ratio failed
+ *            - 1 draw thick line failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- *            - 4 ratio < 15
- *            - 5 ratio > 127
- * @note      15 <= ratio <= 127
+ *            - 4 point is invalid
+ *            - 5 width is invalid
+ *            - 6 band buffer is too small
+ * @note      the points are within -8192 - 8191 and 0 < width <= 4096,
+ *            the line is filled as a quad polygon so it suits gauge needles,
+ *            the background works like ssd1351_fill_polygon
  */
-uint8_t ssd1351_set_mux_ratio(ssd1351_handle_t *handle, uint8_t ratio)
+uint8_t ssd1351_draw_thick_line(ssd1351_handle_t *handle, int16_t x0, int16_t y0, int16_t x1, int16_t y1, 
+                                uint16_t width, uint32_t color, uint32_t background)
 {
-    if (handle == NULL)                                                                       /* check handle */
+    ssd1351_point_t quad[4];
+    int32_t dx;
+    int32_t dy;
+    int32_t nx;
+    int32_t ny;
+    uint32_t sq;
+    uint32_t len;
+    uint32_t bit;
+    uint8_t res;
+    
+    if (handle == NULL)                                                        /* check handle */
     {
-        return 2;                                                                             /* return error */
+        return 2;                                                              /* return error */
     }
-    if (handle->inited != 1)                                                                  /* check handle initialization */
+    if (handle->inited != 1)                                                   /* check handle initialization */
     {
-        return 3;                                                                             /* return error */
+        return 3;                                                              /* return error */
     }
-    if (ratio < 15)                                                                           /* check ratio */
+    if ((x0 < -8192) || (x0 > 8191) || (y0 < -8192) || (y0 > 8191) || 
+        (x1 < -8192) || (x1 > 8191) || (y1 < -8192) || (y1 > 8191))            /* check points */
     {
-        handle->debug_print("ssd1351: ratio < 15.\n");                                        /* ratio < 15 */
+        handle->debug_print("ssd1351: point is invalid.\n");                   /* point is invalid */
         
-        return 4;                                                                             /* return error */
+        return 4;                                                              /* return error */
     }
-    if (ratio > 127)                                                                          /* check ratio */
+    if ((width == 0) || (width > 4096))                                        /* check width */
     {
-        handle->debug_print("ssd1351: ratio > 127.\n");                                       /* ratio > 127 */
+        handle->debug_print("ssd1351: width is invalid.\n");                   /* width is invalid */
         
-        return 5;                                                                             /* return error */
+        return 5;                                                              /* return error */
     }
     
-    if (a_ssd1351_write_byte(handle, SSD1351_CMD_SET_MUX_RATIO, SSD1351_CMD) != 0)            /* set mux ratio */
+    dx = (int32_t)x1 - x0;                                                     /* get dx */
+    dy = (int32_t)y1 - y0;                                                     /* get dy */
+    sq = (uint32_t)(dx * dx + dy * dy);                                        /* get squared length */
+    if (sq == 0)                                                               /* check length */
     {
-        handle->debug_print("ssd1351: write mux ratio failed.\n");                            /* write mux ratio failed */
-        
-        return 1;                                                                             /* return error */
+        return 0;                                                              /* success return 0 */
     }
-    if (a_ssd1351_write_byte(handle, ratio, SSD1351_DATA) != 0)                               /* set mux ratio */
+    len = 0;                                                                   /* init 0 */
+    bit = 1UL << 30;                                                           /* init the highest bit */
+    while (bit > sq)                                                           /* find the start bit */
     {
-        handle->debug_print("ssd1351: write mux ratio failed.\n");                            /* write mux ratio failed */
-        
-        return 1;                                                                             /* return error */
+        bit >>= 2;                                                             /* bit >>= 2 */
     }
-        
-    return 0;                                                                                 /* success return 0 */
+    while (bit != 0)                                                           /* integer square root */
+    {
+        if (sq >= len + bit)                                                   /* check bit */
+        {
+            sq -= len + bit;                                                   /* sub */
+            len = (len >> 1) + bit;                                            /* set bit */
+        }
+        else
+        {
+            len >>= 1;                                                         /* shift */
+        }
+        bit >>= 2;                                                             /* next bit */
+    }
+    nx = -dy * (int32_t)width / (int32_t)(2 * len);                            /* normal x */
+    ny = dx * (int32_t)width / (int32_t)(2 * len);                             /* normal y */
+    quad[0].x = (int16_t)(x0 + nx);                                            /* set point 0 */
+    quad[0].y = (int16_t)(y0 + ny);                                            /* set point 0 */
+    quad[1].x = (int16_t)(x1 + nx);                                            /* set point 1 */
+    quad[1].y = (int16_t)(y1 + ny);                                            /* set point 1 */
+    quad[2].x = (int16_t)(x1 - nx);                                            /* set point 2 */
+    quad[2].y = (int16_t)(y1 - ny);                                            /* set point 2 */
+    quad[3].x = (int16_t)(x0 - nx);                                            /* set point 3 */
+    quad[3].y = (int16_t)(y0 - ny);                                            /* set point 3 */
+    res = a_ssd1351_fill_polygon(handle, quad, 4, color, background);          /* fill the quad */
+    if (res != 0)                                                              /* check result */
+    {
+        return (res == 2) ? 6 : 1;                                             /* return error */
+    }
+    
+    return 0;                                                                  /* success return 0 */
 }
 
 /**
- * @brief     set the command
+ * @brief     render a display list in strips
  * @param[in] *handle pointer to an ssd1351 handle structure
- * @param[in] command sent command
+ * @param[in] *list pointer to a display list
+ * @param[in] num item number
+ * @param[in] background background color
  * @return    status code
  *            - 0 success
- *            - 1 set command failed
+ *            - 1 render list failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- * @note      none
+ *            - 4 list is NULL
+ *            - 5 item is invalid
+ *            - 6 band buffer is too small
+ * @note      the whole screen is composed from the background and the items in the list order,
+ *            each 128 x N strip of the band buffer is sent as one window and one burst,
+ *            N = band buffer length / (128 * pixel bytes) and the inner buffer is used without a band buffer,
+ *            the items are checked like the matching draw functions and the picture data follows
+ *            the address increment
  */
-uint8_t ssd1351_set_command(ssd1351_handle_t *handle, ssd1351_command_t command)
+uint8_t ssd1351_render_list(ssd1351_handle_t *handle, const ssd1351_draw_item_t *list, uint16_t num, uint32_t background)
 {
-    if (handle == NULL)                                                                /* check handle */
+    uint16_t i;
+    uint8_t res;
+    
+    if (handle == NULL)                                                        /* check handle */
     {
-        return 2;                                                                      /* return error */
+        return 2;                                                              /* return error */
     }
-    if (handle->inited != 1)                                                           /* check handle initialization */
+    if (handle->inited != 1)                                                   /* check handle initialization */
     {
-        return 3;                                                                      /* return error */
+        return 3;                                                              /* return error */
     }
-    
-    if (a_ssd1351_write_byte(handle, SSD1351_CMD_SET_COMMAND_LOCK, SSD1351_CMD) != 0)  /* set command lock */
+    if ((list == NULL) && (num != 0))                                          /* check list */
     {
-        handle->debug_print("ssd1351: write command lock failed.\n");                  /* write command lock failed */
+        handle->debug_print("ssd1351: list is NULL.\n");                       /* list is NULL */
         
-        return 1;                                                                      /* return error */
+        return 4;                                                              /* return error */
     }
-    if (a_ssd1351_write_byte(handle, command, SSD1351_DATA) != 0)                      /* set command lock */
+    for (i = 0; i < num; i++)                                                  /* check all items */
     {
-        handle->debug_print("ssd1351: write command lock failed.\n");                  /* write command lock failed */
-        
-        return 1;                                                                      /* return error */
+        if (a_ssd1351_check_item(handle, &list[i]) != 0)                       /* check item */
+        {
+            handle->debug_print("ssd1351: item %d is invalid.\n", i);          /* item is invalid */
+            
+            return 5;                                                          /* return error */
+        }
     }
     
-    return 0;                                                                          /* success return 0 */
+    res = a_ssd1351_render_list(handle, list, num, background);                /* render list */
+    if (res != 0)                                                              /* check result */
+    {
+        return (res == 2) ? 6 : 1;                                             /* return error */
+    }
+    
+    return 0;                                                                  /* success return 0 */
 }
 
 /**
- * @brief     set the scroll
+ * @brief     set the display list arena
  * @param[in] *handle pointer to an ssd1351 handle structure
- * @param[in] scroll display scroll
- * @param[in] start_row scroll start row
- * @param[in] row_len scroll row len
- * @param[in] mode scroll mode
+ * @param[in] *buf pointer to an arena buffer
+ * @param[in] len arena buffer length
  * @return    status code
  *            - 0 success
- *            - 1 set scroll failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- *            - 4 start row is over 127
- *            - 5 start_row + row_len is over 128
- * @note      start_row <= 127 && start_row + row_len <= 128
+ * @note      buf != NULL starts recording, the points, fills, shapes, built-in font strings and pictures
+ *            are recorded into the arena instead of being drawn and the other draw functions fail,
+ *            the strings are copied and the pictures are referenced,
+ *            buf == NULL stops recording and drops the recorded items
  */
-uint8_t ssd1351_set_scroll(ssd1351_handle_t *handle, int8_t scroll, uint8_t start_row, uint8_t row_len, ssd1351_scroll_mode_t mode)
+uint8_t ssd1351_set_display_list(ssd1351_handle_t *handle, uint8_t *buf, uint32_t len)
 {
-    if (handle == NULL)                                                                 /* check handle */
-    {
-        return 2;                                                                       /* return error */
-    }
-    if (handle->inited != 1)                                                            /* check handle initialization */
-    {
-        return 3;                                                                       /* return error */
-    }
-    if (start_row > 127)                                                                /* check start row */
-    {
-        handle->debug_print("ssd1351: start row is over 127.\n");                       /* start row is over 127 */
-        
-        return 4;                                                                       /* return error */
-    }
-    if ((start_row + row_len) > 128)                                                    /* check row len */
-    {
-        handle->debug_print("ssd1351: start_row + row_len is over 128.\n");             /* start_row + row_len is over 128 */
-        
-        return 5;                                                                       /* return error */
-    }
+    uint32_t pad;
     
-    if (a_ssd1351_write_byte(handle, SSD1351_CMD_STOP_MOVING, SSD1351_CMD) != 0)        /* set stop moving */
-    {
-        handle->debug_print("ssd1351: write stop moving failed.\n");                    /* write stop moving failed */
-        
-        return 1;                                                                       /* return error */
-    }
-    if (a_ssd1351_write_byte(handle, SSD1351_CMD_HORIZONTAL_SCROLL, SSD1351_CMD) != 0)  /* set horizontal scroll */
-    {
-        handle->debug_print("ssd1351: write horizontal scroll failed.\n");              /* write horizontal scroll failed */
-        
-        return 1;                                                                       /* return error */
-    }
-    if (a_ssd1351_write_byte(handle, scroll, SSD1351_DATA) != 0)                        /* set scroll */
-    {
-        handle->debug_print("ssd1351: write scroll failed.\n");                         /* write scroll failed */
-        
-        return 1;                                                                       /* return error */
-    }
-    if (a_ssd1351_write_byte(handle, start_row, SSD1351_DATA) != 0)                     /* set start row */
+    if (handle == NULL)                                                        /* check handle */
     {
-        handle->debug_print("ssd1351: write start row failed.\n");                      /* write start row failed */
-        
-        return 1;                                                                       /* return error */
+        return 2;                                                              /* return error */
     }
-    if (a_ssd1351_write_byte(handle, row_len, SSD1351_DATA) != 0)                       /* start row len */
+    if (handle->inited != 1)                                                   /* check handle initialization */
     {
-        handle->debug_print("ssd1351: write row len failed.\n");                        /* write row len failed */
-        
-        return 1;                                                                       /* return error */
+        return 3;                                                              /* return error */
     }
-    if (a_ssd1351_write_byte(handle, 0x00, SSD1351_DATA) != 0)                          /* set 0x00 */
+    
+    if (buf == NULL)                                                           /* if stop */
     {
-        handle->debug_print("ssd1351: write data failed.\n");                           /* write data failed */
+        handle->list_buf = NULL;                                               /* clear arena */
+        handle->list_len = 0;                                                  /* clear length */
+        handle->list_tail = 0;                                                 /* clear tail */
+        handle->list_num = 0;                                                  /* clear item number */
         
-        return 1;                                                                       /* return error */
+        return 0;                                                              /* success return 0 */
     }
-    if (a_ssd1351_write_byte(handle, mode, SSD1351_DATA) != 0)                          /* set mode */
+    pad = (uint32_t)((sizeof(void *) - ((uintptr_t)buf % sizeof(void *))) % sizeof(void *));   /* align items */
+    if (len < pad)                                                             /* check length */
     {
-        handle->debug_print("ssd1351: write mode failed.\n");                           /* write mode failed */
-        
-        return 1;                                                                       /* return error */
+        pad = len;                                                             /* no room */
     }
+    handle->list_buf = buf + pad;                                              /* set arena */
+    handle->list_len = len - pad;                                              /* set length */
+    handle->list_tail = len - pad;                                             /* empty string area */
+    handle->list_num = 0;                                                      /* empty list */
     
-    return 0;                                                                           /* success return 0 */
+    return 0;                                                                  /* success return 0 */
 }
 
 /**
- * @brief     clear the display
+ * @brief     submit the recorded display list
  * @param[in] *handle pointer to an ssd1351 handle structure
  * @return    status code
  *            - 0 success
- *            - 1 clear failed
+ *            - 1 submit display list failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- * @note      none
+ *            - 4 display list is not set
+ * @note      items hidden by a later fill, picture or one line opaque string are culled,
+ *            touching fills of the same color are merged, a list that starts with a full screen fill
+ *            is composed in strips of the band buffer and any other list is replayed item by item,
+ *            the arena is then reset for the next frame and recording goes on
  */
-uint8_t ssd1351_clear(ssd1351_handle_t *handle)
+uint8_t ssd1351_submit_display_list(ssd1351_handle_t *handle)
 {
-    uint8_t i, j;
+    uint8_t *buf;
+    uint16_t num;
+    uint8_t res;
     
-    if (handle == NULL)                                                                     /* check handle */
+    if (handle == NULL)                                                        /* check handle */
     {
-        return 2;                                                                           /* return error */
+        return 2;                                                              /* return error */
     }
-    if (handle->inited != 1)                                                                /* check handle initialization */
+    if (handle->inited != 1)                                                   /* check handle initialization */
     {
-        return 3;                                                                           /* return error */
+        return 3;                                                              /* return error */
     }
-    
-    if (a_ssd1351_write_byte(handle, SSD1351_CMD_SET_ROW_ADDRESS, SSD1351_CMD) != 0)        /* set row address */
+    if (handle->list_buf == NULL)                                              /* check display list */
     {
-        handle->debug_print("ssd1351: write command failed.\n");                            /* write command failed */
+        handle->debug_print("ssd1351: display list is not set.\n");            /* display list is not set */
         
-        return 1;                                                                           /* return error */
+        return 4;                                                              /* return error */
     }
-    if (a_ssd1351_write_byte(handle, 0, SSD1351_DATA) != 0)                                 /* set start address */
+    
+    buf = handle->list_buf;                                                    /* save arena */
+    num = a_ssd1351_list_optimize((ssd1351_draw_item_t *)buf, handle->list_num);   /* cull and merge */
+    handle->list_buf = NULL;                                                   /* pause recording */
+    res = a_ssd1351_list_replay(handle, (const ssd1351_draw_item_t *)buf, num);    /* replay */
+    handle->list_buf = buf;                                                    /* resume recording */
+    handle->list_tail = handle->list_len;                                      /* reset string area */
+    handle->list_num = 0;                                                      /* reset list */
+    if (res != 0)                                                              /* check result */
     {
-        handle->debug_print("ssd1351: write start address failed.\n");                      /* write start address failed */
-        
-        return 1;                                                                           /* return error */
+        return 1;                                                              /* return error */
     }
-    if (a_ssd1351_write_byte(handle, 127, SSD1351_DATA) != 0)                               /* set end address */
+    
+    return 0;                                                                  /* success return 0 */
+}
+
+/**
+ * @brief     set the sprite background
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @param[in] *image pointer to a background image buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 set sprite background failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      the image is a row major 128 x 128 uint16_t image which is cached and drawn to the whole screen,
+ *            image == NULL drops the cached background,
+ *            262K color format can't use this function and the shown sprites are erased
+ */
+uint8_t ssd1351_set_sprite_background(ssd1351_handle_t *handle, const uint16_t *image)
+{
+    ssd1351_box_t box;
+    uint8_t res;
+    
+    if (handle == NULL)                                                        /* check handle */
     {
-        handle->debug_print("ssd1351: write end address failed.\n");                        /* write end address failed */
-        
-        return 1;                                                                           /* return error */
+        return 2;                                                              /* return error */
     }
-    if (a_ssd1351_write_byte(handle, SSD1351_CMD_SET_COLUMN_ADDRESS, SSD1351_CMD) != 0)     /* set column address */
+    if (handle->inited != 1)                                                   /* check handle initialization */
     {
-        handle->debug_print("ssd1351: write command failed.\n");                            /* write command failed */
-        
-        return 1;                                                                           /* return error */
+        return 3;                                                              /* return error */
     }
-    if (a_ssd1351_write_byte(handle, 0, SSD1351_DATA) != 0)                                 /* set start address */
+    
+    if (image == NULL)                                                         /* if drop */
     {
-        handle->debug_print("ssd1351: write start address failed.\n");                      /* write start address failed */
+        handle->sprite_background = NULL;                                      /* clear background */
         
-        return 1;                                                                           /* return error */
+        return 0;                                                              /* success return 0 */
     }
-    if (a_ssd1351_write_byte(handle, 127, SSD1351_DATA) != 0)                               /* set end address */
+    if (SSD1351_CONF_DEPTH(handle) > 0x40)                                     /* if 262K */
     {
-        handle->debug_print("ssd1351: write end address failed.\n");                        /* write end address failed */
+        handle->debug_print("ssd1351: 262K color format can't use this function.\n");   /* 262K can't use this function */
         
-        return 1;                                                                           /* return error */
+        return 1;                                                              /* return error */
     }
-    if (a_ssd1351_write_byte(handle, SSD1351_CMD_WRITE_RAM, SSD1351_CMD) != 0)              /* set write ram */
+    handle->sprite_background = image;                                         /* set background */
+    box.left = 0;                                                              /* whole screen */
+    box.top = 0;                                                               /* whole screen */
+    box.right = 127;                                                           /* whole screen */
+    box.bottom = 127;                                                          /* whole screen */
+    res = a_ssd1351_sprite_compose(handle, NULL, 0, &box);                     /* draw background */
+    if (res == 2)                                                              /* check band */
     {
-        handle->debug_print("ssd1351: write ram failed.\n");                                /* write ram failed */
-        
-        return 1;                                                                           /* return error */
+        handle->debug_print("ssd1351: band buffer is too small.\n");           /* band buffer is too small */
     }
-    for (i = 0; i < 128; i++)                                                               /* set row */
+    if (res != 0)                                                              /* check result */
     {
-        for (j = 0; j < 128; j++)                                                           /* set column */
-        {
-            if ((handle->conf_1 & 0xC0) == 0)                                               /* if 256 */
-            {
-                if (a_ssd1351_write_byte(handle, 0x00, SSD1351_DATA) != 0)                  /* set data */
-                {
-                    handle->debug_print("ssd1351: write data failed.\n");                   /* write data failed */
-                    
-                    return 1;                                                               /* return error */
-                }
-            }
-            else if ((handle->conf_1 & 0xC0) == 0x40)                                       /* if 65K */
-            {
-                if (a_ssd1351_write_byte(handle, 0x00, SSD1351_DATA) != 0)                  /* set data */
-                {
-                    handle->debug_print("ssd1351: write data failed.\n");                   /* write data failed */
-                    
-                    return 1;                                                               /* return error */
-                }
-                if (a_ssd1351_write_byte(handle, 0x00, SSD1351_DATA) != 0)                  /* set data */
-                {
-                    handle->debug_print("ssd1351: write data failed.\n");                   /* write data failed */
-                    
-                    return 1;                                                               /* return error */
-                }
-            }
-            else                                                                            /* if 262K */
-            {
-                if (a_ssd1351_write_byte(handle, 0x00, SSD1351_DATA) != 0)                  /* set data */
-                {
-                    handle->debug_print("ssd1351: write data failed.\n");                   /* write data failed */
-                    
-                    return 1;                                                               /* return error */
-                }
-                if (a_ssd1351_write_byte(handle, 0x00, SSD1351_DATA) != 0)                  /* set data */
-                {
-                    handle->debug_print("ssd1351: write data failed.\n");                   /* write data failed */
-                    
-                    return 1;                                                               /* return error */
-                }
-                if (a_ssd1351_write_byte(handle, 0x00, SSD1351_DATA) != 0)                  /* set data */
-                {
-                    handle->debug_print("ssd1351: write data failed.\n");                   /* write data failed */
-                    
-                    return 1;                                                               /* return error */
-                }
-            }
-        }
+        return 1;                                                              /* return error */
     }
     
-    return 0;                                                                               /* success return 0 */
+    return 0;                                                                  /* success return 0 */
 }
 
 /**
- * @brief     draw a point in the display
- * @param[in] *handle pointer to an ssd1351 handle structure
- * @param[in] x coordinate x
- * @param[in] y coordinate y
- * @param[in] color point color
- * @return    status code
- *            - 0 success
- *            - 1 draw point failed
- * @note      none
+ * @brief         update the sprites
+ * @param[in]     *handle pointer to an ssd1351 handle structure
+ * @param[in,out] *sprite pointer to a sprite buffer
+ * @param[in]     num sprite number
+ * @return        status code
+ *                - 0 success
+ *                - 1 update sprites failed
+ *                - 2 handle is NULL
+ *                - 3 handle is not initialized
+ *                - 4 sprite background is not set
+ *                - 5 num is invalid
+ *                - 6 sprite is invalid
+ *                - 7 band buffer is too small
+ * @note          num <= SSD1351_SPRITE_MAX_NUM and later sprites are drawn on top,
+ *                a sprite is redrawn when it moves, shows, hides or changes its image pointer,
+ *                the old and new boxes are composed from the cached background and the sprites
+ *                and only these boxes are sent, pixels equal to the key or clear in the mask are transparent,
+ *                a sprite is hidden and updated once before it is dropped from the buffer
  */
-static uint8_t a_ssd1351_draw_point(ssd1351_handle_t *handle, uint8_t x, uint8_t y, uint32_t color)
+uint8_t ssd1351_update_sprites(ssd1351_handle_t *handle, ssd1351_sprite_t *sprite, uint8_t num)
 {
-    if (a_ssd1351_write_byte(handle, SSD1351_CMD_SET_COLUMN_ADDRESS, SSD1351_CMD) != 0)  /* write column address command */
-    {
-        handle->debug_print("ssd1351: write command failed.\n");                         /* write command failed */
-        
-        return 1;                                                                        /* return error */
-    }
-    if (a_ssd1351_write_byte(handle, x, SSD1351_DATA) != 0)                              /* set start address */
-    {
-        handle->debug_print("ssd1351: write start address failed.\n");                   /* write start address failed */
-        
-        return 1;                                                                        /* return error */
-    }
-    if (a_ssd1351_write_byte(handle, x, SSD1351_DATA) != 0)                              /* set end address */
-    {
-        handle->debug_print("ssd1351: write end address failed.\n");                     /* write end address failed */
-        
-        return 1;                                                                        /* return error */
-    }
-    if (a_ssd1351_write_byte(handle, SSD1351_CMD_SET_ROW_ADDRESS, SSD1351_CMD) != 0)     /* write column address command */
+    ssd1351_box_t box[2 * SSD1351_SPRITE_MAX_NUM];
+    ssd1351_box_t now;
+    uint8_t num_box;
+    uint8_t visible;
+    uint8_t i;
+    uint8_t res;
+    
+    if (handle == NULL)                                                        /* check handle */
     {
-        handle->debug_print("ssd1351: write command failed.\n");                         /* write command failed */
-        
-        return 1;                                                                        /* return error */
+        return 2;                                                              /* return error */
     }
-    if (a_ssd1351_write_byte(handle, y, SSD1351_DATA) != 0)                              /* set start address */
+    if (handle->inited != 1)                                                   /* check handle initialization */
     {
-        handle->debug_print("ssd1351: write start address failed.\n");                   /* write start address failed */
-        
-        return 1;                                                                        /* return error */
+        return 3;                                                              /* return error */
     }
-    if (a_ssd1351_write_byte(handle, y, SSD1351_DATA) != 0)                              /* set end address */
+    if (handle->sprite_background == NULL)                                     /* check background */
     {
-        handle->debug_print("ssd1351: write end address failed.\n");                     /* write end address failed */
+        handle->debug_print("ssd1351: sprite background is not set.\n");       /* sprite background is not set */
         
-        return 1;                                                                        /* return error */
+        return 4;                                                              /* return error */
     }
-    if (a_ssd1351_write_byte(handle, SSD1351_CMD_WRITE_RAM, SSD1351_CMD) != 0)           /* set write ram */
+    if ((sprite == NULL) || (num > SSD1351_SPRITE_MAX_NUM))                    /* check num */
     {
-        handle->debug_print("ssd1351: write ram failed.\n");                             /* write ram failed */
+        handle->debug_print("ssd1351: num is invalid.\n");                     /* num is invalid */
         
-        return 1;                                                                        /* return error */
+        return 5;                                                              /* return error */
     }
-    if ((handle->conf_1 & 0xC0) == 0)                                                    /* if 256 */
+    for (i = 0; i < num; i++)                                                  /* check all sprites */
     {
-        if (a_ssd1351_write_byte(handle, color & 0xFF, SSD1351_DATA) != 0)               /* set data */
+        if ((sprite[i].image == NULL) || (sprite[i].width == 0) || (sprite[i].height == 0))   /* check sprite */
         {
-            handle->debug_print("ssd1351: write data failed.\n");                        /* write data failed */
+            handle->debug_print("ssd1351: sprite is invalid.\n");              /* sprite is invalid */
             
-            return 1;                                                                    /* return error */
+            return 6;                                                          /* return error */
         }
+    }
+    if (SSD1351_CONF_DEPTH(handle) > 0x40)                                     /* if 262K */
+    {
+        handle->debug_print("ssd1351: 262K color format can't use this function.\n");   /* 262K can't use this function */
         
-        return 0;                                                                        /* success return 0 */
+        return 1;                                                              /* return error */
     }
-    else if ((handle->conf_1 & 0xC0) == 0x40)                                            /* if 65K */
+    
+    num_box = 0;                                                               /* init 0 */
+    for (i = 0; i < num; i++)                                                  /* collect the changed boxes */
     {
-        if ((handle->conf_1 & 0x04) != 0)                                                /* CBA */
+        visible = a_ssd1351_sprite_box(&sprite[i], &now);                      /* get new box */
+        if (sprite[i].shown != 0)                                              /* if shown */
         {
-            color &= 0x00FFFFU;
-            if (a_ssd1351_write_byte(handle, (color>>8)&0xFF, SSD1351_DATA) != 0)        /* set 1st */
-            {
-                handle->debug_print("ssd1351: write data failed.\n");                    /* write data failed */
-                
-                return 1;                                                                /* return error */
-            }
-            if (a_ssd1351_write_byte(handle, (color>>0)&0xFF, SSD1351_DATA) != 0)        /* set 2nd */
+            if ((visible != 0) && (sprite[i].shown_image == sprite[i].image) && 
+                (sprite[i].shown_left == now.left) && (sprite[i].shown_top == now.top) && 
+                (sprite[i].shown_right == now.right) && (sprite[i].shown_bottom == now.bottom))   /* check unchanged */
             {
-                handle->debug_print("ssd1351: write data failed.\n");                    /* write data failed */
-                
-                return 1;                                                                /* return error */
+                continue;                                                      /* next sprite */
             }
-            
-            return 0;                                                                    /* success return 0 */
+            box[num_box].left = sprite[i].shown_left;                          /* set old left */
+            box[num_box].top = sprite[i].shown_top;                            /* set old top */
+            box[num_box].right = sprite[i].shown_right;                        /* set old right */
+            box[num_box].bottom = sprite[i].shown_bottom;                      /* set old bottom */
+            num_box++;                                                         /* box++ */
         }
-        else                                                                             /* ABC */
+        if (visible != 0)                                                      /* if visible */
         {
-            color &= 0x00FFFFU;                                                          /* get color */
-        #if (SSD1351_AUTO_COLOR_CONVERT == 1)                                            /* if auto color convert */
-            color = ((color&0xF800)>>11) | (color&0x07E0) | ((color&0x001F)<<11);        /* blue green red */
-        #endif
-            if (a_ssd1351_write_byte(handle, (color>>8)&0xFF, SSD1351_DATA) != 0)        /* set 1st */
-            {
-                handle->debug_print("ssd1351: write data failed.\n");                    /* write data failed */
-                
-                return 1;                                                                /* return error */
-            }
-            if (a_ssd1351_write_byte(handle, (color>>0)&0xFF, SSD1351_DATA) != 0)        /* set 2nd */
-            {
-                handle->debug_print("ssd1351: write data failed.\n");                    /* write data failed */
-                
-                return 1;                                                                /* return error */
-            }
-            
-            return 0;                                                                    /* success return 0 */
+            box[num_box] = now;                                                /* set new box */
+            num_box++;                                                         /* box++ */
         }
     }
-    else
+    num_box = a_ssd1351_sprite_merge(box, num_box, a_ssd1351_pixel_bytes(handle));   /* merge boxes */
+    for (i = 0; i < num_box; i++)                                              /* send all boxes */
     {
-        if ((handle->conf_1 & 0x04) != 0)                                                /* CBA */
+        res = a_ssd1351_sprite_compose(handle, sprite, num, &box[i]);          /* compose box */
+        if (res == 2)                                                          /* check band */
         {
-            if (a_ssd1351_write_byte(handle, (color>>16)&0x3F, SSD1351_DATA) != 0)       /* set red */
-            {
-                handle->debug_print("ssd1351: write data failed.\n");                    /* write data failed */
-                
-                return 1;                                                                /* return error */
-            }
-            if (a_ssd1351_write_byte(handle, (color>>8)&0x3F, SSD1351_DATA) != 0)        /* set green */
-            {
-                handle->debug_print("ssd1351: write data failed.\n");                    /* write data failed */
-                
-                return 1;                                                                /* return error */
-            }
-            if (a_ssd1351_write_byte(handle, (color>>0)&0x3F, SSD1351_DATA) != 0)        /* set blue */
-            {
-                handle->debug_print("ssd1351: write data failed.\n");                    /* write data failed */
-                
-                return 1;                                                                /* return error */
-            }
+            handle->debug_print("ssd1351: band buffer is too small.\n");       /* band buffer is too small */
             
-            return 0;                                                                    /* success return 0 */
+            return 7;                                                          /* return error */
         }
-        else                                                                             /* ABC */
+        if (res != 0)                                                          /* check result */
         {
-        #if (SSD1351_AUTO_COLOR_CONVERT == 1)                                            /* if auto color convert */
-            if (a_ssd1351_write_byte(handle, (color>>0)&0x3F, SSD1351_DATA) != 0)        /* set blue */
-            {
-                handle->debug_print("ssd1351: write data failed.\n");                    /* write data failed */
-                
-                return 1;                                                                /* return error */
-            }
-            if (a_ssd1351_write_byte(handle, (color>>8)&0x3F, SSD1351_DATA) != 0)        /* set green */
-            {
-                handle->debug_print("ssd1351: write data failed.\n");                    /* write data failed */
-                
-                return 1;                                                                /* return error */
-            }
-            if (a_ssd1351_write_byte(handle, (color>>16)&0x3F, SSD1351_DATA) != 0)       /* set red */
-            {
-                handle->debug_print("ssd1351: write data failed.\n");                    /* write data failed */
-                
-                return 1;                                                                /* return error */
-            }
-        #else
-            if (a_ssd1351_write_byte(handle, (color>>16)&0x3F, SSD1351_DATA) != 0)       /* set blue */
-            {
-                handle->debug_print("ssd1351: write data failed.\n");                    /* write data failed */
-                
-                return 1;                                                                /* return error */
-            }
-            if (a_ssd1351_write_byte(handle, (color>>8)&0x3F, SSD1351_DATA) != 0)        /* set green */
-            {
-                handle->debug_print("ssd1351: write data failed.\n");                    /* write data failed */
-                
-                return 1;                                                                /* return error */
-            }
-            if (a_ssd1351_write_byte(handle, (color>>0)&0x3F, SSD1351_DATA) != 0)        /* set red */
-            {
-                handle->debug_print("ssd1351: write data failed.\n");                    /* write data failed */
-                
-                return 1;                                                                /* return error */
-            }
-        #endif
-            
-            return 0;                                                                    /* success return 0 */
+            return 1;                                                          /* return error */
         }
     }
-}
-
-/**
- * @brief     draw a char in the display
- * @param[in] *handle pointer to an ssd1351 handle structure
- * @param[in] x coordinate x
- * @param[in] y coordinate y
- * @param[in] chr display char
- * @param[in] size display size
- * @param[in] color display color
- * @return    status code
- *            - 0 success
- *            - 1 show char failed
- * @note      none
- */
-static uint8_t a_ssd1351_show_char(ssd1351_handle_t *handle, uint8_t x, uint8_t y, uint8_t chr, uint8_t size, uint32_t color)
-{
-    uint8_t temp, t, t1;
-    uint8_t y0 = y;
-    uint8_t csize = (size / 8 + ((size % 8) ? 1 : 0)) * (size / 2);        /* get size */
-    
-    chr = chr - ' ';                                                                /* get index */
-    for (t = 0; t < csize; t++)                                                     /* write size */
-    {   
-        if (size == 12)                                                             /* if size 12 */
-        {
-            temp = gsc_ssd1351_ascii_1206[chr][t];                                  /* get ascii 1206 */
-        }
-        else if (size == 16)                                                        /* if size 16 */
-        {
-            temp = gsc_ssd1351_ascii_1608[chr][t];                                  /* get ascii 1608 */
-        }
-        else if(size == 24)                                                         /* if size 24 */
-        {
-            temp = gsc_ssd1351_ascii_2412[chr][t];                                  /* get ascii 2412 */
-        }
-        else
-        {
-            return 1;                                                               /* return error */
-        }
-        for (t1 = 0; t1 < 8; t1++)                                                  /* write one line */
+    for (i = 0; i < num; i++)                                                  /* save the shown boxes */
+    {
+        sprite[i].shown = a_ssd1351_sprite_box(&sprite[i], &now);              /* set shown */
+        if (sprite[i].shown != 0)                                              /* if shown */
         {
-            if ((temp & 0x80) != 0)                                                 /* if 1 */
-            {
-                if (a_ssd1351_draw_point(handle, x, y, color) != 0)                 /* draw point */
-                {
-                    return 1;                                                       /* return error */
-                }
-            }
-            temp <<= 1;                                                             /* left shift 1 */
-            y++;
-            if ((y - y0) == size)                                                   /* reset size */
-            {
-                y = y0;                                                             /* set y */
-                x++;                                                                /* x++ */
-                
-                break;                                                              /* break */
-            }
+            sprite[i].shown_left = (uint8_t)now.left;                          /* set shown left */
+            sprite[i].shown_top = (uint8_t)now.top;                            /* set shown top */
+            sprite[i].shown_right = (uint8_t)now.right;                        /* set shown right */
+            sprite[i].shown_bottom = (uint8_t)now.bottom;                      /* set shown bottom */
+            sprite[i].shown_image = sprite[i].image;                           /* set shown image */
         }
     }
-  
-    return 0;                                                                       /* success return 0 */
+    
+    return 0;                                                                  /* success return 0 */
 }
 
 /**
- * @brief     fill the rect
+ * @brief     draw a picture
  * @param[in] *handle pointer to an ssd1351 handle structure
  * @param[in] left left coordinate x
  * @param[in] top top coordinate y
  * @param[in] right right coordinate x
  * @param[in] bottom bottom coordinate y
- * @param[in] color display color
+ * @param[in] *image pointer to a display image buffer
  * @return    status code
  *            - 0 success
- *            - 1 fill rect failed
+ *            - 1 draw picture failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- * @note      none
- */
-static uint8_t a_ssd1351_fill_rect(ssd1351_handle_t *handle, uint8_t left, uint8_t top, uint8_t right, uint8_t bottom, uint32_t color)
-{
-    uint8_t i, j;  
-    
-    if (handle == NULL)                                                                          /* check handle */
-    {
-        return 2;                                                                                /* return error */
-    }
-    if (handle->inited != 1)                                                                     /* check handle initialization */
-    {
-        return 3;                                                                                /* return error */
-    }
-    if (a_ssd1351_write_byte(handle, SSD1351_CMD_SET_COLUMN_ADDRESS, SSD1351_CMD) != 0)          /* write column address command */
+ *            - 4 left is over 127
+ *            - 5 right is over 127
+ *            - 6 left > right
+ *            - 7 top is over 127
+ *            - 8 bottom is over 127
+ *            - 9 top > bottom
+ * @note      left <= 127 && right <= 127 && left <= right && top <= 127 && bottom <= 127 && top <= bottom
+ */
+uint8_t ssd1351_draw_picture(ssd1351_handle_t *handle, uint8_t left, uint8_t top, uint8_t right, uint8_t bottom, const uint32_t *image)
+{
+    ssd1351_draw_item_t *item;
+    
+    if (handle == NULL)                                                        /* check handle */
     {
-        handle->debug_print("ssd1351: write command failed.\n");                                 /* write command failed */
-        
-        return 1;                                                                                /* return error */
+        return 2;                                                              /* return error */
     }
-    if (a_ssd1351_write_byte(handle, left, SSD1351_DATA) != 0)                                   /* set start address */
+    if (handle->inited != 1)                                                   /* check handle initialization */
     {
-        handle->debug_print("ssd1351: write start address failed.\n");                           /* write start address failed */
-        
-        return 1;                                                                                /* return error */
+        return 3;                                                              /* return error */
     }
-    if (a_ssd1351_write_byte(handle, right, SSD1351_DATA) != 0)                                  /* set end address */
+    if (left > 127)                                                            /* check left */
     {
-        handle->debug_print("ssd1351: write end address failed.\n");                             /* write end address failed */
+        handle->debug_print("ssd1351: left is over 127.\n");                   /* left is over 127 */
         
-        return 1;                                                                                /* return error */
+        return 4;                                                              /* return error */
     }
-    if (a_ssd1351_write_byte(handle, SSD1351_CMD_SET_ROW_ADDRESS, SSD1351_CMD) != 0)             /* write column address command */
+    if (right > 127)                                                           /* check right */
     {
-        handle->debug_print("ssd1351: write command failed.\n");                                 /* write command failed */
+        handle->debug_print("ssd1351: right is over 127.\n");                  /* right is over 127 */
         
-        return 1;                                                                                /* return error */
+        return 5;                                                              /* return error  */
     }
-    if (a_ssd1351_write_byte(handle, top, SSD1351_DATA) != 0)                                    /* set start address */
+    if (left > right)                                                          /* check left and right */
     {
-        handle->debug_print("ssd1351: write start address failed.\n");                           /* write start address failed */
+        handle->debug_print("ssd1351: left > right.\n");                       /* left > right */
         
-        return 1;                                                                                /* return error */
+        return 6;                                                              /* return error */
     }
-    if (a_ssd1351_write_byte(handle, bottom, SSD1351_DATA) != 0)                                 /* set end address */
+    if (top > 127)                                                             /* check top */
     {
-        handle->debug_print("ssd1351: write end address failed.\n");                             /* write end address failed */
+        handle->debug_print("ssd1351: top is over 127.\n");                    /* top is over 127 */
         
-        return 1;                                                                                /* return error */
+        return 7;                                                              /* return error */
     }
-    if (a_ssd1351_write_byte(handle, SSD1351_CMD_WRITE_RAM, SSD1351_CMD) != 0)                   /* set write ram */
+    if (bottom > 127)                                                          /* check bottom */
     {
-        handle->debug_print("ssd1351: write ram failed.\n");                                     /* write ram failed */
+        handle->debug_print("ssd1351: bottom is over 127.\n");                 /* bottom is over 127 */
         
-        return 1;                                                                                /* return error */
+        return 8;                                                              /* return error */
     }
-    if ((handle->conf_1&0xC0) == 0)                                                              /* if 256 */
+    if (top > bottom)                                                          /* check top and bottom */
     {
-        for (i = 0; i < (right - left + 1); i++)                                                 /* x */
-        {
-            for (j = 0; j < (bottom - top + 1); j++)                                             /* y */
-            {
-                if (a_ssd1351_write_byte(handle, color&0xFF, SSD1351_DATA) != 0)                 /* set data */
-                {
-                    handle->debug_print("ssd1351: write data failed.\n");                        /* write data failed */
-                    
-                    return 1;                                                                    /* return error */
-                }
-        
-            }
-        }
+        handle->debug_print("ssd1351: top > bottom.\n");                       /* top > bottom */
         
-        return 0;                                                                                /* success return 0 */
+        return 9;                                                              /* return error */
     }
-    else if ((handle->conf_1&0xC0) == 0x40)                                                      /* if 65K */
+    
+    if (handle->list_buf != NULL)                                              /* if recording */
     {
-        for (i = 0; i < (right - left + 1); i++)                                                 /* x */
+        item = a_ssd1351_list_record(handle, SSD1351_DRAW_PICTURE, 
+                                     left, top, right, bottom, 0, 0);          /* record picture */
+        if (item == NULL)                                                      /* check item */
         {
-            for (j = 0; j < (bottom - top + 1); j++)                                             /* y */
-            {
-                if ((handle->conf_1 & 0x04) != 0)                                                /* CBA */
-                {
-                    color &= 0x00FFFFU;
-                    if (a_ssd1351_write_byte(handle, (color>>8)&0xFF, SSD1351_DATA) != 0)        /* set 1st */
-                    {
-                        handle->debug_print("ssd1351: write data failed.\n");                    /* write data failed */
-                        
-                        return 1;                                                                /* return error */
-                    }
-                    if (a_ssd1351_write_byte(handle, (color>>0)&0xFF, SSD1351_DATA) != 0)        /* set 2nd */
-                    {
-                        handle->debug_print("ssd1351: write data failed.\n");                    /* write data failed */
-                        
-                        return 1;                                                                /* return error */
-                    }
-                }
-                else                                                                             /* ABC */
-                {
-                    color &= 0x00FFFFU;                                                          /* get color */
-                #if (SSD1351_AUTO_COLOR_CONVERT == 1)                                            /* if auto color convert */
-                    color = ((color&0xF800)>>11) | (color&0x07E0) | ((color&0x001F)<<11);        /* blue green red */
-                #endif
-                    if (a_ssd1351_write_byte(handle, (color>>8)&0xFF, SSD1351_DATA) != 0)        /* set 1st */
-                    {
-                        handle->debug_print("ssd1351: write data failed.\n");                    /* write data failed */
-                        
-                        return 1;                                                                /* return error */
-                    }
-                    if (a_ssd1351_write_byte(handle, (color>>0)&0xFF, SSD1351_DATA) != 0)        /* set 2nd */
-                    {
-                        handle->debug_print("ssd1351: write data failed.\n");                    /* write data failed */
-                        
-                        return 1;                                                                /* return error */
-                    }
-                }
-            }
+            return 1;                                                          /* return error */
         }
+        item->data = image;                                                    /* set image */
         
-        return 0;                                                                                /* success return 0 */
-    }
-    else
-    {
-        for (i = 0; i < (right - left + 1); i++)                                                 /* x */
-        {
-            for (j = 0; j < (bottom - top + 1); j++)                                             /* y */
-            {
-                if ((handle->conf_1 & 0x04) != 0)                                                /* CBA */
-                {
-                    if (a_ssd1351_write_byte(handle, (color>>16)&0x3F, SSD1351_DATA) != 0)       /* set red */
-                    {
-                        handle->debug_print("ssd1351: write data failed.\n");                    /* write data failed */
-                        
-                        return 1;                                                                /* return error */
-                    }
-                    if (a_ssd1351_write_byte(handle, (color>>8)&0x3F, SSD1351_DATA) != 0)        /* set green */
-                    {
-                        handle->debug_print("ssd1351: write data failed.\n");                    /* write data failed */
-                        
-                        return 1;                                                                /* return error */
-                    }
-                    if (a_ssd1351_write_byte(handle, (color>>0)&0x3F, SSD1351_DATA) != 0)        /* set blue */
-                    {
-                        handle->debug_print("ssd1351: write data failed.\n");                    /* write data failed */
-                        
-                        return 1;                                                                /* return error */
-                    }
-                }
-                else                                                                             /* ABC */
-                {
-                #if (SSD1351_AUTO_COLOR_CONVERT == 1)                                            /* if auto color convert */
-                    if (a_ssd1351_write_byte(handle, (color>>0)&0x3F, SSD1351_DATA) != 0)        /* set blue */
-                    {
-                        handle->debug_print("ssd1351: write data failed.\n");                    /* write data failed */
-                        
-                        return 1;                                                                /* return error */
-                    }
-                    if (a_ssd1351_write_byte(handle, (color>>8)&0x3F, SSD1351_DATA) != 0)        /* set green */
-                    {
-                        handle->debug_print("ssd1351: write data failed.\n");                    /* write data failed */
-                        
-                        return 1;                                                                /* return error */
-                    }
-                    if (a_ssd1351_write_byte(handle, (color>>16)&0x3F, SSD1351_DATA) != 0)       /* set red */
-                    {
-                        handle->debug_print("ssd1351: write data failed.\n");                    /* write data failed */
-                        
-                        return 1;                                                                /* return error */
-                    }
-                #else
-                    if (a_ssd1351_write_byte(handle, (color>>16)&0x3F, SSD1351_DATA) != 0)       /* set blue */
-                    {
-                        handle->debug_print("ssd1351: write data failed.\n");                    /* write data failed */
-                        
-                        return 1;                                                                /* return error */
-                    }
-                    if (a_ssd1351_write_byte(handle, (color>>8)&0x3F, SSD1351_DATA) != 0)        /* set green */
-                    {
-                        handle->debug_print("ssd1351: write data failed.\n");                    /* write data failed */
-                        
-                        return 1;                                                                /* return error */
-                    }
-                    if (a_ssd1351_write_byte(handle, (color>>0)&0x3F, SSD1351_DATA) != 0)        /* set red */
-                    {
-                        handle->debug_print("ssd1351: write data failed.\n");                    /* write data failed */
-                        
-                        return 1;                                                                /* return error */
-                    }
-                #endif
-                }
-            }
-        }
-
-        return 0;                                                                                /* success return 0 */
+        return 0;                                                              /* success return 0 */
     }
+    
+    return a_ssd1351_draw_picture(handle, left, top, right, bottom, image);    /* draw picture */
 }
 
 /**
- * @brief     draw the picture
+ * @brief     draw a 16 bits picture
  * @param[in] *handle pointer to an ssd1351 handle structure
  * @param[in] left left coordinate x
  * @param[in] top top coordinate y
  * @param[in] right right coordinate x
  * @param[in] bottom bottom coordinate y
- * @param[in] *color pointer to an image buffer
+ * @param[in] *image pointer to a display image buffer
  * @return    status code
  *            - 0 success
  *            - 1 draw picture failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- * @note      none
+ *            - 4 left is over 127
+ *            - 5 right is over 127
+ *            - 6 left > right
+ *            - 7 top is over 127
+ *            - 8 bottom is over 127
+ *            - 9 top > bottom
+ * @note      left <= 127 && right <= 127 && left <= right && top <= 127 && bottom <= 127 && top <= bottom
  */
-static uint8_t a_ssd1351_draw_picture(ssd1351_handle_t *handle, uint8_t left, uint8_t top, uint8_t right, uint8_t bottom, uint32_t *color)
+uint8_t ssd1351_draw_picture_16bits(ssd1351_handle_t *handle, uint8_t left, uint8_t top, uint8_t right, uint8_t bottom, const uint16_t *image)
 {
-    uint8_t i, j;  
-    uint32_t p;
+    ssd1351_draw_item_t *item;
     
-    if (handle == NULL)                                                                          /* check handle */
-    {
-        return 2;                                                                                /* return error */
-    }
-    if (handle->inited != 1)                                                                     /* check handle initialization */
-    {
-        return 3;                                                                                /* return error */
-    }
-    if (a_ssd1351_write_byte(handle, SSD1351_CMD_SET_COLUMN_ADDRESS, SSD1351_CMD) != 0)          /* write column address command */
+    if (handle == NULL)                                                                   /* check handle */
     {
-        handle->debug_print("ssd1351: write command failed.\n");                                 /* write command failed */
-        
-        return 1;                                                                                /* return error */
+        return 2;                                                                         /* return error */
     }
-    if (a_ssd1351_write_byte(handle, left, SSD1351_DATA) != 0)                                   /* set start address */
+    if (handle->inited != 1)                                                              /* check handle initialization */
     {
-        handle->debug_print("ssd1351: write start address failed.\n");                           /* write start address failed */
-        
-        return 1;                                                                                /* return error */
+        return 3;                                                                         /* return error */
     }
-    if (a_ssd1351_write_byte(handle, right, SSD1351_DATA) != 0)                                  /* set end address */
+    if (left > 127)                                                                       /* check left */
     {
-        handle->debug_print("ssd1351: write end address failed.\n");                             /* write end address failed */
+        handle->debug_print("ssd1351: left is over 127.\n");                              /* left is over 127 */
         
-        return 1;                                                                                /* return error */
+        return 4;                                                                         /* return error */
     }
-    if (a_ssd1351_write_byte(handle, SSD1351_CMD_SET_ROW_ADDRESS, SSD1351_CMD) != 0)             /* write column address command */
+    if (right > 127)                                                                      /* check right */
     {
-        handle->debug_print("ssd1351: write command failed.\n");                                 /* write command failed */
+        handle->debug_print("ssd1351: right is over 127.\n");                             /* right is over 127 */
         
-        return 1;                                                                                /* return error */
+        return 5;                                                                         /* return error */
     }
-    if (a_ssd1351_write_byte(handle, top, SSD1351_DATA) != 0)                                    /* set start address */
+    if (left > right)                                                                     /* check left and right */
     {
-        handle->debug_print("ssd1351: write start address failed.\n");                           /* write start address failed */
+        handle->debug_print("ssd1351: left > right.\n");                                  /* left > right */
         
-        return 1;                                                                                /* return error */
+        return 6;                                                                         /* return error */
     }
-    if (a_ssd1351_write_byte(handle, bottom, SSD1351_DATA) != 0)                                 /* set end address */
+    if (top > 127)                                                                        /* check top */
     {
-        handle->debug_print("ssd1351: write end address failed.\n");                             /* write end address failed */
+        handle->debug_print("ssd1351: top is over 127.\n");                               /* top is over 127 */
         
-        return 1;                                                                                /* return error */
+        return 7;                                                                         /* return error */
     }
-    if (a_ssd1351_write_byte(handle, SSD1351_CMD_WRITE_RAM, SSD1351_CMD) != 0)                   /* set write ram */
+    if (bottom > 127)                                                                     /* check bottom */
     {
-        handle->debug_print("ssd1351: write ram failed.\n");                                     /* write ram failed */
+        handle->debug_print("ssd1351: bottom is over 127.\n");                            /* bottom is over 127 */
         
-        return 1;                                                                                /* return error */
+        return 8;                                                                         /* return error */
     }
-    if ((handle->conf_1 & 0xC0) == 0)                                                            /* if 256 */
+    if (top > bottom)                                                                     /* check top and bottom */
     {
-        if ((handle->conf_1 & 0x01) != 0)                                                        /* if vertical */
-        {
-            p = 0;                                                                               /* set zero */
-            for (j = 0; j < (bottom - top + 1); j++)                                             /* x */
-            {
-                for (i = 0; i < (right - left + 1); i++)                                         /* y */
-                {
-                    if (a_ssd1351_write_byte(handle, color[p]&0xFF, SSD1351_DATA) != 0)          /* set data */
-                    {
-                        handle->debug_print("ssd1351: write data failed.\n");                    /* write data failed */
-                        
-                        return 1;                                                                /* return error */
-                    }
-                    p++;                                                                         /* p++ */
-                }
-            }
-        }
-        else                                                                                     /* if horizontal */
-        {
-            p = 0;                                                                               /* set zero */
-            for (i = 0; i < (right - left + 1); i++)                                             /* x */
-            {
-                for (j = 0; j < (bottom - top + 1); j++)                                         /* y */
-                {
-                    if (a_ssd1351_write_byte(handle, color[p]&0xFF, SSD1351_DATA) != 0)          /* set data */
-                    {
-                        handle->debug_print("ssd1351: write data failed.\n");                    /* write data failed */
-                        
-                        return 1;                                                                /* return error */
-                    }
-                    p++;                                                                         /* p++ */
-                }
-            }
-        }
+        handle->debug_print("ssd1351: top > bottom.\n");                                  /* top > bottom */
         
-        return 0;                                                                                /* success return 0 */
+        return 9;                                                                         /* return error */
     }
-    else if ((handle->conf_1&0xC0) == 0x40)                                                      /* if 65K */
+    
+    if ((handle->list_buf != NULL) && (SSD1351_CONF_DEPTH(handle) <= 0x40))               /* if recording */
     {
-        if ((handle->conf_1 & 0x01) != 0)                                                        /* if vertical */
-        {
-            p = 0;
-            for (j = 0; j < (bottom - top + 1); j++)                                             /* x */
-            {
-                for (i = 0; i < (right - left + 1); i++)                                         /* y */
-                {
-                    if ((handle->conf_1 & 0x04) != 0)                                            /* CBA */
-                    {
-                        color[p] &= 0x00FFFFU;
-                        if (a_ssd1351_write_byte(handle, (color[p]>>8)&0xFF, SSD1351_DATA) != 0) /* set 1st */
-                        {
-                            handle->debug_print("ssd1351: write data failed.\n");                /* write data failed */
-                            
-                            return 1;                                                            /* return error */
-                        }
-                        if (a_ssd1351_write_byte(handle, (color[p]>>0)&0xFF, SSD1351_DATA) != 0) /* set 2nd */
-                        {
-                            handle->debug_print("ssd1351: write data failed.\n");                /* write data failed */
-                            
-                            return 1;                                                            /* return error */
-                        }
-                    }
-                    else                                                                         /* ABC */
-                    {
-                        color[p] &= 0x00FFFFU;                                                   /* get color */
-                    #if (SSD1351_AUTO_COLOR_CONVERT == 1)                                        /* if auto convert */
-                        color[p] = ((color[p]&0xF800)>>11) | (color[p]&0x07E0) |                 /* convert color */
-                                   ((color[p]&0x001F)<<11);                                      /* blue green red */
-                    #endif
-                        if (a_ssd1351_write_byte(handle, (color[p]>>8)&0xFF, SSD1351_DATA) != 0) /* set 1st */
-                        {
-                            handle->debug_print("ssd1351: write data failed.\n");                /* write data failed */
-                            
-                            return 1;                                                            /* return error */
-                        }
-                        if (a_ssd1351_write_byte(handle, (color[p]>>0)&0xFF, SSD1351_DATA) != 0) /* set 2nd */
-                        {
-                            handle->debug_print("ssd1351: write data failed.\n");                /* write data failed */
-                            
-                            return 1;                                                            /* return error */
-                        }
-                    }
-                    p++;                                                                         /* p++ */
-                }
-            }
-        }
-        else                                                                                     /* if horizontal */
+        item = a_ssd1351_list_record(handle, SSD1351_DRAW_PICTURE_16BITS, 
+                                     left, top, right, bottom, 0, 0);                     /* record picture */
+        if (item == NULL)                                                                 /* check item */
         {
-            p = 0;
-            for (i = 0; i < (right - left + 1); i++)                                             /* x */
-            {
-                for (j = 0; j < (bottom - top + 1); j++)                                         /* y */
-                {
-                    if ((handle->conf_1 & 0x04) != 0)                                            /* CBA */
-                    {
-                        color[p] &= 0x00FFFFU;
-                        if (a_ssd1351_write_byte(handle, (color[p]>>8)&0xFF, SSD1351_DATA) != 0) /* set 1st */
-                        {
-                            handle->debug_print("ssd1351: write data failed.\n");                /* write data failed */
-                            
-                            return 1;                                                            /* return error */
-                        }
-                        if (a_ssd1351_write_byte(handle, (color[p]>>0)&0xFF, SSD1351_DATA) != 0) /* set 2nd */
-                        {
-                            handle->debug_print("ssd1351: write data failed.\n");                /* write data failed */
-                            
-                            return 1;                                                            /* return error */
-                        }
-                    }
-                    else                                                                         /* ABC */
-                    {
-                        color[p] &= 0x00FFFFU;                                                   /* get color */
-                    #if (SSD1351_AUTO_COLOR_CONVERT == 1)                                        /* if auto convert */
-                        color[p] = ((color[p]&0xF800)>>11) | (color[p]&0x07E0) |                 /* convert color */
-                                   ((color[p]&0x001F)<<11);                                      /* blue green red */
-                    #endif
-                        if (a_ssd1351_write_byte(handle, (color[p]>>8)&0xFF, SSD1351_DATA) != 0) /* set 1st */
-                        {
-                            handle->debug_print("ssd1351: write data failed.\n");                /* write data failed */
-                            
-                            return 1;                                                            /* return error */
-                        }
-                        if (a_ssd1351_write_byte(handle, (color[p]>>0)&0xFF, SSD1351_DATA) != 0) /* set 2nd */
-                        {
-                            handle->debug_print("ssd1351: write data failed.\n");                /* write data failed */
-                            
-                            return 1;                                                            /* return error */
-                        }
-                    }
-                    p++;                                                                         /* p++ */
-                }
-            }
+            return 1;                                                                     /* return error */
         }
+        item->data = image;                                                               /* set image */
         
-        return 0;                                                                                /* success return 0 */
-    }
-    else
-    {
-        if ((handle->conf_1 & 0x01) != 0)                                                        /* if vertical */
-        {
-            p = 0;                                                                               /* set zero */
-            for (j = 0; j < (bottom - top + 1); j++)                                             /* x */
-            {
-                for (i = 0; i < (right - left + 1); i++)                                         /* y */
-                {
-                    if ((handle->conf_1 & 0x04) != 0)                                            /* CBA */
-                    {
-                        if (a_ssd1351_write_byte(handle, (color[p]>>16)&0x3F, SSD1351_DATA) != 0)/* set red */
-                        {
-                            handle->debug_print("ssd1351: write data failed.\n");                /* write data failed */
-                            
-                            return 1;                                                            /* return error */
-                        }
-                        if (a_ssd1351_write_byte(handle, (color[p]>>8)&0x3F, SSD1351_DATA) != 0) /* set green */
-                        {
-                            handle->debug_print("ssd1351: write data failed.\n");                /* write data failed */
-                            
-                            return 1;                                                            /* return error */
-                        }
-                        if (a_ssd1351_write_byte(handle, (color[p]>>0)&0x3F, SSD1351_DATA) != 0) /* set blue */
-                        {
-                            handle->debug_print("ssd1351: write data failed.\n");                /* write data failed */
-                            
-                            return 1;                                                            /* return error */
-                        }
-                    }
-                    else                                                                         /* ABC */
-                    {
-                    #if (SSD1351_AUTO_COLOR_CONVERT == 1)                                        /* if auto convert */
-                        if (a_ssd1351_write_byte(handle, (color[p]>>0)&0x3F, SSD1351_DATA) != 0) /* set blue */
-                        {
-                            handle->debug_print("ssd1351: write data failed.\n");                /* write data failed */
-                            
-                            return 1;                                                            /* return error */
-                        }
-                        if (a_ssd1351_write_byte(handle, (color[p]>>8)&0x3F, SSD1351_DATA) != 0) /* set green */
-                        {
-                            handle->debug_print("ssd1351: write data failed.\n");                /* write data failed */
-                            
-                            return 1;                                                            /* return error */
-                        }
-                        if (a_ssd1351_write_byte(handle, (color[p]>>16)&0x3F, SSD1351_DATA) != 0)/* set red */
-                        {
-                            handle->debug_print("ssd1351: write data failed.\n");                /* write data failed */
-                            
-                            return 1;                                                            /* return error */
-                        }
-                    #else
-                        if (a_ssd1351_write_byte(handle, (color[p]>>16)&0x3F, SSD1351_DATA) != 0)/* set blue */
-                        {
-                            handle->debug_print("ssd1351: write data failed.\n");                /* write data failed */
-                            
-                            return 1;                                                            /* return error */
-                        }
-                        if (a_ssd1351_write_byte(handle, (color[p]>>8)&0x3F, SSD1351_DATA) != 0) /* set green */
-                        {
-                            handle->debug_print("ssd1351: write data failed.\n");                /* write data failed */
-                            
-                            return 1;                                                            /* return error */
-                        }
-                        if (a_ssd1351_write_byte(handle, (color[p]>>0)&0x3F, SSD1351_DATA) != 0) /* set red */
-                        {
-                            handle->debug_print("ssd1351: write data failed.\n");                /* write data failed */
-                            
-                            return 1;                                                            /* return error */
-                        }
-                    #endif
-                    }
-                    p++;                                                                         /* p++ */
-                }
-            }
-        }
-        else                                                                                     /* if horizontal */
-        {
-            p = 0;                                                                               /* set zero */
-            for (i = 0; i < (right - left + 1); i++)                                             /* x */
-            {
-                for (j = 0; j < (bottom - top + 1); j++)                                         /* y */
-                {
-                    if ((handle->conf_1 & 0x04) != 0)                                            /* CBA */
-                    {
-                        if (a_ssd1351_write_byte(handle, (color[p]>>16)&0x3F, SSD1351_DATA) != 0)/* set red */
-                        {
-                            handle->debug_print("ssd1351: write data failed.\n");                /* write data failed */
-                            
-                            return 1;                                                            /* return error */
-                        }
-                        if (a_ssd1351_write_byte(handle, (color[p]>>8)&0x3F, SSD1351_DATA) != 0) /* set green */
-                        {
-                            handle->debug_print("ssd1351: write data failed.\n");                /* write data failed */
-                            
-                            return 1;                                                            /* return error */
-                        }
-                        if (a_ssd1351_write_byte(handle, (color[p]>>0)&0x3F, SSD1351_DATA) != 0) /* set blue */
-                        {
-                            handle->debug_print("ssd1351: write data failed.\n");                /* write data failed */
-                            
-                            return 1;                                                            /* return error */
-                        }
-                    }
-                    else                                                                         /* ABC */
-                    {
-                    #if (SSD1351_AUTO_COLOR_CONVERT == 1)                                        /* if auto convert */
-                        if (a_ssd1351_write_byte(handle, (color[p]>>0)&0x3F, SSD1351_DATA) != 0) /* set blue */
-                        {
-                            handle->debug_print("ssd1351: write data failed.\n");                /* write data failed */
-                            
-                            return 1;                                                            /* return error */
-                        }
-                        if (a_ssd1351_write_byte(handle, (color[p]>>8)&0x3F, SSD1351_DATA) != 0) /* set green */
-                        {
-                            handle->debug_print("ssd1351: write data failed.\n");                /* write data failed */
-                            
-                            return 1;                                                            /* return error */
-                        }
-                        if (a_ssd1351_write_byte(handle, (color[p]>>16)&0x3F, SSD1351_DATA) != 0)/* set red */
-                        {
-                            handle->debug_print("ssd1351: write data failed.\n");                /* write data failed */
-                            
-                            return 1;                                                            /* return error */
-                        }
-                    #else
-                        if (a_ssd1351_write_byte(handle, (color[p]>>16)&0x3F, SSD1351_DATA) != 0)/* set blue */
-                        {
-                            handle->debug_print("ssd1351: write data failed.\n");                /* write data failed */
-                            
-                            return 1;                                                            /* return error */
-                        }
-                        if (a_ssd1351_write_byte(handle, (color[p]>>8)&0x3F, SSD1351_DATA) != 0) /* set green */
-                        {
-                            handle->debug_print("ssd1351: write data failed.\n");                /* write data failed */
-                            
-                            return 1;                                                            /* return error */
-                        }
-                        if (a_ssd1351_write_byte(handle, (color[p]>>0)&0x3F, SSD1351_DATA) != 0) /* set red */
-                        {
-                            handle->debug_print("ssd1351: write data failed.\n");                /* write data failed */
-                            
-                            return 1;                                                            /* return error */
-                        }
-                    #endif
-                    }
-                    p++;                                                                         /* p++ */
-                }
-            }
-        }
-
-        return 0;                                                                                /* success return 0 */
+        return 0;                                                                         /* success return 0 */
     }
+    
+    return a_ssd1351_draw_picture_16_bits(handle, left, top, right, bottom, image);       /* draw picture */
 }
 
 /**
- * @brief     draw the 16 bits picture
+ * @brief     draw a rgb888 or rgba8888 picture
  * @param[in] *handle pointer to an ssd1351 handle structure
  * @param[in] left left coordinate x
  * @param[in] top top coordinate y
  * @param[in] right right coordinate x
  * @param[in] bottom bottom coordinate y
- * @param[in] *color pointer to an image buffer
+ * @param[in] *image pointer to a source image buffer
+ * @param[in] format source pixel format
  * @return    status code
  *            - 0 success
  *            - 1 draw picture failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- * @note      none
- */
-static uint8_t a_ssd1351_draw_picture_16_bits(ssd1351_handle_t *handle, uint8_t left, uint8_t top, uint8_t right, uint8_t bottom, uint16_t *color)
-{
-    uint8_t i, j;  
-    uint32_t p;
-    
-    if (handle == NULL)                                                                          /* check handle */
-    {
-        return 2;                                                                                /* return error */
-    }
-    if (handle->inited != 1)                                                                     /* check handle initialization */
-    {
-        return 3;                                                                                /* return error */
-    }
-    if (a_ssd1351_write_byte(handle, SSD1351_CMD_SET_COLUMN_ADDRESS, SSD1351_CMD) != 0)          /* write column address command */
-    {
-        handle->debug_print("ssd1351: write command failed.\n");                                 /* write command failed */
-        
-        return 1;                                                                                /* return error */
-    }
-    if (a_ssd1351_write_byte(handle, left, SSD1351_DATA) != 0)                                   /* set start address */
+ *            - 4 left is over 127
+ *            - 5 right is over 127
+ *            - 6 left > right
+ *            - 7 top is over 127
+ *            - 8 bottom is over 127
+ *            - 9 top > bottom
+ *            - 10 format is invalid
+ * @note      left <= 127 && right <= 127 && left <= right && top <= 127 && bottom <= 127 && top <= bottom
+ */
+uint8_t ssd1351_draw_picture_rgb888(ssd1351_handle_t *handle, uint8_t left, uint8_t top, uint8_t right, uint8_t bottom, 
+                                    const uint8_t *image, ssd1351_color_format_t format)
+{
+    if (handle == NULL)                                                        /* check handle */
     {
-        handle->debug_print("ssd1351: write start address failed.\n");                           /* write start address failed */
-        
-        return 1;                                                                                /* return error */
+        return 2;                                                              /* return error */
     }
-    if (a_ssd1351_write_byte(handle, right, SSD1351_DATA) != 0)                                  /* set end address */
+    if (handle->inited != 1)                                                   /* check handle initialization */
     {
-        handle->debug_print("ssd1351: write end address failed.\n");                             /* write end address failed */
-        
-        return 1;                                                                                /* return error */
+        return 3;                                                              /* return error */
     }
-    if (a_ssd1351_write_byte(handle, SSD1351_CMD_SET_ROW_ADDRESS, SSD1351_CMD) != 0)             /* write column address command */
+    if (left > 127)                                                            /* check left */
     {
-        handle->debug_print("ssd1351: write command failed.\n");                                 /* write command failed */
+        handle->debug_print("ssd1351: left is over 127.\n");                   /* left is over 127 */
         
-        return 1;                                                                                /* return error */
+        return 4;                                                              /* return error */
     }
-    if (a_ssd1351_write_byte(handle, top, SSD1351_DATA) != 0)                                    /* set start address */
+    if (right > 127)                                                           /* check right */
     {
-        handle->debug_print("ssd1351: write start address failed.\n");                           /* write start address failed */
+        handle->debug_print("ssd1351: right is over 127.\n");                  /* right is over 127 */
         
-        return 1;                                                                                /* return error */
+        return 5;                                                              /* return error  */
     }
-    if (a_ssd1351_write_byte(handle, bottom, SSD1351_DATA) != 0)                                 /* set end address */
+    if (left > right)                                                          /* check left and right */
     {
-        handle->debug_print("ssd1351: write end address failed.\n");                             /* write end address failed */
+        handle->debug_print("ssd1351: left > right.\n");                       /* left > right */
         
-        return 1;                                                                                /* return error */
+        return 6;                                                              /* return error */
     }
-    if (a_ssd1351_write_byte(handle, SSD1351_CMD_WRITE_RAM, SSD1351_CMD) != 0)                   /* set write ram */
+    if (top > 127)                                                             /* check top */
     {
-        handle->debug_print("ssd1351: write ram failed.\n");                                     /* write ram failed */
+        handle->debug_print("ssd1351: top is over 127.\n");                    /* top is over 127 */
         
-        return 1;                                                                                /* return error */
+        return 7;                                                              /* return error */
     }
-    if ((handle->conf_1&0xC0) == 0)                                                              /* if 256 */
+    if (bottom > 127)                                                          /* check bottom */
     {
-        if ((handle->conf_1 & 0x01) != 0)                                                        /* if vertical */
-        {
-            p = 0;                                                                               /* set zero */
-            for (j = 0; j < (bottom - top + 1); j++)                                             /* x */
-            {
-                for (i = 0; i < (right - left + 1); i++)                                         /* y */
-                {
-                    if (a_ssd1351_write_byte(handle, color[p]&0xFF, SSD1351_DATA) != 0)          /* set data */
-                    {
-                        handle->debug_print("ssd1351: write data failed.\n");                    /* write data failed */
-                        
-                        return 1;                                                                /* return error */
-                    }
-                    p++;                                                                         /* p++ */
-                }
-            }
-        }
-        else                                                                                     /* if horizontal */
-        {
-            p = 0;                                                                               /* set zero */
-            for (i = 0; i < (right - left + 1); i++)                                             /* x */
-            {
-                for (j = 0; j < (bottom - top + 1); j++)                                         /* y */
-                {
-                    if (a_ssd1351_write_byte(handle, color[p]&0xFF, SSD1351_DATA) != 0)          /* set data */
-                    {
-                        handle->debug_print("ssd1351: write data failed.\n");                    /* write data failed */
-                        
-                        return 1;                                                                /* return error */
-                    }
-                    p++;                                                                         /* p++ */
-                }
-            }
-        }
+        handle->debug_print("ssd1351: bottom is over 127.\n");                 /* bottom is over 127 */
         
-        return 0;                                                                                /* success return 0 */
+        return 8;                                                              /* return error */
     }
-    else if ((handle->conf_1&0xC0) == 0x40)                                                      /* if 65K */
+    if (top > bottom)                                                          /* check top and bottom */
     {
-        if ((handle->conf_1 & 0x01) != 0)                                                        /* if vertical */
-        {
-            p = 0;
-            for (j = 0; j < (bottom - top + 1); j++)                                             /* x */
-            {
-                for (i = 0; i < (right - left + 1); i++)                                         /* y */
-                {
-                    if ((handle->conf_1 & 0x04) != 0)                                            /* CBA */
-                    {
-                        color[p] &= 0x00FFFFU;
-                        if (a_ssd1351_write_byte(handle, (color[p]>>8)&0xFF, SSD1351_DATA) != 0) /* set 1st */
-                        {
-                            handle->debug_print("ssd1351: write data failed.\n");                /* write data failed */
-                            
-                            return 1;                                                            /* return error */
-                        }
-                        if (a_ssd1351_write_byte(handle, (color[p]>>0)&0xFF, SSD1351_DATA) != 0) /* set 2nd */
-                        {
-                            handle->debug_print("ssd1351: write data failed.\n");                /* write data failed */
-                            
-                            return 1;                                                            /* return error */
-                        }
-                    }
-                    else                                                                         /* ABC */
-                    {
-                        color[p] &= 0x00FFFFU;                                                   /* get color */
-                    #if (SSD1351_AUTO_COLOR_CONVERT == 1)                                        /* if auto convert */
-                        color[p] = ((color[p]&0xF800)>>11) | (color[p]&0x07E0) |                 /* convert color */
-                                   ((color[p]&0x001F)<<11);                                      /* blue green red */
-                    #endif
-                        if (a_ssd1351_write_byte(handle, (color[p]>>8)&0xFF, SSD1351_DATA) != 0) /* set 1st */
-                        {
-                            handle->debug_print("ssd1351: write data failed.\n");                /* write data failed */
-                            
-                            return 1;                                                            /* return error */
-                        }
-                        if (a_ssd1351_write_byte(handle, (color[p]>>0)&0xFF, SSD1351_DATA) != 0) /* set 2nd */
-                        {
-                            handle->debug_print("ssd1351: write data failed.\n");                /* write data failed */
-                            
-                            return 1;                                                            /* return error */
-                        }
-                    }
-                    p++;                                                                         /* p++ */
-                }
-            }
-        }
-        else                                                                                     /* if horizontal */
-        {
-            p = 0;
-            for (i = 0; i < (right - left + 1); i++)                                             /* x */
-            {
-                for (j = 0; j < (bottom - top + 1); j++)                                         /* y */
-                {
-                    if ((handle->conf_1 & 0x04) != 0)                                            /* CBA */
-                    {
-                        color[p] &= 0x00FFFFU;                                                   /* get color */
-                        if (a_ssd1351_write_byte(handle, (color[p]>>8)&0xFF, SSD1351_DATA) != 0) /* set 1st */
-                        {
-                            handle->debug_print("ssd1351: write data failed.\n");                /* write data failed */
-                            
-                            return 1;                                                            /* return error */
-                        }
-                        if (a_ssd1351_write_byte(handle, (color[p]>>0)&0xFF, SSD1351_DATA) != 0) /* set 2nd */
-                        {
-                            handle->debug_print("ssd1351: write data failed.\n");                /* write data failed */
-                            
-                            return 1;                                                            /* return error */
-                        }
-                    }
-                    else                                                                         /* ABC */
-                    {
-                        color[p] &= 0x00FFFFU;                                                   /* get color */
-                    #if (SSD1351_AUTO_COLOR_CONVERT == 1)                                        /* if auto convert */
-                        color[p] = ((color[p]&0xF800)>>11) | (color[p]&0x07E0) |                 /* convert color */
-                                   ((color[p]&0x001F)<<11);                                      /* blue green red */
-                    #endif
-                        if (a_ssd1351_write_byte(handle, (color[p]>>8)&0xFF, SSD1351_DATA) != 0) /* set 1st */
-                        {
-                            handle->debug_print("ssd1351: write data failed.\n");                /* write data failed */
-                            
-                            return 1;                                                            /* return error */
-                        }
-                        if (a_ssd1351_write_byte(handle, (color[p]>>0)&0xFF, SSD1351_DATA) != 0) /* set 2nd */
-                        {
-                            handle->debug_print("ssd1351: write data failed.\n");                /* write data failed */
-                            
-                            return 1;                                                            /* return error */
-                        }
-                    }
-                    p++;                                                                         /* p++ */
-                }
-            }
-        }
+        handle->debug_print("ssd1351: top > bottom.\n");                       /* top > bottom */
         
-        return 0;                                                                                /* success return 0 */
+        return 9;                                                              /* return error */
     }
-    else
+    if ((format != SSD1351_COLOR_FORMAT_RGB888) && (format != SSD1351_COLOR_FORMAT_RGBA8888))  /* check format */
     {
-        handle->debug_print("ssd1351: 262K color format can't use this function.\n");            /* write data failed */
+        handle->debug_print("ssd1351: format is invalid.\n");                  /* format is invalid */
         
-        return 1;                                                                                /* success return 0 */
+        return 10;                                                             /* return error */
     }
+    
+    return a_ssd1351_draw_picture_rgb888(handle, left, top, right, bottom, image, format);  /* draw picture */
 }
 
 /**
- * @brief     draw a point in the display
+ * @brief     draw a raw panel format picture
  * @param[in] *handle pointer to an ssd1351 handle structure
- * @param[in] x coordinate x
- * @param[in] y coordinate y
- * @param[in] color point color
+ * @param[in] left left coordinate x
+ * @param[in] top top coordinate y
+ * @param[in] right right coordinate x
+ * @param[in] bottom bottom coordinate y
+ * @param[in] *data pointer to a panel format data buffer
+ * @param[in] len length of the data buffer
  * @return    status code
  *            - 0 success
- *            - 1 draw point failed
+ *            - 1 draw raw failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- *            - 4 x is over 127
- *            - 5 y is over 127
- * @note      x <= 127 && y <= 127
+ *            - 4 left is over 127
+ *            - 5 right is over 127
+ *            - 6 left > right
+ *            - 7 top is over 127
+ *            - 8 bottom is over 127
+ *            - 9 top > bottom
+ *            - 10 len is invalid
+ * @note      left <= 127 && right <= 127 && left <= right && top <= 127 && bottom <= 127 && top <= bottom
  */
-uint8_t ssd1351_draw_point(ssd1351_handle_t *handle, uint8_t x, uint8_t y, uint32_t color)
+uint8_t ssd1351_draw_raw(ssd1351_handle_t *handle, uint8_t left, uint8_t top, uint8_t right, uint8_t bottom, 
+                         const uint8_t *data, uint32_t len)
 {
-    if (handle == NULL)                                          /* check handle */
+    if (handle == NULL)                                                        /* check handle */
     {
-        return 2;                                                /* return error */
+        return 2;                                                              /* return error */
     }
-    if (handle->inited != 1)                                     /* check handle initialization */
+    if (handle->inited != 1)                                                   /* check handle initialization */
     {
-        return 3;                                                /* return error */
+        return 3;                                                              /* return error */
     }
-    if (x > 127)                                                 /* check x */
+    if (left > 127)                                                            /* check left */
     {
-        handle->debug_print("ssd1351: x is over 127.\n");        /* x is over 127 */
+        handle->debug_print("ssd1351: left is over 127.\n");                   /* left is over 127 */
         
-        return 4;                                                /* return error */
+        return 4;                                                              /* return error */
     }
-    if (y > 127)                                                 /* check y */
+    if (right > 127)                                                           /* check right */
     {
-        handle->debug_print("ssd1351: y is over 127.\n");        /* y is over 127 */
+        handle->debug_print("ssd1351: right is over 127.\n");                  /* right is over 127 */
         
-        return 5;                                                /* return error */
+        return 5;                                                              /* return error  */
     }
-    
-    return a_ssd1351_draw_point(handle, x, y, color);            /* draw point */
-}
-
-/**
- * @brief     write a string in the display
- * @param[in] *handle pointer to an ssd1351 handle structure
- * @param[in] x coordinate x
- * @param[in] y coordinate y
- * @param[in] *str pointer to a written string address
- * @param[in] len length of the string
- * @param[in] color display color
- * @param[in] font string font
- * @return    status code
- *            - 0 success
- *            - 1 draw point failed
- *            - 2 handle is NULL
- *            - 3 handle is not initialized
- *            - 4 x or y is invalid
- * @note      x <= 127 && y <= 127
- */
-uint8_t ssd1351_write_string(ssd1351_handle_t *handle, uint8_t x, uint8_t y, char *str, uint16_t len, uint32_t color, ssd1351_font_t font)
-{    
-    if (handle == NULL)                                                      /* check handle */
+    if (left > right)                                                          /* check left and right */
     {
-        return 2;                                                            /* return error */
+        handle->debug_print("ssd1351: left > right.\n");                       /* left > right */
+        
+        return 6;                                                              /* return error */
     }
-    if (handle->inited != 1)                                                 /* check handle initialization */
+    if (top > 127)                                                             /* check top */
     {
-        return 3;                                                            /* return error */
+        handle->debug_print("ssd1351: top is over 127.\n");                    /* top is over 127 */
+        
+        return 7;                                                              /* return error */
     }
-    if((x > 127) || (y > 127))                                               /* check x, y */
+    if (bottom > 127)                                                          /* check bottom */
     {
-        handle->debug_print("ssd1351: x or y is invalid.\n");                /* x or y is invalid */
+        handle->debug_print("ssd1351: bottom is over 127.\n");                 /* bottom is over 127 */
         
-        return 4;                                                            /* return error */
+        return 8;                                                              /* return error */
     }
-    
-    while ((len != 0) && (*str <= '~') && (*str >= ' '))                     /* write all string */
-    {       
-        if (x > (127 - (font / 2)))                                          /* check x point */
-        {
-            x = 0;                                                           /* set x */
-            y += (uint8_t)font;                                              /* set next row */
-        }
-        if (y > (127 - font))                                                /* check y pont */
-        {
-            y = x = 0;                                                       /* reset to 0 */
-        }
-        if (a_ssd1351_show_char(handle, x, y, *str, font, color) != 0)       /* show a char */
-        {
-            return 1;                                                        /* return error */
-        }
-        x += (uint8_t)(font / 2);                                            /* x + font/2 */
-        str++;                                                               /* str address++ */
-        len--;                                                               /* str length-- */
+    if (top > bottom)                                                          /* check top and bottom */
+    {
+        handle->debug_print("ssd1351: top > bottom.\n");                       /* top > bottom */
+        
+        return 9;                                                              /* return error */
+    }
+    if (len != (uint32_t)(right - left + 1) * (bottom - top + 1) * a_ssd1351_pixel_bytes(handle))  /* check length */
+    {
+        handle->debug_print("ssd1351: len is invalid.\n");                     /* len is invalid */
+        
+        return 10;                                                             /* return error */
     }
     
-    return 0;                                                                /* success return 0 */
+    return a_ssd1351_draw_raw(handle, left, top, right, bottom, data, len);    /* draw raw */
 }
 
 /**
- * @brief     fill the rect
+ * @brief     fill the rect asynchronously
  * @param[in] *handle pointer to an ssd1351 handle structure
  * @param[in] left left coordinate x
  * @param[in] top top coordinate y
@@ -2753,10 +8019,13 @@ uint8_t ssd1351_write_string(ssd1351_handle_t *handle, uint8_t x, uint8_t y, cha
  *            - 7 top is over 127
  *            - 8 bottom is over 127
  *            - 9 top > bottom
+ *            - 10 async is busy
  * @note      left <= 127 && right <= 127 && left <= right && top <= 127 && bottom <= 127 && top <= bottom
  */
-uint8_t ssd1351_fill_rect(ssd1351_handle_t *handle, uint8_t left, uint8_t top, uint8_t right, uint8_t bottom, uint32_t color)
+uint8_t ssd1351_fill_rect_async(ssd1351_handle_t *handle, uint8_t left, uint8_t top, uint8_t right, uint8_t bottom, uint32_t color)
 {
+    uint8_t res;
+    
     if (handle == NULL)                                                        /* check handle */
     {
         return 2;                                                              /* return error */
@@ -2775,7 +8044,7 @@ uint8_t ssd1351_fill_rect(ssd1351_handle_t *handle, uint8_t left, uint8_t top, u
     {
         handle->debug_print("ssd1351: right is over 127.\n");                  /* right is over 127 */
         
-        return 5;                                                              /* return error */
+        return 5;                                                              /* return error  */
     }
     if (left > right)                                                          /* check left and right */
     {
@@ -2801,12 +8070,26 @@ uint8_t ssd1351_fill_rect(ssd1351_handle_t *handle, uint8_t left, uint8_t top, u
         
         return 9;                                                              /* return error */
     }
+    if (handle->async_status == SSD1351_ASYNC_STATUS_BUSY)                     /* check async status */
+    {
+        handle->debug_print("ssd1351: async is busy.\n");                      /* async is busy */
+        
+        return 10;                                                             /* return error */
+    }
     
-    return a_ssd1351_fill_rect(handle, left, top, right, bottom, color);       /* fill rect */
+    if ((handle->spi_write_cmd_async == NULL) || (handle->fb != NULL))         /* check async transport */
+    {
+        res = a_ssd1351_fill_rect(handle, left, top, right, bottom, color);    /* fill rect */
+        a_ssd1351_async_finish(handle, res);                                   /* finish */
+        
+        return res;                                                            /* return the result */
+    }
+    
+    return a_ssd1351_async_start(handle, left, top, right, bottom, NULL, color);  /* start async */
 }
 
 /**
- * @brief     draw a picture
+ * @brief     draw a picture asynchronously
  * @param[in] *handle pointer to an ssd1351 handle structure
  * @param[in] left left coordinate x
  * @param[in] top top coordinate y
@@ -2824,10 +8107,13 @@ uint8_t ssd1351_fill_rect(ssd1351_handle_t *handle, uint8_t left, uint8_t top, u
  *            - 7 top is over 127
  *            - 8 bottom is over 127
  *            - 9 top > bottom
+ *            - 10 async is busy
  * @note      left <= 127 && right <= 127 && left <= right && top <= 127 && bottom <= 127 && top <= bottom
  */
-uint8_t ssd1351_draw_picture(ssd1351_handle_t *handle, uint8_t left, uint8_t top, uint8_t right, uint8_t bottom, uint32_t *image)
+uint8_t ssd1351_draw_picture_async(ssd1351_handle_t *handle, uint8_t left, uint8_t top, uint8_t right, uint8_t bottom, const uint32_t *image)
 {
+    uint8_t res;
+    
     if (handle == NULL)                                                        /* check handle */
     {
         return 2;                                                              /* return error */
@@ -2872,79 +8158,105 @@ uint8_t ssd1351_draw_picture(ssd1351_handle_t *handle, uint8_t left, uint8_t top
         
         return 9;                                                              /* return error */
     }
+    if (handle->async_status == SSD1351_ASYNC_STATUS_BUSY)                     /* check async status */
+    {
+        handle->debug_print("ssd1351: async is busy.\n");                      /* async is busy */
+        
+        return 10;                                                             /* return error */
+    }
     
-    return a_ssd1351_draw_picture(handle, left, top, right, bottom, image);    /* draw picture */
+    if ((handle->spi_write_cmd_async == NULL) || (handle->fb != NULL))         /* check async transport */
+    {
+        res = a_ssd1351_draw_picture(handle, left, top, right, bottom, image); /* draw picture */
+        a_ssd1351_async_finish(handle, res);                                   /* finish */
+        
+        return res;                                                            /* return the result */
+    }
+    
+    return a_ssd1351_async_start(handle, left, top, right, bottom, image, 0);  /* start async */
 }
 
 /**
- * @brief     draw a 16 bits picture
+ * @brief     async irq handler
  * @param[in] *handle pointer to an ssd1351 handle structure
- * @param[in] left left coordinate x
- * @param[in] top top coordinate y
- * @param[in] right right coordinate x
- * @param[in] bottom bottom coordinate y
- * @param[in] *image pointer to a display image buffer
+ * @param[in] res last transfer result
  * @return    status code
  *            - 0 success
- *            - 1 draw picture failed
+ *            - 1 no async transfer
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- *            - 4 left is over 127
- *            - 5 right is over 127
- *            - 6 left > right
- *            - 7 top is over 127
- *            - 8 bottom is over 127
- *            - 9 top > bottom
- * @note      left <= 127 && right <= 127 && left <= right && top <= 127 && bottom <= 127 && top <= bottom
+ * @note      none
  */
-uint8_t ssd1351_draw_picture_16bits(ssd1351_handle_t *handle, uint8_t left, uint8_t top, uint8_t right, uint8_t bottom, uint16_t *image)
+uint8_t ssd1351_async_irq_handler(ssd1351_handle_t *handle, uint8_t res)
 {
-    if (handle == NULL)                                                                   /* check handle */
+    uint8_t cur;
+    uint8_t next;
+    
+    if (handle == NULL)                                                                              /* check handle */
     {
-        return 2;                                                                         /* return error */
+        return 2;                                                                                    /* return error */
     }
-    if (handle->inited != 1)                                                              /* check handle initialization */
+    if (handle->inited != 1)                                                                         /* check handle initialization */
     {
-        return 3;                                                                         /* return error */
+        return 3;                                                                                    /* return error */
     }
-    if (left > 127)                                                                       /* check left */
+    if (handle->async_status != SSD1351_ASYNC_STATUS_BUSY)                                           /* check async status */
     {
-        handle->debug_print("ssd1351: left is over 127.\n");                              /* left is over 127 */
-        
-        return 4;                                                                         /* return error */
+        return 1;                                                                                    /* return error */
     }
-    if (right > 127)                                                                      /* check right */
+    
+    if (res != 0)                                                                                    /* check result */
     {
-        handle->debug_print("ssd1351: right is over 127.\n");                             /* right is over 127 */
+        a_ssd1351_async_finish(handle, 1);                                                           /* finish with error */
         
-        return 5;                                                                         /* return error */
+        return 0;                                                                                    /* success return 0 */
     }
-    if (left > right)                                                                     /* check left and right */
+    cur = handle->async_half;                                                                        /* get sent half */
+    next = cur ^ 1;                                                                                  /* get next half */
+    handle->async_len[cur] = 0;                                                                      /* release sent half */
+    if (handle->async_len[next] == 0)                                                                /* check next half */
     {
-        handle->debug_print("ssd1351: left > right.\n");                                  /* left > right */
+        a_ssd1351_async_finish(handle, 0);                                                           /* finish */
         
-        return 6;                                                                         /* return error */
+        return 0;                                                                                    /* success return 0 */
     }
-    if (top > 127)                                                                        /* check top */
+    handle->async_half = next;                                                                       /* set half */
+    if (handle->spi_write_cmd_async(&handle->buf[next * (SSD1351_BUFFER_SIZE / 2)], 
+                                    handle->async_len[next]) != 0)                                   /* start next half */
     {
-        handle->debug_print("ssd1351: top is over 127.\n");                               /* top is over 127 */
+        a_ssd1351_async_finish(handle, 1);                                                           /* finish with error */
         
-        return 7;                                                                         /* return error */
+        return 0;                                                                                    /* success return 0 */
     }
-    if (bottom > 127)                                                                     /* check bottom */
+    a_ssd1351_async_pack(handle, cur);                                                               /* pack the sent half */
+    
+    return 0;                                                                                        /* success return 0 */
+}
+
+/**
+ * @brief      get the async status
+ * @param[in]  *handle pointer to an ssd1351 handle structure
+ * @param[out] *status pointer to an async status buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t ssd1351_get_async_status(ssd1351_handle_t *handle, ssd1351_async_status_t *status)
+{
+    if (handle == NULL)                                                  /* check handle */
     {
-        handle->debug_print("ssd1351: bottom is over 127.\n");                            /* bottom is over 127 */
-        
-        return 8;                                                                         /* return error */
+        return 2;                                                        /* return error */
     }
-    if (top > bottom)                                                                     /* check top and bottom */
+    if (handle->inited != 1)                                             /* check handle initialization */
     {
-        handle->debug_print("ssd1351: top > bottom.\n");                                  /* top > bottom */
-        
-        return 9;                                                                         /* return error */
+        return 3;                                                        /* return error */
     }
     
-    return a_ssd1351_draw_picture_16_bits(handle, left, top, right, bottom, image);       /* draw picture */
+    *status = (ssd1351_async_status_t)(handle->async_status);            /* get status */
+    
+    return 0;                                                            /* success return 0 */
 }
 
 /**
@@ -3030,6 +8342,7 @@ uint8_t ssd1351_write_cmd(ssd1351_handle_t *handle, uint8_t cmd)
     {
         return 3;                                                /* return error */
     }
+    handle->window_valid = 0;                                    /* invalidate window */
     
     return a_ssd1351_write_byte(handle, cmd, SSD1351_CMD);       /* write command */
 }
@@ -3055,6 +8368,7 @@ uint8_t ssd1351_write_data(ssd1351_handle_t *handle, uint8_t data)
     {
         return 3;                                                  /* return error */
     }
+    handle->window_valid = 0;                                      /* invalidate window */
   
     return a_ssd1351_write_byte(handle, data, SSD1351_DATA);       /* write data */
 }
@@ -3180,6 +8494,24 @@ uint8_t ssd1351_init(ssd1351_handle_t *handle)
         
         return 1;                                                               /* return error */
     }
+    handle->buf_len = 0;                                                        /* clear buffer length */
+    handle->dc = SSD1351_DC_UNKNOWN;                                            /* invalidate dc level */
+    handle->window_valid = 0;                                                   /* invalidate window */
+    handle->ram_mode = 0;                                                       /* clear write ram mode */
+    handle->write_combine = 0;                                                  /* disable write combine */
+    handle->async_status = SSD1351_ASYNC_STATUS_IDLE;                           /* set async idle */
+    a_ssd1351_select_packer(handle);                                            /* select packer */
+    handle->fb = NULL;                                                          /* disable framebuffer */
+    handle->fb_len = 0;                                                         /* clear framebuffer length */
+    handle->fb_increment = 0;                                                   /* horizontal cursor */
+    handle->band = NULL;                                                        /* use the inner buffer as band */
+    handle->band_len = 0;                                                       /* clear band length */
+    handle->strip = NULL;                                                       /* no render strip */
+    handle->list_buf = NULL;                                                    /* no display list */
+    handle->list_num = 0;                                                       /* clear item number */
+    handle->sprite_background = NULL;                                           /* no sprite background */
+    memset(handle->dirty, 0, sizeof(handle->dirty));                            /* flag clean */
+    memset(&handle->stats, 0, sizeof(ssd1351_flush_stats_t));                   /* clear stats */
     handle->inited = 1;                                                         /* flag inited */
     
     return 0;                                                                   /* success return 0 */
@@ -3239,6 +8571,8 @@ uint8_t ssd1351_deinit(ssd1351_handle_t *handle)
         
         return 1;                                                                         /* return error */
     }
+    handle->dc = SSD1351_DC_UNKNOWN;                                                      /* invalidate dc level */
+    handle->window_valid = 0;                                                             /* invalidate window */
     handle->inited = 0;                                                                   /* flag close */
     
     return 0;                                                                             /* success return 0 */
@@ -65,6 +65,90 @@ extern "C"{
     #define SSD1351_AUTO_COLOR_CONVERT  0        /**< not auto convert */
 #endif
 
+/**
+ * @brief ssd1351 fixed color depth definition
+ * @note  0xFF keeps the color depth runtime selectable, set it to a ssd1351_color_depth_t value
+ *        to build the pixel paths for that color depth only
+ */
+#ifndef SSD1351_FIXED_COLOR_DEPTH
+    #define SSD1351_FIXED_COLOR_DEPTH  0xFF        /**< runtime color depth */
+#endif
+
+/**
+ * @brief ssd1351 fixed color sequence definition
+ * @note  0xFF keeps the color sequence runtime selectable, set it to a ssd1351_color_sequence_t value
+ *        to build the pixel paths for that color sequence only
+ */
+#ifndef SSD1351_FIXED_COLOR_SEQUENCE
+    #define SSD1351_FIXED_COLOR_SEQUENCE  0xFF        /**< runtime color sequence */
+#endif
+
+/**
+ * @brief ssd1351 buffer size definition
+ */
+#ifndef SSD1351_BUFFER_SIZE
+    #define SSD1351_BUFFER_SIZE  1024        /**< 1024 bytes */
+#endif
+
+/**
+ * @brief ssd1351 vector segment number definition
+ */
+#ifndef SSD1351_VECTOR_NUM
+    #define SSD1351_VECTOR_NUM  16        /**< 16 segments */
+#endif
+
+/**
+ * @brief ssd1351 glyph cache slot size definition
+ * @note  a glyph larger than the slot is not cached, 864 bytes fit the 24 font at 262K color depth
+ */
+#ifndef SSD1351_GLYPH_CACHE_SLOT_SIZE
+    #define SSD1351_GLYPH_CACHE_SLOT_SIZE  864        /**< 12 * 24 * 3 bytes */
+#endif
+
+/**
+ * @brief ssd1351 packed font definition
+ * @note  0 keeps the raw built-in fonts, 1 stores the built-in fonts compressed and decodes them on use
+ */
+#ifndef SSD1351_FONT_PACKED
+    #define SSD1351_FONT_PACKED  0        /**< raw fonts */
+#endif
+
+/**
+ * @brief ssd1351 built-in font enable definition
+ * @note  a disabled font is not linked and writing a string in it draws nothing
+ */
+#ifndef SSD1351_FONT_12_ENABLE
+    #define SSD1351_FONT_12_ENABLE  1        /**< enable font 12 */
+#endif
+#ifndef SSD1351_FONT_16_ENABLE
+    #define SSD1351_FONT_16_ENABLE  1        /**< enable font 16 */
+#endif
+#ifndef SSD1351_FONT_24_ENABLE
+    #define SSD1351_FONT_24_ENABLE  1        /**< enable font 24 */
+#endif
+
+/**
+ * @brief ssd1351 polygon sub-scanline definition
+ * @note  sub-scanlines per pixel row of the anti-aliased polygon, 1, 2, 4, 8 or 16
+ */
+#ifndef SSD1351_POLYGON_SUBSAMPLE
+    #define SSD1351_POLYGON_SUBSAMPLE  4        /**< 4 sub-scanlines */
+#endif
+
+/**
+ * @brief ssd1351 polygon max point definition
+ */
+#ifndef SSD1351_POLYGON_MAX_POINTS
+    #define SSD1351_POLYGON_MAX_POINTS  16        /**< 16 points */
+#endif
+
+/**
+ * @brief ssd1351 sprite max number definition
+ */
+#ifndef SSD1351_SPRITE_MAX_NUM
+    #define SSD1351_SPRITE_MAX_NUM  8        /**< 8 sprites */
+#endif
+
 /**
  * @brief ssd1351 color depth enumeration definition
  */
@@ -203,6 +287,141 @@ typedef enum
     SSD1351_FONT_24 = 0x18,        /**< font 24 */
 } ssd1351_font_t;
 
+/**
+ * @brief ssd1351 color format enumeration definition
+ */
+typedef enum
+{
+    SSD1351_COLOR_FORMAT_RGB888   = 0x03,        /**< r g b bytes */
+    SSD1351_COLOR_FORMAT_RGBA8888 = 0x04,        /**< r g b a bytes */
+} ssd1351_color_format_t;
+
+/**
+ * @brief ssd1351 async status enumeration definition
+ */
+typedef enum
+{
+    SSD1351_ASYNC_STATUS_IDLE   = 0x00,        /**< idle */
+    SSD1351_ASYNC_STATUS_BUSY   = 0x01,        /**< busy */
+    SSD1351_ASYNC_STATUS_FAILED = 0x02,        /**< failed */
+} ssd1351_async_status_t;
+
+/**
+ * @brief ssd1351 flush stats structure definition
+ */
+typedef struct ssd1351_flush_stats_s
+{
+    uint16_t dirty_tiles;             /**< dirty 8x8 tile number */
+    uint16_t rects;                   /**< sent rectangle number */
+    uint32_t pixels;                  /**< sent pixel number */
+    uint32_t bytes;                   /**< estimated sent bytes including the window setup */
+    uint32_t full_frame_bytes;        /**< estimated bytes of a full frame redraw */
+} ssd1351_flush_stats_t;
+
+/**
+ * @brief ssd1351 glyph cache entry structure definition
+ */
+typedef struct ssd1351_glyph_entry_s
+{
+    uint32_t color;             /**< foreground color */
+    uint32_t background;        /**< background color */
+    uint32_t stamp;             /**< last used stamp */
+    uint16_t len;               /**< packed glyph length, 0 means empty */
+    uint8_t font;               /**< font size */
+    uint8_t chr;                /**< char */
+    uint8_t format;             /**< color depth and color sequence */
+} ssd1351_glyph_entry_t;
+
+/**
+ * @brief ssd1351 packed font structure definition
+ * @note  every glyph is width * height pixels scanned column by column from the top left,
+ *        a glyph of ceil(width * height / 8) bytes is a bit map with the first pixel in the msb,
+ *        a shorter glyph is a run list of (zeros << 4) | ones bytes,
+ *        index holds num + 1 offsets into data and glyph i is data[index[i]] to data[index[i + 1]],
+ *        chars lists the num sorted chars or is NULL for the num chars from first
+ */
+typedef struct ssd1351_packed_font_s
+{
+    uint8_t width;                /**< glyph width */
+    uint8_t height;               /**< glyph height */
+    uint8_t first;                /**< first char when chars is NULL */
+    uint16_t num;                 /**< glyph number */
+    const uint8_t *chars;         /**< sorted chars or NULL */
+    const uint16_t *index;        /**< glyph offsets */
+    const uint8_t *data;          /**< glyph data */
+} ssd1351_packed_font_t;
+
+/**
+ * @brief ssd1351 point structure definition
+ */
+typedef struct ssd1351_point_s
+{
+    int16_t x;        /**< coordinate x in 1/16 pixel */
+    int16_t y;        /**< coordinate y in 1/16 pixel */
+} ssd1351_point_t;
+
+/**
+ * @brief ssd1351 draw type enumeration definition
+ */
+typedef enum
+{
+    SSD1351_DRAW_FILL_RECT       = 0x00,        /**< fill rect, x0 y0 x1 y1 are left top right bottom */
+    SSD1351_DRAW_LINE            = 0x01,        /**< line from x0 y0 to x1 y1 */
+    SSD1351_DRAW_CIRCLE          = 0x02,        /**< circle at x0 y0, param is the radius */
+    SSD1351_DRAW_FILL_CIRCLE     = 0x03,        /**< filled circle at x0 y0, param is the radius */
+    SSD1351_DRAW_FILL_TRIANGLE   = 0x04,        /**< filled triangle x0 y0, x1 y1, x2 y2 */
+    SSD1351_DRAW_ROUND_RECT      = 0x05,        /**< rounded rect x0 y0 x1 y1, param is the radius */
+    SSD1351_DRAW_FILL_ROUND_RECT = 0x06,        /**< filled rounded rect x0 y0 x1 y1, param is the radius */
+    SSD1351_DRAW_STRING          = 0x07,        /**< string at x0 y0, data len, param is the font */
+    SSD1351_DRAW_STRING_OPAQUE   = 0x08,        /**< opaque string at x0 y0, data len, param is the font, background is the background color */
+    SSD1351_DRAW_PICTURE         = 0x09,        /**< picture x0 y0 x1 y1, data is a uint32_t image */
+    SSD1351_DRAW_PICTURE_16BITS  = 0x0A,        /**< picture x0 y0 x1 y1, data is a uint16_t image */
+    SSD1351_DRAW_ARC             = 0x0B,        /**< arc at x0 y0 from start_angle to end_angle, param is the radius */
+} ssd1351_draw_type_t;
+
+/**
+ * @brief ssd1351 display list item structure definition
+ * @note  the fields each type uses are listed in ssd1351_draw_type_t and the other fields are ignored
+ */
+typedef struct ssd1351_draw_item_s
+{
+    uint8_t type;                 /**< draw type */
+    uint8_t param;                /**< radius of a circle, arc or rounded rect, or font of a string */
+    uint8_t x0;                   /**< coordinate x0 */
+    uint8_t y0;                   /**< coordinate y0 */
+    uint8_t x1;                   /**< coordinate x1 */
+    uint8_t y1;                   /**< coordinate y1 */
+    uint8_t x2;                   /**< coordinate x2 of a triangle */
+    uint8_t y2;                   /**< coordinate y2 of a triangle */
+    uint16_t len;                 /**< string length */
+    uint16_t start_angle;         /**< start angle in degrees of an arc */
+    uint16_t end_angle;           /**< end angle in degrees of an arc */
+    uint32_t color;               /**< display color */
+    uint32_t background;          /**< background color of an opaque string */
+    const void *data;             /**< string or image */
+} ssd1351_draw_item_t;
+
+/**
+ * @brief ssd1351 sprite structure definition
+ */
+typedef struct ssd1351_sprite_s
+{
+    int16_t x;                        /**< left coordinate x, may be off screen */
+    int16_t y;                        /**< top coordinate y, may be off screen */
+    uint8_t width;                    /**< image width */
+    uint8_t height;                   /**< image height */
+    uint8_t visible;                  /**< visible flag */
+    uint16_t key;                     /**< transparent color key when mask is NULL */
+    const uint16_t *image;            /**< row major uint16_t image */
+    const uint8_t *mask;              /**< 1 bit opaque mask with msb first byte aligned rows or NULL */
+    uint8_t shown;                    /**< shown flag, kept by the driver */
+    uint8_t shown_left;               /**< shown left coordinate x, kept by the driver */
+    uint8_t shown_top;                /**< shown top coordinate y, kept by the driver */
+    uint8_t shown_right;              /**< shown right coordinate x, kept by the driver */
+    uint8_t shown_bottom;             /**< shown bottom coordinate y, kept by the driver */
+    const uint16_t *shown_image;      /**< shown image, kept by the driver */
+} ssd1351_sprite_t;
+
 /**
  * @brief ssd1351 handle structure definition
  */
@@ -211,6 +430,8 @@ typedef struct ssd1351_handle_s
     uint8_t (*spi_init)(void);                                   /**< point to a spi_init function address */
     uint8_t (*spi_deinit)(void);                                 /**< point to a spi_deinit function address */
     uint8_t (*spi_write_cmd)(uint8_t *buf, uint16_t len);        /**< point to a spi_write_cmd function address */
+    uint8_t (*spi_write_cmd_vector)(uint8_t **buf, uint16_t *len, uint16_t num);  /**< point to a spi_write_cmd_vector function address */
+    uint8_t (*spi_write_cmd_async)(uint8_t *buf, uint16_t len);  /**< point to a spi_write_cmd_async function address */
     uint8_t (*cmd_data_gpio_init)(void);                         /**< point to a cmd_data_gpio_init function address */
     uint8_t (*cmd_data_gpio_deinit)(void);                       /**< point to a cmd_data_gpio_deinit function address */
     uint8_t (*cmd_data_gpio_write)(uint8_t value);               /**< point to a cmd_data_gpio_write function address */
@@ -219,9 +440,56 @@ typedef struct ssd1351_handle_s
     uint8_t (*reset_gpio_write)(uint8_t value);                  /**< point to a reset_gpio_write function address */
     void (*debug_print)(const char *const fmt, ...);             /**< point to a debug_print function address */
     void (*delay_ms)(uint32_t ms);                               /**< point to a delay_ms function address */
+    void (*async_callback)(uint8_t status);                      /**< point to an async_callback function address */
     uint8_t inited;                                              /**< inited flag */
     uint8_t conf_1;                                              /**< config 1 */
     uint8_t conf_2;                                              /**< config 2 */
+    uint8_t (*pack)(uint32_t color, uint8_t *buf);               /**< point to the selected pixel packer */
+    uint8_t dc;                                                  /**< command data gpio level */
+    uint8_t window_valid;                                        /**< window cache valid flag */
+    uint8_t ram_mode;                                            /**< write ram mode flag */
+    uint8_t column_start;                                        /**< cached column start address */
+    uint8_t column_end;                                          /**< cached column end address */
+    uint8_t row_start;                                           /**< cached row start address */
+    uint8_t row_end;                                             /**< cached row end address */
+    uint8_t column;                                              /**< cached column pointer */
+    uint8_t row;                                                 /**< cached row pointer */
+    uint8_t write_combine;                                       /**< write combine flag */
+    uint8_t *fb;                                                 /**< framebuffer */
+    uint32_t fb_len;                                             /**< framebuffer length */
+    uint8_t *band;                                               /**< band buffer */
+    uint32_t band_len;                                           /**< band buffer length */
+    uint8_t *strip;                                              /**< render strip */
+    uint8_t strip_top;                                           /**< render strip top */
+    uint8_t strip_bottom;                                        /**< render strip bottom */
+    uint8_t *list_buf;                                           /**< display list arena */
+    uint32_t list_len;                                           /**< display list arena length */
+    uint32_t list_tail;                                          /**< display list string area start */
+    uint16_t list_num;                                           /**< display list item number */
+    const uint16_t *sprite_background;                           /**< sprite background image */
+    uint8_t fb_left;                                             /**< framebuffer window left */
+    uint8_t fb_top;                                              /**< framebuffer window top */
+    uint8_t fb_right;                                            /**< framebuffer window right */
+    uint8_t fb_bottom;                                           /**< framebuffer window bottom */
+    uint8_t fb_column;                                           /**< framebuffer column cursor */
+    uint8_t fb_row;                                              /**< framebuffer row cursor */
+    uint8_t fb_byte;                                             /**< framebuffer pixel byte cursor */
+    uint8_t fb_increment;                                        /**< framebuffer cursor address increment */
+    uint16_t dirty[16];                                          /**< dirty 8x8 tile bitmap */
+    ssd1351_flush_stats_t stats;                                 /**< last flush stats */
+    volatile uint8_t async_status;                               /**< async status, written by the irq handler */
+    volatile uint8_t async_half;                                 /**< async buffer half in flight, written by the irq handler */
+    volatile uint16_t async_len[2];                              /**< async buffer half length, written by the irq handler */
+    uint32_t async_color;                                        /**< async fill color */
+    const uint32_t *async_image;                                 /**< async image */
+    uint32_t async_pos;                                          /**< async packed pixel number */
+    uint32_t async_total;                                        /**< async total pixel number */
+    ssd1351_glyph_entry_t *glyph_entry;                          /**< glyph cache entries */
+    uint8_t *glyph_data;                                         /**< glyph cache slots */
+    uint16_t glyph_num;                                          /**< glyph cache slot number */
+    uint32_t glyph_stamp;                                        /**< glyph cache use stamp */
+    uint16_t buf_len;                                            /**< inner buffer length */
+    uint8_t buf[SSD1351_BUFFER_SIZE];                            /**< inner buffer */
 } ssd1351_handle_t;
 
 /**
@@ -283,6 +551,14 @@ typedef struct ssd1351_info_s
  */
 #define DRIVER_SSD1351_LINK_SPI_WRITE_COMMAND(HANDLE, FUC)         (HANDLE)->spi_write_cmd = FUC
 
+/**
+ * @brief     link spi_write_cmd_vector function
+ * @param[in] HANDLE pointer to an ssd1351 handle structure
+ * @param[in] FUC pointer to a spi_write_cmd_vector function address
+ * @note      the function writes all segments as one bus transfer, it is optional
+ */
+#define DRIVER_SSD1351_LINK_SPI_WRITE_COMMAND_VECTOR(HANDLE, FUC)  (HANDLE)->spi_write_cmd_vector = FUC
+
 /**
  * @brief     link cmd_data_gpio_init function
  * @param[in] HANDLE pointer to an ssd1351 handle structure
@@ -347,6 +623,23 @@ typedef struct ssd1351_info_s
  */
 #define DRIVER_SSD1351_LINK_DEBUG_PRINT(HANDLE, FUC)               (HANDLE)->debug_print = FUC
 
+/**
+ * @brief     link spi_write_cmd_async function
+ * @param[in] HANDLE pointer to an ssd1351 handle structure
+ * @param[in] FUC pointer to a spi_write_cmd_async function address
+ * @note      the function starts a data transfer and returns at once,
+ *            the transport must call ssd1351_async_irq_handler when the transfer is done
+ */
+#define DRIVER_SSD1351_LINK_SPI_WRITE_COMMAND_ASYNC(HANDLE, FUC)   (HANDLE)->spi_write_cmd_async = FUC
+
+/**
+ * @brief     link async_callback function
+ * @param[in] HANDLE pointer to an ssd1351 handle structure
+ * @param[in] FUC pointer to an async_callback function address
+ * @note      none
+ */
+#define DRIVER_SSD1351_LINK_ASYNC_CALLBACK(HANDLE, FUC)            (HANDLE)->async_callback = FUC
+
 /**
  * @}
  */
@@ -426,6 +719,118 @@ uint8_t ssd1351_clear(ssd1351_handle_t *handle);
  */
 uint8_t ssd1351_draw_point(ssd1351_handle_t *handle, uint8_t x, uint8_t y, uint32_t color);
 
+/**
+ * @brief     enable or disable the write combine mode
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @param[in] enable bool value
+ * @return    status code
+ *            - 0 success
+ *            - 1 set write combine failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      when enabled, points continuing at the write pointer (increasing x in the
+ *            same row, or increasing y in the same column in vertical increment mode)
+ *            are sent as one burst, the pending points are sent on a non-contiguous point,
+ *            any other display operation or ssd1351_flush
+ */
+uint8_t ssd1351_set_write_combine(ssd1351_handle_t *handle, ssd1351_bool_t enable);
+
+/**
+ * @brief     flush the pending data to the display
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 flush failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      when the framebuffer is enabled, the dirty 8x8 tiles are coalesced into rectangles
+ *            by comparing the window setup bytes with the payload bytes and only they are sent
+ */
+uint8_t ssd1351_flush(ssd1351_handle_t *handle);
+
+/**
+ * @brief      get the statistics of the last framebuffer flush
+ * @param[in]  *handle pointer to an ssd1351 handle structure
+ * @param[out] *stats pointer to a flush stats structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t ssd1351_get_flush_stats(ssd1351_handle_t *handle, ssd1351_flush_stats_t *stats);
+
+/**
+ * @brief     set the shadow framebuffer
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @param[in] *buf pointer to a framebuffer
+ * @param[in] len framebuffer length
+ * @return    status code
+ *            - 0 success
+ *            - 1 set framebuffer failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 len is too small
+ * @note      len >= 128 * 128 * pixel bytes of the current color depth (1, 2 or 3)
+ *            buf holds the panel native pixel data row by row and buf == NULL disables the framebuffer
+ *            when enabled, clear, draw point, write string, fill rect and draw picture render into buf
+ *            and the whole screen is marked as dirty, ssd1351_flush sends the dirty tiles
+ *            changing the color depth while the framebuffer is enabled invalidates its content
+ */
+uint8_t ssd1351_set_framebuffer(ssd1351_handle_t *handle, uint8_t *buf, uint32_t len);
+
+/**
+ * @brief     set the glyph cache
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @param[in] *buf pointer to a glyph cache buffer
+ * @param[in] len glyph cache buffer length
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 len is too small
+ * @note      buf == NULL disables the glyph cache, len is the memory budget and holds
+ *            len / (sizeof(ssd1351_glyph_entry_t) + SSD1351_GLYPH_CACHE_SLOT_SIZE) glyphs
+ *            ssd1351_write_string_opaque keeps the packed glyphs keyed by font, colors and color format
+ *            and evicts the least recently used glyph when the cache is full
+ */
+uint8_t ssd1351_set_glyph_cache(ssd1351_handle_t *handle, uint8_t *buf, uint32_t len);
+
+/**
+ * @brief      swap the shadow framebuffer
+ * @param[in]  *handle pointer to an ssd1351 handle structure
+ * @param[in]  *buf pointer to the next framebuffer
+ * @param[out] *dirty pointer to a dirty tile bitmap buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 framebuffer is not enabled
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 buf or dirty is NULL
+ *             - 5 buf is the current framebuffer
+ * @note       buf must have the same length as the current framebuffer and hold the picture before the last swap
+ *             the dirty tiles of the current framebuffer are copied into buf and moved into dirty,
+ *             then buf becomes the framebuffer, no data is sent so the old framebuffer can be
+ *             flushed by ssd1351_flush_framebuffer in another thread
+ */
+uint8_t ssd1351_swap_framebuffer(ssd1351_handle_t *handle, uint8_t *buf, uint16_t dirty[16]);
+
+/**
+ * @brief     send the dirty tiles of a framebuffer
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @param[in] *buf pointer to a framebuffer
+ * @param[in] *dirty pointer to a dirty tile bitmap
+ * @return    status code
+ *            - 0 success
+ *            - 1 flush failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      buf has the same layout as the shadow framebuffer and the handle framebuffer is not touched,
+ *            only the bus state of the handle is used, which is the inner buffer, the dc level,
+ *            the gram window cache and the flush stats, so another thread can flush through a copy of the handle
+ */
+uint8_t ssd1351_flush_framebuffer(ssd1351_handle_t *handle, const uint8_t *buf, const uint16_t dirty[16]);
+
 /**
  * @brief     write a string in the display
  * @param[in] *handle pointer to an ssd1351 handle structure
@@ -443,7 +848,76 @@ uint8_t ssd1351_draw_point(ssd1351_handle_t *handle, uint8_t x, uint8_t y, uint3
  *            - 4 x or y is invalid
  * @note      x <= 127 && y <= 127
  */
-uint8_t ssd1351_write_string(ssd1351_handle_t *handle, uint8_t x, uint8_t y, char *str, uint16_t len, uint32_t color, ssd1351_font_t font);
+uint8_t ssd1351_write_string(ssd1351_handle_t *handle, uint8_t x, uint8_t y, const char *str, uint16_t len, uint32_t color, ssd1351_font_t font);
+
+/**
+ * @brief     write an opaque string in the display
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @param[in] x coordinate x
+ * @param[in] y coordinate y
+ * @param[in] *str pointer to a written string address
+ * @param[in] len length of the string
+ * @param[in] color display color
+ * @param[in] background background color
+ * @param[in] font string font
+ * @return    status code
+ *            - 0 success
+ *            - 1 write string failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 x or y is invalid
+ * @note      x <= 127 && y <= 127
+ *            the string wraps like ssd1351_write_string and every char cell is filled,
+ *            each line is sent as one burst with the vertical address increment and
+ *            the address increment is restored at the end
+ */
+uint8_t ssd1351_write_string_opaque(ssd1351_handle_t *handle, uint8_t x, uint8_t y, const char *str, uint16_t len, 
+                                    uint32_t color, uint32_t background, ssd1351_font_t font);
+
+/**
+ * @brief     write a string in a packed font
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @param[in] x coordinate x
+ * @param[in] y coordinate y
+ * @param[in] *str pointer to a written string address
+ * @param[in] len length of the string
+ * @param[in] color display color
+ * @param[in] *font pointer to a packed font
+ * @return    status code
+ *            - 0 success
+ *            - 1 write string failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 x or y is invalid
+ *            - 5 font is invalid
+ * @note      x <= 127 && y <= 127 && font->width <= 32 && font->height <= 32
+ *            the string stops at the first char that is not in the font
+ */
+uint8_t ssd1351_write_string_packed(ssd1351_handle_t *handle, uint8_t x, uint8_t y, const char *str, uint16_t len, 
+                                    uint32_t color, const ssd1351_packed_font_t *font);
+
+/**
+ * @brief     write an opaque string in a packed font
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @param[in] x coordinate x
+ * @param[in] y coordinate y
+ * @param[in] *str pointer to a written string address
+ * @param[in] len length of the string
+ * @param[in] color display color
+ * @param[in] background background color
+ * @param[in] *font pointer to a packed font
+ * @return    status code
+ *            - 0 success
+ *            - 1 write string failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 x or y is invalid
+ *            - 5 font is invalid
+ * @note      x <= 127 && y <= 127 && font->width <= 32 && font->height <= 32
+ *            the string stops at the first char that is not in the font
+ */
+uint8_t ssd1351_write_string_packed_opaque(ssd1351_handle_t *handle, uint8_t x, uint8_t y, const char *str, uint16_t len, 
+                                           uint32_t color, uint32_t background, const ssd1351_packed_font_t *font);
 
 /**
  * @brief     fill the rect
@@ -468,6 +942,313 @@ uint8_t ssd1351_write_string(ssd1351_handle_t *handle, uint8_t x, uint8_t y, cha
  */
 uint8_t ssd1351_fill_rect(ssd1351_handle_t *handle, uint8_t left, uint8_t top, uint8_t right, uint8_t bottom, uint32_t color);
 
+/**
+ * @brief     draw a line
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @param[in] x0 coordinate x of the first point
+ * @param[in] y0 coordinate y of the first point
+ * @param[in] x1 coordinate x of the second point
+ * @param[in] y1 coordinate y of the second point
+ * @param[in] color display color
+ * @return    status code
+ *            - 0 success
+ *            - 1 draw line failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 x or y is invalid
+ * @note      x0 <= 127 && y0 <= 127 && x1 <= 127 && y1 <= 127
+ *            the pixels of one row or column are sent as one window and burst
+ */
+uint8_t ssd1351_draw_line(ssd1351_handle_t *handle, uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1, uint32_t color);
+
+/**
+ * @brief     draw a circle
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @param[in] x center coordinate x
+ * @param[in] y center coordinate y
+ * @param[in] r radius
+ * @param[in] color display color
+ * @return    status code
+ *            - 0 success
+ *            - 1 draw circle failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 x or y is invalid
+ * @note      x <= 127 && y <= 127
+ *            the circle is clipped to the display
+ */
+uint8_t ssd1351_draw_circle(ssd1351_handle_t *handle, uint8_t x, uint8_t y, uint8_t r, uint32_t color);
+
+/**
+ * @brief     fill a circle
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @param[in] x center coordinate x
+ * @param[in] y center coordinate y
+ * @param[in] r radius
+ * @param[in] color display color
+ * @return    status code
+ *            - 0 success
+ *            - 1 fill circle failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 x or y is invalid
+ * @note      x <= 127 && y <= 127
+ *            the circle is clipped to the display
+ */
+uint8_t ssd1351_fill_circle(ssd1351_handle_t *handle, uint8_t x, uint8_t y, uint8_t r, uint32_t color);
+
+/**
+ * @brief     draw an arc
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @param[in] x center coordinate x
+ * @param[in] y center coordinate y
+ * @param[in] r radius
+ * @param[in] start_angle start angle in degrees
+ * @param[in] end_angle end angle in degrees
+ * @param[in] color display color
+ * @return    status code
+ *            - 0 success
+ *            - 1 draw arc failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 x or y is invalid
+ *            - 5 angle is over 360
+ * @note      x <= 127 && y <= 127 && start_angle <= 360 && end_angle <= 360
+ *            0 degree points to the right and the arc runs clockwise from start_angle to end_angle,
+ *            the arc is clipped to the display
+ */
+uint8_t ssd1351_draw_arc(ssd1351_handle_t *handle, uint8_t x, uint8_t y, uint8_t r, 
+                         uint16_t start_angle, uint16_t end_angle, uint32_t color);
+
+/**
+ * @brief     fill a triangle
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @param[in] x0 coordinate x of the first point
+ * @param[in] y0 coordinate y of the first point
+ * @param[in] x1 coordinate x of the second point
+ * @param[in] y1 coordinate y of the second point
+ * @param[in] x2 coordinate x of the third point
+ * @param[in] y2 coordinate y of the third point
+ * @param[in] color display color
+ * @return    status code
+ *            - 0 success
+ *            - 1 fill triangle failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 x or y is invalid
+ * @note      x0 <= 127 && y0 <= 127 && x1 <= 127 && y1 <= 127 && x2 <= 127 && y2 <= 127
+ *            every row is sent as one window and burst
+ */
+uint8_t ssd1351_fill_triangle(ssd1351_handle_t *handle, uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1, 
+                              uint8_t x2, uint8_t y2, uint32_t color);
+
+/**
+ * @brief     draw a rounded rect
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @param[in] left left coordinate x
+ * @param[in] top top coordinate y
+ * @param[in] right right coordinate x
+ * @param[in] bottom bottom coordinate y
+ * @param[in] r corner radius
+ * @param[in] color display color
+ * @return    status code
+ *            - 0 success
+ *            - 1 draw round rect failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 left is over 127
+ *            - 5 right is over 127
+ *            - 6 left > right
+ *            - 7 top is over 127
+ *            - 8 bottom is over 127
+ *            - 9 top > bottom
+ *            - 10 r is too large
+ * @note      left <= 127 && right <= 127 && left <= right && top <= 127 && bottom <= 127 && top <= bottom
+ *            2 * r <= right - left && 2 * r <= bottom - top
+ */
+uint8_t ssd1351_draw_round_rect(ssd1351_handle_t *handle, uint8_t left, uint8_t top, uint8_t right, uint8_t bottom, 
+                                uint8_t r, uint32_t color);
+
+/**
+ * @brief     fill a rounded rect
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @param[in] left left coordinate x
+ * @param[in] top top coordinate y
+ * @param[in] right right coordinate x
+ * @param[in] bottom bottom coordinate y
+ * @param[in] r corner radius
+ * @param[in] color display color
+ * @return    status code
+ *            - 0 success
+ *            - 1 fill round rect failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 left is over 127
+ *            - 5 right is over 127
+ *            - 6 left > right
+ *            - 7 top is over 127
+ *            - 8 bottom is over 127
+ *            - 9 top > bottom
+ *            - 10 r is too large
+ * @note      left <= 127 && right <= 127 && left <= right && top <= 127 && bottom <= 127 && top <= bottom
+ *            2 * r <= right - left && 2 * r <= bottom - top
+ */
+uint8_t ssd1351_fill_round_rect(ssd1351_handle_t *handle, uint8_t left, uint8_t top, uint8_t right, uint8_t bottom, 
+                                uint8_t r, uint32_t color);
+
+/**
+ * @brief     set the band buffer
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @param[in] *buf pointer to a band buffer
+ * @param[in] len band buffer length
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      buf == NULL renders the bands in the inner buffer,
+ *            a band holds len / (width * pixel bytes) rows and is sent as one burst
+ */
+uint8_t ssd1351_set_band_buffer(ssd1351_handle_t *handle, uint8_t *buf, uint32_t len);
+
+/**
+ * @brief     fill a polygon with anti-aliased edges
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @param[in] *point pointer to a point buffer
+ * @param[in] num point number
+ * @param[in] color display color
+ * @param[in] background background color
+ * @return    status code
+ *            - 0 success
+ *            - 1 fill polygon failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 point is invalid
+ *            - 5 num is invalid
+ *            - 6 band buffer is too small
+ * @note      3 <= num <= SSD1351_POLYGON_MAX_POINTS and the points are in 1/16 pixel
+ *            within -16384 - 16383, the polygon is filled with the non-zero winding rule and clipped,
+ *            the bounding box is filled with the background color and sent band by band,
+ *            with the framebuffer the edges are blended over the framebuffer and background is not used
+ */
+uint8_t ssd1351_fill_polygon(ssd1351_handle_t *handle, const ssd1351_point_t *point, uint8_t num, 
+                             uint32_t color, uint32_t background);
+
+/**
+ * @brief     draw an anti-aliased thick line
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @param[in] x0 coordinate x of the first point in 1/16 pixel
+ * @param[in] y0 coordinate y of the first point in 1/16 pixel
+ * @param[in] x1 coordinate x of the second point in 1/16 pixel
+ * @param[in] y1 coordinate y of the second point in 1/16 pixel
+ * @param[in] width line width in 1/16 pixel
+ * @param[in] color display color
+ * @param[in] background background color
+ * @return    status code
+ *            - 0 success
+ *            - 1 draw thick line failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 point is invalid
+ *            - 5 width is invalid
+ *            - 6 band buffer is too small
+ * @note      the points are within -8192 - 8191 and 0 < width <= 4096,
+ *            the line is filled as a quad polygon so it suits gauge needles,
+ *            the background works like ssd1351_fill_polygon
+ */
+uint8_t ssd1351_draw_thick_line(ssd1351_handle_t *handle, int16_t x0, int16_t y0, int16_t x1, int16_t y1, 
+                                uint16_t width, uint32_t color, uint32_t background);
+
+/**
+ * @brief     render a display list in strips
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @param[in] *list pointer to a display list
+ * @param[in] num item number
+ * @param[in] background background color
+ * @return    status code
+ *            - 0 success
+ *            - 1 render list failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 list is NULL
+ *            - 5 item is invalid
+ *            - 6 band buffer is too small
+ * @note      the whole screen is composed from the background and the items in the list order,
+ *            each 128 x N strip of the band buffer is sent as one window and one burst,
+ *            N = band buffer length / (128 * pixel bytes) and the inner buffer is used without a band buffer,
+ *            the items are checked like the matching draw functions and the picture data follows
+ *            the address increment
+ */
+uint8_t ssd1351_render_list(ssd1351_handle_t *handle, const ssd1351_draw_item_t *list, uint16_t num, uint32_t background);
+
+/**
+ * @brief     set the display list arena
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @param[in] *buf pointer to an arena buffer
+ * @param[in] len arena buffer length
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      buf != NULL starts recording, the points, fills, shapes, built-in font strings and pictures
+ *            are recorded into the arena instead of being drawn and the other draw functions fail,
+ *            the strings are copied and the pictures are referenced,
+ *            buf == NULL stops recording and drops the recorded items
+ */
+uint8_t ssd1351_set_display_list(ssd1351_handle_t *handle, uint8_t *buf, uint32_t len);
+
+/**
+ * @brief     submit the recorded display list
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 submit display list failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 display list is not set
+ * @note      items hidden by a later fill, picture or one line opaque string are culled,
+ *            touching fills of the same color are merged, a list that starts with a full screen fill
+ *            is composed in strips of the band buffer and any other list is replayed item by item,
+ *            the arena is then reset for the next frame and recording goes on
+ */
+uint8_t ssd1351_submit_display_list(ssd1351_handle_t *handle);
+
+/**
+ * @brief     set the sprite background
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @param[in] *image pointer to a background image buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 set sprite background failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      the image is a row major 128 x 128 uint16_t image which is cached and drawn to the whole screen,
+ *            image == NULL drops the cached background,
+ *            262K color format can't use this function and the shown sprites are erased
+ */
+uint8_t ssd1351_set_sprite_background(ssd1351_handle_t *handle, const uint16_t *image);
+
+/**
+ * @brief         update the sprites
+ * @param[in]     *handle pointer to an ssd1351 handle structure
+ * @param[in,out] *sprite pointer to a sprite buffer
+ * @param[in]     num sprite number
+ * @return        status code
+ *                - 0 success
+ *                - 1 update sprites failed
+ *                - 2 handle is NULL
+ *                - 3 handle is not initialized
+ *                - 4 sprite background is not set
+ *                - 5 num is invalid
+ *                - 6 sprite is invalid
+ *                - 7 band buffer is too small
+ * @note          num <= SSD1351_SPRITE_MAX_NUM and later sprites are drawn on top,
+ *                a sprite is redrawn when it moves, shows, hides or changes its image pointer,
+ *                the old and new boxes are composed from the cached background and the sprites
+ *                and only these boxes are sent, pixels equal to the key or clear in the mask are transparent,
+ *                a sprite is hidden and updated once before it is dropped from the buffer
+ */
+uint8_t ssd1351_update_sprites(ssd1351_handle_t *handle, ssd1351_sprite_t *sprite, uint8_t num);
+
 /**
  * @brief     draw a picture
  * @param[in] *handle pointer to an ssd1351 handle structure
@@ -489,7 +1270,7 @@ uint8_t ssd1351_fill_rect(ssd1351_handle_t *handle, uint8_t left, uint8_t top, u
  *            - 9 top > bottom
  * @note      left <= 127 && right <= 127 && left <= right && top <= 127 && bottom <= 127 && top <= bottom
  */
-uint8_t ssd1351_draw_picture(ssd1351_handle_t *handle, uint8_t left, uint8_t top, uint8_t right, uint8_t bottom, uint32_t *image);
+uint8_t ssd1351_draw_picture(ssd1351_handle_t *handle, uint8_t left, uint8_t top, uint8_t right, uint8_t bottom, const uint32_t *image);
 
 /**
  * @brief     draw a 16 bits picture
@@ -512,7 +1293,137 @@ uint8_t ssd1351_draw_picture(ssd1351_handle_t *handle, uint8_t left, uint8_t top
  *            - 9 top > bottom
  * @note      left <= 127 && right <= 127 && left <= right && top <= 127 && bottom <= 127 && top <= bottom
  */
-uint8_t ssd1351_draw_picture_16bits(ssd1351_handle_t *handle, uint8_t left, uint8_t top, uint8_t right, uint8_t bottom, uint16_t *image);
+uint8_t ssd1351_draw_picture_16bits(ssd1351_handle_t *handle, uint8_t left, uint8_t top, uint8_t right, uint8_t bottom, const uint16_t *image);
+
+/**
+ * @brief     draw a rgb888 or rgba8888 picture
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @param[in] left left coordinate x
+ * @param[in] top top coordinate y
+ * @param[in] right right coordinate x
+ * @param[in] bottom bottom coordinate y
+ * @param[in] *image pointer to a source image buffer
+ * @param[in] format source pixel format
+ * @return    status code
+ *            - 0 success
+ *            - 1 draw picture failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 left is over 127
+ *            - 5 right is over 127
+ *            - 6 left > right
+ *            - 7 top is over 127
+ *            - 8 bottom is over 127
+ *            - 9 top > bottom
+ *            - 10 format is invalid
+ * @note      left <= 127 && right <= 127 && left <= right && top <= 127 && bottom <= 127 && top <= bottom
+ *            pixels are read in the order they are sent, colors are converted for the current color depth and sequence
+ */
+uint8_t ssd1351_draw_picture_rgb888(ssd1351_handle_t *handle, uint8_t left, uint8_t top, uint8_t right, uint8_t bottom, 
+                                    const uint8_t *image, ssd1351_color_format_t format);
+
+/**
+ * @brief     draw a raw panel format picture
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @param[in] left left coordinate x
+ * @param[in] top top coordinate y
+ * @param[in] right right coordinate x
+ * @param[in] bottom bottom coordinate y
+ * @param[in] *data pointer to a panel format data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 draw raw failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 left is over 127
+ *            - 5 right is over 127
+ *            - 6 left > right
+ *            - 7 top is over 127
+ *            - 8 bottom is over 127
+ *            - 9 top > bottom
+ *            - 10 len is invalid
+ * @note      left <= 127 && right <= 127 && left <= right && top <= 127 && bottom <= 127 && top <= bottom
+ *            data is sent as is, it must be in the current color depth, color sequence and address increment order
+ *            and len must be the pixel number of the rect multiplied by the pixel bytes
+ */
+uint8_t ssd1351_draw_raw(ssd1351_handle_t *handle, uint8_t left, uint8_t top, uint8_t right, uint8_t bottom, 
+                         const uint8_t *data, uint32_t len);
+
+/**
+ * @brief     fill the rect asynchronously
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @param[in] left left coordinate x
+ * @param[in] top top coordinate y
+ * @param[in] right right coordinate x
+ * @param[in] bottom bottom coordinate y
+ * @param[in] color display color
+ * @return    status code
+ *            - 0 success
+ *            - 1 fill rect failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 left is over 127
+ *            - 5 right is over 127
+ *            - 6 left > right
+ *            - 7 top is over 127
+ *            - 8 bottom is over 127
+ *            - 9 top > bottom
+ *            - 10 async is busy
+ * @note      left <= 127 && right <= 127 && left <= right && top <= 127 && bottom <= 127 && top <= bottom
+ *            without a spi_write_cmd_async function or with a framebuffer the rect is filled synchronously
+ */
+uint8_t ssd1351_fill_rect_async(ssd1351_handle_t *handle, uint8_t left, uint8_t top, uint8_t right, uint8_t bottom, uint32_t color);
+
+/**
+ * @brief     draw a picture asynchronously
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @param[in] left left coordinate x
+ * @param[in] top top coordinate y
+ * @param[in] right right coordinate x
+ * @param[in] bottom bottom coordinate y
+ * @param[in] *image pointer to a display image buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 draw picture failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 left is over 127
+ *            - 5 right is over 127
+ *            - 6 left > right
+ *            - 7 top is over 127
+ *            - 8 bottom is over 127
+ *            - 9 top > bottom
+ *            - 10 async is busy
+ * @note      left <= 127 && right <= 127 && left <= right && top <= 127 && bottom <= 127 && top <= bottom
+ *            the image must stay valid until the transfer is done and is not modified
+ */
+uint8_t ssd1351_draw_picture_async(ssd1351_handle_t *handle, uint8_t left, uint8_t top, uint8_t right, uint8_t bottom, const uint32_t *image);
+
+/**
+ * @brief     async irq handler
+ * @param[in] *handle pointer to an ssd1351 handle structure
+ * @param[in] res last transfer result
+ * @return    status code
+ *            - 0 success
+ *            - 1 no async transfer
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      call it from the spi_write_cmd_async completion, res is 0 when the transfer succeeded
+ */
+uint8_t ssd1351_async_irq_handler(ssd1351_handle_t *handle, uint8_t res);
+
+/**
+ * @brief      get the async status
+ * @param[in]  *handle pointer to an ssd1351 handle structure
+ * @param[out] *status pointer to an async status buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t ssd1351_get_async_status(ssd1351_handle_t *handle, ssd1351_async_status_t *status);
 
 /**
  * @brief     set the display column address
@@ -579,7 +1490,8 @@ uint8_t ssd1351_read_ram(ssd1351_handle_t *handle);
  *            - 1 set color depth failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- * @note      none
+ *            - 4 color depth is fixed
+ * @note      with SSD1351_FIXED_COLOR_DEPTH only the fixed value can be set
  */
 uint8_t ssd1351_set_color_depth(ssd1351_handle_t *handle, ssd1351_color_depth_t color_depth);
 
@@ -618,7 +1530,8 @@ uint8_t ssd1351_set_seg0_map(ssd1351_handle_t *handle, ssd1351_seg0_mapped_t seg
  *            - 1 set color sequence failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- * @note      none
+ *            - 4 color sequence is fixed
+ * @note      with SSD1351_FIXED_COLOR_SEQUENCE only the fixed value can be set
  */
 uint8_t ssd1351_set_color_sequence(ssd1351_handle_t *handle, ssd1351_color_sequence_t color_sequence);
 
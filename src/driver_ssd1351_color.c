@@ -0,0 +1,442 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_ssd1351_color.c
+ * @brief     driver ssd1351 color source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_ssd1351_color.h"
+
+#if (SSD1351_COLOR_SIMD == 1)
+    #if defined(__ARM_NEON) || defined(__ARM_NEON__)
+        #include <arm_neon.h>
+        #define SSD1351_COLOR_NEON        /**< neon kernel */
+    #elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+        #include <emmintrin.h>
+        #define SSD1351_COLOR_SSE2        /**< sse2 kernel */
+        #if defined(__AVX2__)
+            #include <immintrin.h>
+            #define SSD1351_COLOR_AVX2    /**< avx2 kernel */
+        #endif
+    #endif
+#endif
+
+/**
+ * @brief ssd1351 color layout definition
+ */
+#define SSD1351_COLOR_LAYOUT_256     0        /**< 3:3:2 in 1 byte */
+#define SSD1351_COLOR_LAYOUT_65K     1        /**< 5:6:5 in 2 bytes */
+#define SSD1351_COLOR_LAYOUT_262K    2        /**< 6:6:6 in 3 bytes */
+
+/**
+ * @brief      convert pixels with the scalar kernel
+ * @param[in]  layout panel layout
+ * @param[in]  swap red blue swap flag
+ * @param[in]  step source pixel bytes
+ * @param[in]  *in pointer to a source pixel buffer
+ * @param[out] *out pointer to a panel format buffer
+ * @param[in]  num pixel number
+ * @note       none
+ */
+static void a_ssd1351_color_convert_scalar(uint8_t layout, uint8_t swap, uint8_t step, 
+                                           const uint8_t *in, uint8_t *out, uint32_t num)
+{
+    uint32_t i;
+    uint8_t r;
+    uint8_t g;
+    uint8_t b;
+    
+    for (i = 0; i < num; i++)                                                             /* all pixels */
+    {
+        r = in[0];                                                                        /* get red */
+        g = in[1];                                                                        /* get green */
+        b = in[2];                                                                        /* get blue */
+        if (swap != 0)                                                                    /* if a b c */
+        {
+            r = in[2];                                                                    /* blue first */
+            b = in[0];                                                                    /* red last */
+        }
+        if (layout == SSD1351_COLOR_LAYOUT_256)                                           /* if 256 */
+        {
+            *out++ = (uint8_t)((r & 0xE0) | ((g >> 3) & 0x1C) | (b >> 6));                /* 3:3:2 */
+        }
+        else if (layout == SSD1351_COLOR_LAYOUT_65K)                                      /* if 65K */
+        {
+            *out++ = (uint8_t)((r & 0xF8) | (g >> 5));                                    /* set 1st */
+            *out++ = (uint8_t)(((g << 3) & 0xE0) | (b >> 3));                             /* set 2nd */
+        }
+        else                                                                              /* if 262K */
+        {
+            *out++ = r >> 2;                                                              /* set 1st */
+            *out++ = g >> 2;                                                              /* set 2nd */
+            *out++ = b >> 2;                                                              /* set 3rd */
+        }
+        in += step;                                                                       /* next pixel */
+    }
+}
+
+#if defined(SSD1351_COLOR_NEON)
+/**
+ * @brief      convert pixels with the neon kernel
+ * @param[in]  layout panel layout
+ * @param[in]  swap red blue swap flag
+ * @param[in]  step source pixel bytes
+ * @param[in]  *in pointer to a source pixel buffer
+ * @param[out] *out pointer to a panel format buffer
+ * @param[in]  num pixel number
+ * @return     converted pixel number
+ * @note       16 pixels per loop, the rest is left to the next kernel
+ */
+static uint32_t a_ssd1351_color_convert_neon(uint8_t layout, uint8_t swap, uint8_t step, 
+                                             const uint8_t *in, uint8_t *out, uint32_t num)
+{
+    uint32_t n;
+    uint8x16_t r;
+    uint8x16_t g;
+    uint8x16_t b;
+    uint8x16_t t;
+    
+    for (n = 0; (num - n) >= 16; n += 16)                                                 /* 16 pixels */
+    {
+        if (step == 4)                                                                    /* if rgba8888 */
+        {
+            uint8x16x4_t v = vld4q_u8(in);                                                /* load planes */
+            
+            r = v.val[0];                                                                 /* get red */
+            g = v.val[1];                                                                 /* get green */
+            b = v.val[2];                                                                 /* get blue */
+        }
+        else                                                                              /* if rgb888 */
+        {
+            uint8x16x3_t v = vld3q_u8(in);                                                /* load planes */
+            
+            r = v.val[0];                                                                 /* get red */
+            g = v.val[1];                                                                 /* get green */
+            b = v.val[2];                                                                 /* get blue */
+        }
+        if (swap != 0)                                                                    /* if a b c */
+        {
+            t = r;                                                                        /* swap */
+            r = b;                                                                        /* blue first */
+            b = t;                                                                        /* red last */
+        }
+        if (layout == SSD1351_COLOR_LAYOUT_256)                                           /* if 256 */
+        {
+            vst1q_u8(out, vorrq_u8(vorrq_u8(vandq_u8(r, vdupq_n_u8(0xE0)), 
+                                            vandq_u8(vshrq_n_u8(g, 3), vdupq_n_u8(0x1C))), 
+                                   vshrq_n_u8(b, 6)));                                    /* 3:3:2 */
+            out += 16;                                                                    /* next */
+        }
+        else if (layout == SSD1351_COLOR_LAYOUT_65K)                                      /* if 65K */
+        {
+            uint8x16x2_t o;
+            
+            o.val[0] = vorrq_u8(vandq_u8(r, vdupq_n_u8(0xF8)), vshrq_n_u8(g, 5));         /* set 1st */
+            o.val[1] = vorrq_u8(vandq_u8(vshlq_n_u8(g, 3), vdupq_n_u8(0xE0)), 
+                                vshrq_n_u8(b, 3));                                        /* set 2nd */
+            vst2q_u8(out, o);                                                             /* store */
+            out += 32;                                                                    /* next */
+        }
+        else                                                                              /* if 262K */
+        {
+            uint8x16x3_t o;
+            
+            o.val[0] = vshrq_n_u8(r, 2);                                                  /* set 1st */
+            o.val[1] = vshrq_n_u8(g, 2);                                                  /* set 2nd */
+            o.val[2] = vshrq_n_u8(b, 2);                                                  /* set 3rd */
+            vst3q_u8(out, o);                                                             /* store */
+            out += 48;                                                                    /* next */
+        }
+        in += 16 * step;                                                                  /* next pixels */
+    }
+    
+    return n;                                                                             /* return converted */
+}
+#endif
+
+#if defined(SSD1351_COLOR_SSE2) || defined(SSD1351_COLOR_AVX2)
+/**
+ * @brief     read a packed rgb888 pixel
+ * @param[in] *in pointer to a source pixel
+ * @return    0x00BBGGRR pixel
+ * @note      none
+ */
+static inline int a_ssd1351_color_rgb(const uint8_t *in)
+{
+    return (int)((uint32_t)in[0] | ((uint32_t)in[1] << 8) | ((uint32_t)in[2] << 16));      /* return pixel */
+}
+#endif
+
+#if defined(SSD1351_COLOR_SSE2)
+/**
+ * @brief      convert pixels with the sse2 kernel
+ * @param[in]  layout panel layout
+ * @param[in]  swap red blue swap flag
+ * @param[in]  step source pixel bytes
+ * @param[in]  *in pointer to a source pixel buffer
+ * @param[out] *out pointer to a panel format buffer
+ * @param[in]  num pixel number
+ * @return     converted pixel number
+ * @note       4 pixels per loop, each pixel is a 0x00BBGGRR lane
+ */
+static uint32_t a_ssd1351_color_convert_sse2(uint8_t layout, uint8_t swap, uint8_t step, 
+                                             const uint8_t *in, uint8_t *out, uint32_t num)
+{
+    uint32_t n;
+    uint8_t i;
+    uint8_t tmp[16];
+    int32_t word;
+    __m128i x;
+    __m128i v;
+    
+    for (n = 0; (num - n) >= 4; n += 4)                                                   /* 4 pixels */
+    {
+        if (step == 4)                                                                    /* if rgba8888 */
+        {
+            x = _mm_loadu_si128((const __m128i *)in);                                     /* load 4 pixels */
+        }
+        else                                                                              /* if rgb888 */
+        {
+            x = _mm_set_epi32(a_ssd1351_color_rgb(in + 9), a_ssd1351_color_rgb(in + 6), 
+                              a_ssd1351_color_rgb(in + 3), a_ssd1351_color_rgb(in));      /* gather 4 pixels */
+        }
+        if (swap != 0)                                                                    /* if a b c */
+        {
+            x = _mm_or_si128(_mm_or_si128(_mm_and_si128(x, _mm_set1_epi32(0x0000FF00)), 
+                                          _mm_and_si128(_mm_srli_epi32(x, 16), _mm_set1_epi32(0xFF))), 
+                             _mm_slli_epi32(_mm_and_si128(x, _mm_set1_epi32(0xFF)), 16)); /* swap red and blue */
+        }
+        if (layout == SSD1351_COLOR_LAYOUT_256)                                           /* if 256 */
+        {
+            v = _mm_or_si128(_mm_or_si128(_mm_and_si128(x, _mm_set1_epi32(0xE0)), 
+                                          _mm_and_si128(_mm_srli_epi32(x, 11), _mm_set1_epi32(0x1C))), 
+                             _mm_and_si128(_mm_srli_epi32(x, 22), _mm_set1_epi32(0x03)));  /* 3:3:2 */
+            v = _mm_packs_epi32(v, v);                                                    /* 32 to 16 */
+            v = _mm_packus_epi16(v, v);                                                   /* 16 to 8 */
+            word = _mm_cvtsi128_si32(v);                                                  /* get 4 bytes */
+            memcpy(out, &word, 4);                                                        /* store */
+            out += 4;                                                                     /* next */
+        }
+        else if (layout == SSD1351_COLOR_LAYOUT_65K)                                      /* if 65K */
+        {
+            v = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(_mm_and_si128(x, _mm_set1_epi32(0xF8)), 8), 
+                                          _mm_and_si128(_mm_srli_epi32(x, 5), _mm_set1_epi32(0x07E0))), 
+                             _mm_and_si128(_mm_srli_epi32(x, 19), _mm_set1_epi32(0x1F)));  /* 5:6:5 */
+            v = _mm_or_si128(_mm_srli_epi32(v, 8), 
+                             _mm_slli_epi32(_mm_and_si128(v, _mm_set1_epi32(0xFF)), 8));   /* high byte first */
+            v = _mm_packs_epi32(_mm_sub_epi32(v, _mm_set1_epi32(0x8000)), 
+                                _mm_setzero_si128());                                     /* 32 to 16 with offset */
+            v = _mm_xor_si128(v, _mm_set1_epi16((short)0x8000));                          /* remove offset */
+            _mm_storel_epi64((__m128i *)out, v);                                          /* store */
+            out += 8;                                                                     /* next */
+        }
+        else                                                                              /* if 262K */
+        {
+            v = _mm_and_si128(_mm_srli_epi32(x, 2), _mm_set1_epi32(0x003F3F3F));          /* 6:6:6 */
+            _mm_storeu_si128((__m128i *)tmp, v);                                          /* store lanes */
+            for (i = 0; i < 4; i++)                                                       /* drop the 4th byte */
+            {
+                memcpy(out, &tmp[i * 4], 3);                                              /* copy pixel */
+                out += 3;                                                                 /* next */
+            }
+        }
+        in += 4 * step;                                                                   /* next pixels */
+    }
+    
+    return n;                                                                             /* return converted */
+}
+#endif
+
+#if defined(SSD1351_COLOR_AVX2)
+/**
+ * @brief      convert pixels with the avx2 kernel
+ * @param[in]  layout panel layout
+ * @param[in]  swap red blue swap flag
+ * @param[in]  step source pixel bytes
+ * @param[in]  *in pointer to a source pixel buffer
+ * @param[out] *out pointer to a panel format buffer
+ * @param[in]  num pixel number
+ * @return     converted pixel number
+ * @note       8 pixels per loop, rgb888 loads read 4 bytes ahead so 2 more pixels must remain
+ */
+static uint32_t a_ssd1351_color_convert_avx2(uint8_t layout, uint8_t swap, uint8_t step, 
+                                             const uint8_t *in, uint8_t *out, uint32_t num)
+{
+    const __m256i expand = _mm256_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1, 
+                                            0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1);
+    const __m256i pick_256 = _mm256_setr_epi8(0, 4, 8, 12, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 
+                                              0, 4, 8, 12, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1);
+    const __m256i pick_65k = _mm256_setr_epi8(1, 0, 5, 4, 9, 8, 13, 12, -1, -1, -1, -1, -1, -1, -1, -1, 
+                                              1, 0, 5, 4, 9, 8, 13, 12, -1, -1, -1, -1, -1, -1, -1, -1);
+    const __m256i pick_262k = _mm256_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1, 
+                                               0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1);
+    uint32_t n;
+    uint32_t need;
+    int32_t word;
+    __m256i x;
+    __m256i v;
+    __m128i lo;
+    __m128i hi;
+    
+    need = (step == 4) ? 8 : 10;                                                          /* pixels needed per loop */
+    for (n = 0; (num - n) >= need; n += 8)                                                /* 8 pixels */
+    {
+        if (step == 4)                                                                    /* if rgba8888 */
+        {
+            x = _mm256_loadu_si256((const __m256i *)in);                                  /* load 8 pixels */
+        }
+        else                                                                              /* if rgb888 */
+        {
+            lo = _mm_loadu_si128((const __m128i *)in);                                    /* load pixel 0 - 3 */
+            hi = _mm_loadu_si128((const __m128i *)(in + 12));                             /* load pixel 4 - 7 */
+            x = _mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1);               /* combine */
+            x = _mm256_shuffle_epi8(x, expand);                                           /* one pixel per lane */
+        }
+        if (swap != 0)                                                                    /* if a b c */
+        {
+            x = _mm256_or_si256(_mm256_or_si256(_mm256_and_si256(x, _mm256_set1_epi32(0x0000FF00)), 
+                                                _mm256_and_si256(_mm256_srli_epi32(x, 16), _mm256_set1_epi32(0xFF))), 
+                                _mm256_slli_epi32(_mm256_and_si256(x, _mm256_set1_epi32(0xFF)), 16));  /* swap red and blue */
+        }
+        if (layout == SSD1351_COLOR_LAYOUT_256)                                           /* if 256 */
+        {
+            v = _mm256_or_si256(_mm256_or_si256(_mm256_and_si256(x, _mm256_set1_epi32(0xE0)), 
+                                                _mm256_and_si256(_mm256_srli_epi32(x, 11), _mm256_set1_epi32(0x1C))), 
+                                _mm256_and_si256(_mm256_srli_epi32(x, 22), _mm256_set1_epi32(0x03)));  /* 3:3:2 */
+            v = _mm256_shuffle_epi8(v, pick_256);                                         /* compact */
+            word = _mm_cvtsi128_si32(_mm256_castsi256_si128(v));                          /* get pixel 0 - 3 */
+            memcpy(out, &word, 4);                                                        /* store */
+            word = _mm_cvtsi128_si32(_mm256_extracti128_si256(v, 1));                     /* get pixel 4 - 7 */
+            memcpy(out + 4, &word, 4);                                                    /* store */
+            out += 8;                                                                     /* next */
+        }
+        else if (layout == SSD1351_COLOR_LAYOUT_65K)                                      /* if 65K */
+        {
+            v = _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(_mm256_and_si256(x, _mm256_set1_epi32(0xF8)), 8), 
+                                                _mm256_and_si256(_mm256_srli_epi32(x, 5), _mm256_set1_epi32(0x07E0))), 
+                                _mm256_and_si256(_mm256_srli_epi32(x, 19), _mm256_set1_epi32(0x1F)));  /* 5:6:5 */
+            v = _mm256_shuffle_epi8(v, pick_65k);                                         /* high byte first */
+            _mm_storel_epi64((__m128i *)out, _mm256_castsi256_si128(v));                  /* store pixel 0 - 3 */
+            _mm_storel_epi64((__m128i *)(out + 8), _mm256_extracti128_si256(v, 1));       /* store pixel 4 - 7 */
+            out += 16;                                                                    /* next */
+        }
+        else                                                                              /* if 262K */
+        {
+            v = _mm256_and_si256(_mm256_srli_epi32(x, 2), _mm256_set1_epi32(0x003F3F3F)); /* 6:6:6 */
+            v = _mm256_shuffle_epi8(v, pick_262k);                                        /* drop the 4th byte */
+            lo = _mm256_castsi256_si128(v);                                               /* get pixel 0 - 3 */
+            hi = _mm256_extracti128_si256(v, 1);                                          /* get pixel 4 - 7 */
+            _mm_storel_epi64((__m128i *)out, lo);                                         /* store 8 bytes */
+            word = _mm_cvtsi128_si32(_mm_srli_si128(lo, 8));                              /* get 4 bytes */
+            memcpy(out + 8, &word, 4);                                                    /* store */
+            _mm_storel_epi64((__m128i *)(out + 12), hi);                                  /* store 8 bytes */
+            word = _mm_cvtsi128_si32(_mm_srli_si128(hi, 8));                              /* get 4 bytes */
+            memcpy(out + 20, &word, 4);                                                   /* store */
+            out += 24;                                                                    /* next */
+        }
+        in += 8 * step;                                                                   /* next pixels */
+    }
+    
+    return n;                                                                             /* return converted */
+}
+#endif
+
+/**
+ * @brief      convert rgb888 or rgba8888 pixels to the panel format
+ * @param[in]  depth color depth
+ * @param[in]  sequence color sequence
+ * @param[in]  format source pixel format
+ * @param[in]  *in pointer to a source pixel buffer
+ * @param[out] *out pointer to a panel format buffer
+ * @param[in]  num pixel number
+ * @return     written bytes
+ * @note       the first channel is red in c b a and blue in a b c sequence,
+ *             256 color is 3:3:2, 65K color is 5:6:5 high byte first and 262K color is 6 bits per byte
+ */
+uint32_t ssd1351_color_convert(ssd1351_color_depth_t depth, ssd1351_color_sequence_t sequence, ssd1351_color_format_t format, 
+                               const uint8_t *in, uint8_t *out, uint32_t num)
+{
+    uint8_t layout;
+    uint8_t swap;
+    uint8_t step;
+    uint8_t bytes;
+    uint32_t n;
+    
+    if (depth == SSD1351_COLOR_DEPTH_256)                                                 /* if 256 */
+    {
+        layout = SSD1351_COLOR_LAYOUT_256;                                                /* 1 byte */
+    }
+    else if (depth == SSD1351_COLOR_DEPTH_65K)                                            /* if 65K */
+    {
+        layout = SSD1351_COLOR_LAYOUT_65K;                                                /* 2 bytes */
+    }
+    else                                                                                  /* if 262K */
+    {
+        layout = SSD1351_COLOR_LAYOUT_262K;                                               /* 3 bytes */
+    }
+    bytes = layout + 1;                                                                   /* get pixel bytes */
+    swap = (sequence == SSD1351_COLOR_SEQUENCE_A_B_C) ? 1 : 0;                            /* blue first in a b c */
+    step = (format == SSD1351_COLOR_FORMAT_RGBA8888) ? 4 : 3;                             /* get source bytes */
+    n = 0;                                                                                /* init 0 */
+#if defined(SSD1351_COLOR_NEON)
+    n += a_ssd1351_color_convert_neon(layout, swap, step, in, out, num);                  /* neon */
+#endif
+#if defined(SSD1351_COLOR_AVX2)
+    n += a_ssd1351_color_convert_avx2(layout, swap, step, in, out, num);                  /* avx2 */
+#endif
+#if defined(SSD1351_COLOR_SSE2)
+    n += a_ssd1351_color_convert_sse2(layout, swap, step, in + n * step, 
+                                      out + n * bytes, num - n);                          /* sse2 */
+#endif
+    a_ssd1351_color_convert_scalar(layout, swap, step, in + n * step, 
+                                   out + n * bytes, num - n);                             /* the rest */
+    
+    return num * bytes;                                                                   /* return written bytes */
+}
+
+/**
+ * @brief  get the conversion kernel name
+ * @return pointer to a kernel name string
+ * @note   "neon", "avx2", "sse2" or "scalar"
+ */
+const char *ssd1351_color_get_kernel(void)
+{
+#if defined(SSD1351_COLOR_NEON)
+    return "neon";                                                                        /* neon */
+#elif defined(SSD1351_COLOR_AVX2)
+    return "avx2";                                                                        /* avx2 */
+#elif defined(SSD1351_COLOR_SSE2)
+    return "sse2";                                                                        /* sse2 */
+#else
+    return "scalar";                                                                      /* scalar */
+#endif
+}
@@ -0,0 +1,90 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_ssd1351_color.h
+ * @brief     driver ssd1351 color header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_SSD1351_COLOR_H
+#define DRIVER_SSD1351_COLOR_H
+
+#include "driver_ssd1351.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup ssd1351_color_driver ssd1351 color driver function
+ * @brief    ssd1351 color conversion modules
+ * @ingroup  ssd1351_driver
+ * @{
+ */
+
+/**
+ * @brief ssd1351 color simd definition
+ */
+#ifndef SSD1351_COLOR_SIMD
+    #define SSD1351_COLOR_SIMD  1        /**< use the simd kernels of the target */
+#endif
+
+/**
+ * @brief      convert rgb888 or rgba8888 pixels to the panel format
+ * @param[in]  depth color depth
+ * @param[in]  sequence color sequence
+ * @param[in]  format source pixel format
+ * @param[in]  *in pointer to a source pixel buffer
+ * @param[out] *out pointer to a panel format buffer
+ * @param[in]  num pixel number
+ * @return     written bytes
+ * @note       the first channel is red in c b a and blue in a b c sequence,
+ *             256 color is 3:3:2, 65K color is 5:6:5 high byte first and 262K color is 6 bits per byte
+ */
+uint32_t ssd1351_color_convert(ssd1351_color_depth_t depth, ssd1351_color_sequence_t sequence, ssd1351_color_format_t format, 
+                               const uint8_t *in, uint8_t *out, uint32_t num);
+
+/**
+ * @brief  get the conversion kernel name
+ * @return pointer to a kernel name string
+ * @note   "neon", "avx2", "sse2" or "scalar"
+ */
+const char *ssd1351_color_get_kernel(void);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
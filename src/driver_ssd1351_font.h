@@ -41,11 +41,13 @@
 #include <stdint.h>
 #include <stdio.h>
 #include <string.h>
+#include "driver_ssd1351.h"
 
 #ifdef __cplusplus
 extern "C"{
 #endif
 
+#if (SSD1351_FONT_PACKED == 0) && (SSD1351_FONT_12_ENABLE != 0)
 /**
  * @brief ascii 1206 definition
  */
@@ -147,7 +149,9 @@ static const uint8_t gsc_ssd1351_ascii_1206[95][12] =
     {0x00, 0x00, 0x40, 0x20, 0x7B, 0xE0, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"}", 93*/
     {0x40, 0x00, 0x80, 0x00, 0x40, 0x00, 0x20, 0x00, 0x20, 0x00, 0x40, 0x00}, /*"~", 94*/
 };
+#endif
 
+#if (SSD1351_FONT_PACKED == 0) && (SSD1351_FONT_16_ENABLE != 0)
 /**
  * @brief ascii 1608 definition
  */
@@ -249,7 +253,9 @@ static const uint8_t gsc_ssd1351_ascii_1608[95][16] =
     {0x00, 0x00, 0x40, 0x02, 0x40, 0x02, 0x3E, 0xFC, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"}", 93*/
     {0x00, 0x00, 0x60, 0x00, 0x80, 0x00, 0x80, 0x00, 0x40, 0x00, 0x40, 0x00, 0x20, 0x00, 0x20, 0x00}, /*"~", 94*/
 };
+#endif
 
+#if (SSD1351_FONT_PACKED == 0) && (SSD1351_FONT_24_ENABLE != 0)
 /**
  * @brief ascii 2412 definition
  */
@@ -351,6 +357,7 @@ static const uint8_t gsc_ssd1351_ascii_2412[95][36] =
     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x02, 0x30, 0x00, 0x06, 0x1F, 0xF7, 0xFC, 0x00, 0x14, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"}", 93*/
     {0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x60, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x20, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x10, 0x00, 0x00}, /*"~", 94*/
 };
+#endif
 
 #ifdef __cplusplus
 }
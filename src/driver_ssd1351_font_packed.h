@@ -0,0 +1,548 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_ssd1351_font_packed.h
+ * @brief     driver ssd1351 packed font header file
+ * @version   2.0.0
+ * @author    Shifeng Li
+ * @date      2021-04-08
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2021/04/08  <td>2.0      <td>Shifeng Li  <td>format the code
+ * <tr><td>2020/12/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_SSD1351_FONT_PACKED_H
+#define DRIVER_SSD1351_FONT_PACKED_H
+
+#include "driver_ssd1351.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+#if (SSD1351_FONT_PACKED != 0) && (SSD1351_FONT_12_ENABLE != 0)
+/**
+ * @brief packed ascii 1206 data definition
+ */
+static const uint8_t gsc_ssd1351_packed_1206_data[766] =
+{
+    0xF0, 0xF0, 0xF0, 0xF0, 0xC0, /*" ", 0*/
+    0xF0, 0xB6, 0x11, 0xF0, 0xF0, 0x80, /*"!", 1*/
+    0xE2, 0x91, 0xC2, 0x91, 0xF0, 0x70, /*""", 2*/
+    0x09, 0x00, 0xBC, 0x3D, 0x00, 0xBC, 0x3D, 0x00, 0x90, /*"#", 3*/
+    0x18, 0xC2, 0x44, 0x7F, 0xE2, 0x24, 0x31, 0x80, 0x00, /*"$", 4*/
+    0x18, 0x02, 0x4C, 0x1B, 0x00, 0xD8, 0x32, 0x40, 0x18, /*"%", 5*/
+    0x03, 0x81, 0xC4, 0x27, 0x41, 0xC8, 0x07, 0x40, 0x04, /*"&", 6*/
+    0x31, 0x92, 0xF0, 0xF0, 0xF0, 0xC0, /*"'", 7*/
+    0xF0, 0xF0, 0x96, 0x51, 0x61, 0x31, 0x81, 0x10, /*"(", 8*/
+    0xD1, 0x81, 0x31, 0x61, 0x56, 0xF0, 0xC0, /*")", 9*/
+    0x09, 0x00, 0x60, 0x1F, 0x80, 0x60, 0x09, 0x00, 0x00, /*"*", 10*/
+    0x51, 0xB1, 0x87, 0x81, 0xB1, 0xF0, 0x30, /*"+", 11*/
+    0xB1, 0x92, 0xF0, 0xF0, 0xF0, 0x40, /*", ", 12*/
+    0x51, 0xB1, 0xB1, 0xB1, 0xB1, 0xF0, 0x30, /*"-", 13*/
+    0xF0, 0x61, 0xF0, 0xF0, 0xF0, 0x50, /*".", 14*/
+    0xA1, 0x83, 0x72, 0x73, 0x81, 0xF0, 0x70, /*"/", 15*/
+    0x1F, 0x82, 0x04, 0x20, 0x42, 0x04, 0x1F, 0x80, 0x00, /*"0", 16*/
+    0xF1, 0x51, 0x48, 0xB1, 0xF0, 0xB0, /*"1", 17*/
+    0x18, 0xC2, 0x14, 0x22, 0x42, 0x44, 0x18, 0x40, 0x00, /*"2", 18*/
+    0x10, 0x82, 0x04, 0x24, 0x42, 0x44, 0x1B, 0x80, 0x00, /*"3", 19*/
+    0x02, 0x00, 0xD0, 0x11, 0x03, 0xFC, 0x01, 0x40, 0x00, /*"4", 20*/
+    0x3C, 0x82, 0x44, 0x24, 0x42, 0x44, 0x23, 0x80, 0x00, /*"5", 21*/
+    0x1F, 0x82, 0x44, 0x24, 0x43, 0x44, 0x03, 0x80, 0x00, /*"6", 22*/
+    0x22, 0xA1, 0xB1, 0x25, 0x43, 0x91, 0xF0, 0x60, /*"7", 23*/
+    0x1B, 0x82, 0x44, 0x24, 0x42, 0x44, 0x1B, 0x80, 0x00, /*"8", 24*/
+    0x1C, 0x02, 0x2C, 0x22, 0x42, 0x24, 0x1F, 0x80, 0x00, /*"9", 25*/
+    0xF0, 0xD1, 0x41, 0xF0, 0xF0, 0x80, /*":", 26*/
+    0xF0, 0xE1, 0x32, 0xF0, 0xF0, 0x70, /*";", 27*/
+    0x00, 0x00, 0x40, 0x0A, 0x01, 0x10, 0x20, 0x84, 0x04, /*"<", 28*/
+    0x09, 0x00, 0x90, 0x09, 0x00, 0x90, 0x09, 0x00, 0x00, /*"=", 29*/
+    0x00, 0x04, 0x04, 0x20, 0x81, 0x10, 0x0A, 0x00, 0x40, /*">", 30*/
+    0x18, 0x02, 0x00, 0x23, 0x42, 0x40, 0x18, 0x00, 0x00, /*"?", 31*/
+    0x1F, 0x82, 0x04, 0x27, 0x42, 0x94, 0x1F, 0x40, 0x00, /*"@", 32*/
+    0x91, 0x75, 0x43, 0x21, 0x84, 0xB3, 0xB1, 0x20, /*"A", 33*/
+    0x20, 0x43, 0xFC, 0x24, 0x42, 0x44, 0x1B, 0x80, 0x00, /*"B", 34*/
+    0x1F, 0x82, 0x04, 0x20, 0x42, 0x04, 0x30, 0x80, 0x00, /*"C", 35*/
+    0x20, 0x43, 0xFC, 0x20, 0x42, 0x04, 0x1F, 0x80, 0x00, /*"D", 36*/
+    0x20, 0x43, 0xFC, 0x24, 0x42, 0xE4, 0x30, 0xC0, 0x00, /*"E", 37*/
+    0x20, 0x43, 0xFC, 0x24, 0x42, 0xE0, 0x30, 0x00, 0x00, /*"F", 38*/
+    0x0F, 0x01, 0x08, 0x20, 0x42, 0x24, 0x33, 0x80, 0x20, /*"G", 39*/
+    0x20, 0x43, 0xFC, 0x04, 0x00, 0x40, 0x3F, 0xC2, 0x04, /*"H", 40*/
+    0x20, 0x42, 0x04, 0x3F, 0xC2, 0x04, 0x20, 0x40, 0x00, /*"I", 41*/
+    0x00, 0x62, 0x02, 0x20, 0x23, 0xFC, 0x20, 0x02, 0x00, /*"J", 42*/
+    0x20, 0x43, 0xFC, 0x24, 0x40, 0xB0, 0x30, 0xC2, 0x04, /*"K", 43*/
+    0x20, 0x43, 0xFC, 0x20, 0x40, 0x04, 0x00, 0x40, 0x0C, /*"L", 44*/
+    0x28, 0x44, 0xC4, 0x44, 0x88, 0xE0, /*"M", 45*/
+    0x20, 0x43, 0xFC, 0x0C, 0x42, 0x30, 0x3F, 0xC2, 0x00, /*"N", 46*/
+    0x1F, 0x82, 0x04, 0x20, 0x42, 0x04, 0x1F, 0x80, 0x00, /*"O", 47*/
+    0x20, 0x43, 0xFC, 0x24, 0x42, 0x40, 0x18, 0x00, 0x00, /*"P", 48*/
+    0x1F, 0x82, 0x14, 0x21, 0x42, 0x0E, 0x1F, 0xA0, 0x00, /*"Q", 49*/
+    0x20, 0x43, 0xFC, 0x24, 0x42, 0x60, 0x19, 0xC0, 0x04, /*"R", 50*/
+    0x18, 0xC2, 0x44, 0x24, 0x42, 0x24, 0x31, 0x80, 0x00, /*"S", 51*/
+    0x30, 0x02, 0x04, 0x3F, 0xC2, 0x04, 0x30, 0x00, 0x00, /*"T", 52*/
+    0x21, 0xB7, 0xC1, 0xB1, 0x47, 0x51, 0x90, /*"U", 53*/
+    0x21, 0xB5, 0xC3, 0x73, 0x63, 0x91, 0x90, /*"V", 54*/
+    0x23, 0xC5, 0x44, 0xB5, 0x43, 0xF0, 0x40, /*"W", 55*/
+    0x20, 0x43, 0x9C, 0x06, 0x03, 0x9C, 0x20, 0x40, 0x00, /*"X", 56*/
+    0x20, 0x03, 0x84, 0x07, 0xC3, 0x84, 0x20, 0x00, 0x00, /*"Y", 57*/
+    0x30, 0x42, 0x1C, 0x26, 0x43, 0x84, 0x20, 0xC0, 0x00, /*"Z", 58*/
+    0xF0, 0xAA, 0x21, 0x81, 0x21, 0x81, 0xD0, /*"[", 59*/
+    0xD3, 0xC2, 0xC3, 0xC1, 0xE0, /*"\", 60*/
+    0xD1, 0x81, 0x21, 0x81, 0x2A, 0xF0, 0xA0, /*"]", 61*/
+    0xE1, 0xA1, 0xC1, 0xF0, 0xF0, 0x30, /*"^", 62*/
+    0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, /*"_", 63*/
+    0xF0, 0xA1, 0xF0, 0xF0, 0xF0, 0x10, /*"`", 64*/
+    0x00, 0x00, 0x28, 0x05, 0x40, 0x54, 0x03, 0xC0, 0x04, /*"a", 65*/
+    0x21, 0xB8, 0x71, 0x31, 0x71, 0x31, 0x83, 0xF0, /*"b", 66*/
+    0x00, 0x00, 0x38, 0x04, 0x40, 0x44, 0x06, 0x40, 0x00, /*"c", 67*/
+    0x00, 0x00, 0x38, 0x04, 0x42, 0x44, 0x3F, 0xC0, 0x04, /*"d", 68*/
+    0x00, 0x00, 0x38, 0x05, 0x40, 0x54, 0x03, 0x40, 0x00, /*"e", 69*/
+    0x00, 0x00, 0x44, 0x1F, 0xC2, 0x44, 0x24, 0x42, 0x00, /*"f", 70*/
+    0x00, 0x00, 0x2E, 0x05, 0x50, 0x55, 0x06, 0x50, 0x42, /*"g", 71*/
+    0x20, 0x43, 0xFC, 0x04, 0x40, 0x40, 0x03, 0xC0, 0x04, /*"h", 72*/
+    0xF0, 0x21, 0x31, 0x41, 0x25, 0xB1, 0xF0, 0xB0, /*"i", 73*/
+    0xB1, 0xB1, 0x51, 0x51, 0x21, 0x26, 0xF0, 0xA0, /*"j", 74*/
+    0x20, 0x43, 0xFC, 0x01, 0x40, 0x70, 0x04, 0xC0, 0x44, /*"k", 75*/
+    0x21, 0x61, 0x41, 0x61, 0x48, 0xB1, 0xB1, 0xE0, /*"l", 76*/
+    0x55, 0x71, 0xB5, 0x71, 0xC4, 0xE0, /*"m", 77*/
+    0x04, 0x40, 0x7C, 0x04, 0x40, 0x40, 0x03, 0xC0, 0x04, /*"n", 78*/
+    0xF0, 0x33, 0x81, 0x31, 0x71, 0x31, 0x83, 0xF0, /*"o", 79*/
+    0x04, 0x10, 0x7F, 0x04, 0x50, 0x44, 0x03, 0x80, 0x00, /*"p", 80*/
+    0x00, 0x00, 0x38, 0x04, 0x40, 0x45, 0x07, 0xF0, 0x01, /*"q", 81*/
+    0x04, 0x40, 0x7C, 0x02, 0x40, 0x40, 0x04, 0x00, 0x00, /*"r", 82*/
+    0x00, 0x00, 0x64, 0x05, 0x40, 0x54, 0x04, 0xC0, 0x00, /*"s", 83*/
+    0xF0, 0x21, 0x96, 0x81, 0x31, 0xB1, 0xE0, /*"t", 84*/
+    0x51, 0xB4, 0xC1, 0x71, 0x31, 0x75, 0xB1, 0x20, /*"u", 85*/
+    0x51, 0xB3, 0x91, 0x22, 0x92, 0x82, 0xA1, 0x60, /*"v", 86*/
+    0x52, 0xC3, 0x73, 0xB3, 0x72, 0xF0, 0x20, /*"w", 87*/
+    0x04, 0x40, 0x6C, 0x01, 0x00, 0x6C, 0x04, 0x40, 0x00, /*"x", 88*/
+    0x04, 0x10, 0x71, 0x04, 0xE0, 0x18, 0x06, 0x00, 0x40, /*"y", 89*/
+    0x00, 0x00, 0x44, 0x05, 0xC0, 0x64, 0x04, 0x40, 0x00, /*"z", 90*/
+    0xF0, 0xE1, 0x74, 0x15, 0x21, 0x81, 0xD0, /*"{", 91*/
+    0xF0, 0xF0, 0x6C, 0xF0, 0x90, /*"|", 92*/
+    0xD1, 0x81, 0x24, 0x15, 0x61, 0xF0, 0xF0, /*"}", 93*/
+    0x11, 0xA1, 0xC1, 0xC1, 0xB1, 0xA1, 0xA0, /*"~", 94*/
+};
+
+/**
+ * @brief packed ascii 1206 index definition
+ */
+static const uint16_t gsc_ssd1351_packed_1206_index[96] =
+{
+    0, 5, 11, 17, 26, 35, 44, 53, 59, 67, 74, 83,
+    90, 96, 103, 109, 116, 125, 131, 140, 149, 158, 167, 176,
+    184, 193, 202, 208, 214, 223, 232, 241, 250, 259, 267, 276,
+    285, 294, 303, 312, 321, 330, 339, 348, 357, 366, 372, 381,
+    390, 399, 408, 417, 426, 435, 442, 449, 456, 465, 474, 483,
+    490, 495, 502, 508, 514, 520, 529, 537, 546, 555, 564, 573,
+    582, 591, 599, 607, 616, 624, 630, 639, 647, 656, 665, 674,
+    683, 690, 698, 706, 713, 722, 731, 740, 747, 752, 759, 766,
+};
+
+/**
+ * @brief packed ascii 1206 definition
+ */
+static const ssd1351_packed_font_t gsc_ssd1351_packed_1206 =
+{
+    6,                                  /* width */
+    12,                                 /* height */
+    ' ',                                /* first char */
+    95,                                 /* glyph number */
+    NULL,                               /* chars from first */
+    gsc_ssd1351_packed_1206_index,      /* index */
+    gsc_ssd1351_packed_1206_data,       /* data */
+};
+#endif
+
+#if (SSD1351_FONT_PACKED != 0) && (SSD1351_FONT_16_ENABLE != 0)
+/**
+ * @brief packed ascii 1608 data definition
+ */
+static const uint8_t gsc_ssd1351_packed_1608_data[1255] =
+{
+    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x80, /*" ", 0*/
+    0xF0, 0xF0, 0xF0, 0x67, 0x22, 0xE2, 0xF0, 0xF0, 0xF0, 0x50, /*"!", 1*/
+    0xF0, 0x51, 0xD2, 0xD2, 0xF0, 0x21, 0xD2, 0xD2, 0xF0, 0xE0, /*""", 2*/
+    0x61, 0x31, 0xB8, 0x54, 0x31, 0xB1, 0x31, 0xB8, 0x54, 0x31, 0xB1, 0x31, 0xF0, 0x60, /*"#", 3*/
+    0xF0, 0x53, 0x42, 0x61, 0x31, 0x51, 0x4E, 0x31, 0x41, 0x41, 0x62, 0x34, 0xF0, 0xF0, 0x50, /*"$", 4*/
+    0x44, 0xB1, 0x41, 0x41, 0x64, 0x23, 0xB2, 0xB3, 0x14, 0x62, 0x31, 0x41, 0xB4, 0xF0, 0x40, /*"%", 5*/
+    0x00, 0x78, 0x0F, 0x84, 0x10, 0xC4, 0x11, 0x24, 0x0E, 0x98, 0x00, 0xE4, 0x00, 0x84, 0x00, 0x08, /*"&", 6*/
+    0x41, 0xC2, 0x11, 0xC3, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x20, /*"'", 7*/
+    0xF0, 0xF0, 0xF0, 0x86, 0x82, 0x62, 0x51, 0xA1, 0x31, 0xC1, 0xF0, 0x20, /*"(", 8*/
+    0xF0, 0x21, 0xC1, 0x31, 0xA1, 0x52, 0x62, 0x86, 0xF0, 0xF0, 0xF0, 0x80, /*")", 9*/
+    0x61, 0x21, 0xC1, 0x21, 0xD2, 0xB8, 0xB2, 0xD1, 0x21, 0xC1, 0x21, 0xF0, 0x70, /*"*", 10*/
+    0x81, 0xF1, 0xF1, 0xB9, 0xB1, 0xF1, 0xF1, 0xF0, 0x80, /*"+", 11*/
+    0xF1, 0xC2, 0x11, 0xC3, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x60, /*", ", 12*/
+    0xF0, 0x91, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0x70, /*"-", 13*/
+    0xF0, 0xD2, 0xE2, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x70, /*".", 14*/
+    0xF0, 0xE2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xD1, 0xD0, /*"/", 15*/
+    0xF0, 0x67, 0x81, 0x71, 0x61, 0x91, 0x51, 0x91, 0x61, 0x71, 0x87, 0xF0, 0x50, /*"0", 16*/
+    0xF0, 0x51, 0x81, 0x61, 0x81, 0x5B, 0xF1, 0xF1, 0xF0, 0xF0, 0x40, /*"1", 17*/
+    0x00, 0x00, 0x0E, 0x0C, 0x10, 0x14, 0x10, 0x24, 0x10, 0x44, 0x11, 0x84, 0x0E, 0x0C, 0x00, 0x00, /*"2", 18*/
+    0x00, 0x00, 0x0C, 0x18, 0x10, 0x04, 0x11, 0x04, 0x11, 0x04, 0x12, 0x88, 0x0C, 0x70, 0x00, 0x00, /*"3", 19*/
+    0xF0, 0x93, 0xB2, 0x21, 0xA1, 0x41, 0x21, 0x61, 0x51, 0x21, 0x5B, 0xC1, 0x21, 0xF0, 0x30, /*"4", 20*/
+    0x00, 0x00, 0x1F, 0x98, 0x10, 0x84, 0x11, 0x04, 0x11, 0x04, 0x10, 0x88, 0x10, 0x70, 0x00, 0x00, /*"5", 21*/
+    0x00, 0x00, 0x07, 0xF0, 0x08, 0x88, 0x11, 0x04, 0x11, 0x04, 0x18, 0x88, 0x00, 0x70, 0x00, 0x00, /*"6", 22*/
+    0xF0, 0x43, 0xD1, 0xF1, 0x46, 0x51, 0x22, 0xB3, 0xD1, 0xF0, 0xD0, /*"7", 23*/
+    0x00, 0x00, 0x0E, 0x38, 0x11, 0x44, 0x10, 0x84, 0x10, 0x84, 0x11, 0x44, 0x0E, 0x38, 0x00, 0x00, /*"8", 24*/
+    0x00, 0x00, 0x07, 0x00, 0x08, 0x8C, 0x10, 0x44, 0x10, 0x44, 0x08, 0x88, 0x07, 0xF0, 0x00, 0x00, /*"9", 25*/
+    0xF0, 0xF0, 0xF0, 0x92, 0x42, 0x82, 0x42, 0xF0, 0xF0, 0xF0, 0x50, /*":", 26*/
+    0xF0, 0xF0, 0xF0, 0x21, 0x71, 0x52, 0xF0, 0xF0, 0xF0, 0xF0, 0x50, /*";", 27*/
+    0xF0, 0x91, 0xE1, 0x11, 0xC1, 0x31, 0xA1, 0x51, 0x81, 0x71, 0x61, 0x91, 0xF0, 0x30, /*"<", 28*/
+    0x02, 0x20, 0x02, 0x20, 0x02, 0x20, 0x02, 0x20, 0x02, 0x20, 0x02, 0x20, 0x02, 0x20, 0x00, 0x00, /*"=", 29*/
+    0xF0, 0x41, 0x91, 0x61, 0x71, 0x81, 0x51, 0xA1, 0x31, 0xC1, 0x11, 0xE1, 0xF0, 0x80, /*">", 30*/
+    0xF0, 0x53, 0xC1, 0x21, 0xC1, 0x82, 0x51, 0x52, 0x12, 0x51, 0x41, 0xB4, 0xF0, 0x90, /*"?", 31*/
+    0x03, 0xE0, 0x0C, 0x18, 0x13, 0xE4, 0x14, 0x24, 0x17, 0xC4, 0x08, 0x28, 0x07, 0xD0, 0x00, 0x00, /*"@", 32*/
+    0xD1, 0xC4, 0x84, 0x31, 0x53, 0x31, 0xB3, 0x11, 0xE3, 0x21, 0xD3, 0xF1, 0x20, /*"A", 33*/
+    0x10, 0x04, 0x1F, 0xFC, 0x11, 0x04, 0x11, 0x04, 0x11, 0x04, 0x0E, 0x88, 0x00, 0x70, 0x00, 0x00, /*"B", 34*/
+    0x65, 0x92, 0x52, 0x61, 0x91, 0x51, 0x91, 0x51, 0x91, 0x51, 0x81, 0x63, 0x51, 0xF0, 0x50, /*"C", 35*/
+    0x31, 0x91, 0x5B, 0x51, 0x91, 0x51, 0x91, 0x51, 0x91, 0x61, 0x71, 0x87, 0xF0, 0x50, /*"D", 36*/
+    0x10, 0x04, 0x1F, 0xFC, 0x11, 0x04, 0x11, 0x04, 0x17, 0xC4, 0x10, 0x04, 0x08, 0x18, 0x00, 0x00, /*"E", 37*/
+    0x31, 0x91, 0x5B, 0x51, 0x31, 0x51, 0x51, 0x31, 0xB1, 0x15, 0x91, 0xF0, 0x11, 0xF0, 0xC0, /*"F", 38*/
+    0x65, 0x92, 0x52, 0x61, 0x91, 0x51, 0x91, 0x51, 0x51, 0x31, 0x53, 0x34, 0xC1, 0xF0, 0x70, /*"G", 39*/
+    0x31, 0x91, 0x5B, 0x51, 0x41, 0x41, 0xA1, 0xF1, 0xA1, 0x41, 0x41, 0x5B, 0x51, 0x91, 0x20, /*"H", 40*/
+    0xF0, 0x41, 0x91, 0x51, 0x91, 0x5B, 0x51, 0x91, 0x51, 0x91, 0xF0, 0xF0, 0x40, /*"I", 41*/
+    0xE2, 0xF1, 0x31, 0xB1, 0x31, 0xB1, 0x3C, 0x41, 0xF1, 0xF0, 0xD0, /*"J", 42*/
+    0x10, 0x04, 0x1F, 0xFC, 0x11, 0x04, 0x03, 0x80, 0x14, 0x64, 0x18, 0x1C, 0x10, 0x04, 0x00, 0x00, /*"K", 43*/
+    0x31, 0x91, 0x5B, 0x51, 0x91, 0xF1, 0xF1, 0xF1, 0xE2, 0xF0, 0x30, /*"L", 44*/
+    0x31, 0x91, 0x5B, 0x55, 0xF0, 0x16, 0x55, 0xBB, 0x51, 0x91, 0xF0, 0x30, /*"M", 45*/
+    0x31, 0x91, 0x5B, 0x62, 0x71, 0x82, 0xF0, 0x13, 0x81, 0x72, 0x6B, 0x51, 0xC0, /*"N", 46*/
+    0x57, 0x81, 0x71, 0x61, 0x91, 0x51, 0x91, 0x51, 0x91, 0x61, 0x71, 0x87, 0xF0, 0x50, /*"O", 47*/
+    0x31, 0x91, 0x5B, 0x51, 0x41, 0x41, 0x51, 0x41, 0xA1, 0x41, 0xA1, 0x41, 0xB4, 0xF0, 0x90, /*"P", 48*/
+    0x07, 0xF0, 0x08, 0x18, 0x10, 0x24, 0x10, 0x24, 0x10, 0x1C, 0x08, 0x0A, 0x07, 0xF2, 0x00, 0x00, /*"Q", 49*/
+    0x10, 0x04, 0x1F, 0xFC, 0x11, 0x04, 0x11, 0x00, 0x11, 0xC0, 0x11, 0x30, 0x0E, 0x0C, 0x00, 0x04, /*"R", 50*/
+    0x00, 0x00, 0x0E, 0x1C, 0x11, 0x04, 0x10, 0x84, 0x10, 0x84, 0x10, 0x44, 0x1C, 0x38, 0x00, 0x00, /*"S", 51*/
+    0x32, 0xE1, 0xF1, 0x91, 0x5B, 0x51, 0x91, 0x51, 0xF2, 0xF0, 0xC0, /*"T", 52*/
+    0x31, 0xFA, 0x61, 0x91, 0xF1, 0xF1, 0x51, 0x91, 0x5A, 0x61, 0xC0, /*"U", 53*/
+    0x31, 0xF4, 0xC1, 0x34, 0xF0, 0x13, 0xB3, 0x71, 0x23, 0xA3, 0xD1, 0xC0, /*"V", 54*/
+    0x37, 0x91, 0x64, 0xA3, 0x85, 0xF0, 0x13, 0x81, 0x64, 0x57, 0xF0, 0x70, /*"W", 55*/
+    0x10, 0x04, 0x18, 0x0C, 0x16, 0x34, 0x01, 0xC0, 0x01, 0xC0, 0x16, 0x34, 0x18, 0x0C, 0x10, 0x04, /*"X", 56*/
+    0x31, 0xF3, 0xD1, 0x22, 0x51, 0xA6, 0x51, 0x22, 0x51, 0x53, 0xD1, 0xF0, 0xD0, /*"Y", 57*/
+    0x08, 0x04, 0x10, 0x1C, 0x10, 0x64, 0x10, 0x84, 0x13, 0x04, 0x1C, 0x04, 0x10, 0x18, 0x00, 0x00, /*"Z", 58*/
+    0xF0, 0xF0, 0xF0, 0x4E, 0x21, 0xC1, 0x21, 0xC1, 0x21, 0xC1, 0xF0, 0x20, /*"[", 59*/
+    0xF0, 0x32, 0xF0, 0x12, 0xF0, 0x13, 0xF0, 0x12, 0xF0, 0x13, 0xF0, 0x12, 0xF0, 0x10, /*"\", 60*/
+    0xF0, 0x21, 0xC1, 0x21, 0xC1, 0x21, 0xC1, 0x2E, 0xF0, 0xF0, 0xF0, 0x40, /*"]", 61*/
+    0xF0, 0xF0, 0x41, 0xE1, 0xF1, 0xF1, 0xF0, 0x11, 0xF0, 0xE0, /*"^", 62*/
+    0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, /*"_", 63*/
+    0xF0, 0x21, 0xF1, 0xF0, 0x11, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x20, /*"`", 64*/
+    0x00, 0x00, 0x00, 0x98, 0x01, 0x24, 0x01, 0x44, 0x01, 0x44, 0x01, 0x44, 0x00, 0xFC, 0x00, 0x04, /*"a", 65*/
+    0x31, 0xFB, 0xA1, 0x31, 0xA1, 0x51, 0x91, 0x51, 0xA1, 0x31, 0xC3, 0xF0, 0x50, /*"b", 66*/
+    0xF0, 0xA3, 0xC1, 0x31, 0xA1, 0x51, 0x91, 0x51, 0x91, 0x51, 0xA1, 0x31, 0xF0, 0x40, /*"c", 67*/
+    0xF0, 0xA3, 0xC1, 0x31, 0xA1, 0x51, 0x91, 0x51, 0x51, 0x31, 0x41, 0x6B, 0xF1, 0x20, /*"d", 68*/
+    0x00, 0x00, 0x00, 0xF8, 0x01, 0x44, 0x01, 0x44, 0x01, 0x44, 0x01, 0x44, 0x00, 0xC8, 0x00, 0x00, /*"e", 69*/
+    0x00, 0x00, 0x01, 0x04, 0x01, 0x04, 0x0F, 0xFC, 0x11, 0x04, 0x11, 0x04, 0x11, 0x00, 0x18, 0x00, /*"f", 70*/
+    0x00, 0x00, 0x00, 0xD6, 0x01, 0x29, 0x01, 0x29, 0x01, 0x29, 0x01, 0xC9, 0x01, 0x06, 0x00, 0x00, /*"g", 71*/
+    0x31, 0x91, 0x5B, 0xA1, 0x41, 0x91, 0xF1, 0xF1, 0x51, 0xA6, 0xF1, 0x20, /*"h", 72*/
+    0xF0, 0x81, 0x51, 0x52, 0x21, 0x51, 0x52, 0x27, 0xF1, 0xF1, 0xF0, 0xF0, 0x40, /*"i", 73*/
+    0xF0, 0xF2, 0xF1, 0x71, 0x71, 0x32, 0x21, 0x71, 0x32, 0x28, 0xF0, 0xF0, 0x30, /*"j", 74*/
+    0x31, 0x91, 0x5B, 0xC1, 0x21, 0xB1, 0xD2, 0x12, 0x11, 0x91, 0x42, 0x91, 0x51, 0xF0, 0x30, /*"k", 75*/
+    0xF0, 0x41, 0x91, 0x51, 0x91, 0x5B, 0xF1, 0xF1, 0xF0, 0xF0, 0x40, /*"l", 76*/
+    0x71, 0x51, 0x97, 0x91, 0x51, 0x91, 0xF7, 0x91, 0x51, 0x91, 0xF0, 0x16, 0x20, /*"m", 77*/
+    0x71, 0x51, 0x97, 0xA1, 0x41, 0x91, 0xF1, 0xF1, 0x51, 0xA6, 0xF1, 0x20, /*"n", 78*/
+    0xF0, 0x95, 0xA1, 0x51, 0x91, 0x51, 0x91, 0x51, 0x91, 0x51, 0xA5, 0xF0, 0x40, /*"o", 79*/
+    0x71, 0x71, 0x79, 0x81, 0x41, 0x11, 0x71, 0x51, 0x91, 0x51, 0xA1, 0x31, 0xC3, 0xF0, 0x50, /*"p", 80*/
+    0xF0, 0xA3, 0xC1, 0x31, 0xA1, 0x51, 0x91, 0x51, 0x91, 0x51, 0x11, 0x79, 0xF1, /*"q", 81*/
+    0x71, 0x51, 0x91, 0x51, 0x97, 0xA1, 0x41, 0x91, 0x51, 0x91, 0xF2, 0xF0, 0x80, /*"r", 82*/
+    0x00, 0x00, 0x00, 0xCC, 0x01, 0x24, 0x01, 0x24, 0x01, 0x24, 0x01, 0x24, 0x01, 0x98, 0x00, 0x00, /*"s", 83*/
+    0xF0, 0x81, 0xF1, 0xD8, 0xA1, 0x51, 0x91, 0x51, 0xF0, 0xF0, 0x40, /*"t", 84*/
+    0x71, 0xF6, 0xF0, 0x11, 0xF1, 0xF1, 0x91, 0x41, 0xA7, 0xF1, 0x20, /*"u", 85*/
+    0x71, 0xF2, 0xE1, 0x13, 0xF0, 0x12, 0xD1, 0xB1, 0x12, 0xC2, 0xE1, 0x80, /*"v", 86*/
+    0x75, 0xB1, 0x42, 0xC2, 0xB3, 0xF0, 0x12, 0xB1, 0x42, 0x95, 0xB1, 0x80, /*"w", 87*/
+    0xF0, 0x81, 0x51, 0x92, 0x32, 0xB3, 0x11, 0x91, 0x13, 0xB2, 0x32, 0x91, 0x51, 0xF0, 0x30, /*"x", 88*/
+    0x71, 0x71, 0x72, 0x61, 0x71, 0x13, 0x31, 0xC3, 0xC2, 0xA1, 0x12, 0xC2, 0xE1, 0x80, /*"y", 89*/
+    0x00, 0x00, 0x01, 0x84, 0x01, 0x0C, 0x01, 0x34, 0x01, 0x44, 0x01, 0x84, 0x01, 0x0C, 0x00, 0x00, /*"z", 90*/
+    0xF0, 0xF0, 0xF0, 0xF0, 0xB1, 0xA5, 0x16, 0x31, 0xC1, 0x21, 0xC1, 0x10, /*"{", 91*/
+    0xF0, 0xF0, 0xF0, 0xF0, 0x4F, 0x01, 0xF0, 0xF0, 0xF0, 0x30, /*"|", 92*/
+    0xF0, 0x21, 0xC1, 0x21, 0xC1, 0x35, 0x16, 0x91, 0xF0, 0xF0, 0xF0, 0xB0, /*"}", 93*/
+    0xF0, 0x22, 0xD1, 0xF1, 0xF0, 0x11, 0xF1, 0xF0, 0x11, 0xF1, 0xD0, /*"~", 94*/
+};
+
+/**
+ * @brief packed ascii 1608 index definition
+ */
+static const uint16_t gsc_ssd1351_packed_1608_index[96] =
+{
+    0, 9, 19, 29, 43, 58, 73, 89, 100, 112, 124, 137,
+    146, 156, 165, 174, 183, 196, 207, 223, 239, 254, 270, 286,
+    297, 313, 329, 340, 351, 365, 381, 395, 409, 425, 438, 454,
+    469, 483, 499, 514, 529, 544, 557, 568, 584, 595, 607, 620,
+    634, 649, 665, 681, 697, 708, 719, 731, 743, 759, 772, 788,
+    800, 814, 826, 836, 844, 855, 871, 884, 898, 912, 928, 944,
+    960, 972, 985, 998, 1013, 1024, 1037, 1049, 1062, 1077, 1090, 1103,
+    1119, 1130, 1141, 1153, 1165, 1180, 1194, 1210, 1222, 1232, 1244, 1255,
+};
+
+/**
+ * @brief packed ascii 1608 definition
+ */
+static const ssd1351_packed_font_t gsc_ssd1351_packed_1608 =
+{
+    8,                                  /* width */
+    16,                                 /* height */
+    ' ',                                /* first char */
+    95,                                 /* glyph number */
+    NULL,                               /* chars from first */
+    gsc_ssd1351_packed_1608_index,      /* index */
+    gsc_ssd1351_packed_1608_data,       /* data */
+};
+#endif
+
+#if (SSD1351_FONT_PACKED != 0) && (SSD1351_FONT_24_ENABLE != 0)
+/**
+ * @brief packed ascii 2412 data definition
+ */
+static const uint8_t gsc_ssd1351_packed_2412_data[2390] =
+{
+    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+    0xF0, 0xF0, 0xF0, 0x30, /*" ", 0*/
+    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x45, 0x93, 0x7B, 0x33, 0x75, 0x93, 0xF0, 0xF0,
+    0xF0, 0xF0, 0xF0, 0xF0, 0x90, /*"!", 1*/
+    0xF0, 0xF0, 0xF0, 0xA1, 0xF0, 0x62, 0xF0, 0x62, 0xF0, 0x53, 0xF0, 0x62, 0x31, 0xF0, 0x62, 0xF0,
+    0x62, 0xF0, 0x53, 0xF0, 0x62, 0xF0, 0xF0, 0xE0, /*""", 2*/
+    0xF0, 0xF0, 0x32, 0x42, 0xF0, 0x12, 0x28, 0x88, 0x22, 0xF0, 0x12, 0x42, 0xF0, 0x12, 0x42, 0xF0,
+    0x12, 0x42, 0xF0, 0x12, 0x42, 0xF0, 0x12, 0x28, 0x88, 0x22, 0xF0, 0x12, 0x42, 0xF0, 0xF0, 0x10, /*"#", 3*/
+    0xF0, 0xF0, 0xF0, 0xA3, 0x63, 0xB5, 0x54, 0x92, 0x32, 0x81, 0x81, 0x52, 0x71, 0x6F, 0x05, 0x61,
+    0x63, 0x51, 0x84, 0x47, 0xA3, 0x64, 0xF0, 0xF0, 0xF0, 0x80, /*"$", 4*/
+    0x75, 0xF0, 0x22, 0x52, 0xF1, 0x71, 0x61, 0x82, 0x52, 0x33, 0xB6, 0x23, 0xF0, 0x33, 0xF0, 0x43,
+    0x15, 0xD3, 0x12, 0x52, 0x83, 0x41, 0x71, 0x81, 0x62, 0x52, 0xF0, 0x25, 0xF0, 0xE0, /*"%", 5*/
+    0xF4, 0xF0, 0x37, 0xA7, 0x62, 0x81, 0x53, 0x61, 0x81, 0x51, 0x13, 0x41, 0x86, 0x43, 0x11, 0xA4,
+    0x63, 0xF1, 0x33, 0x12, 0xE4, 0x61, 0xD1, 0x91, 0xF0, 0x71, 0xF0, 0xD0, /*"&", 6*/
+    0xF0, 0xF0, 0x11, 0xF0, 0x32, 0x31, 0xF0, 0x32, 0x21, 0xF0, 0x53, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x60, /*"'", 7*/
+    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x97, 0xFB, 0xB4, 0x74, 0x82, 0xD2, 0x61, 0xF0,
+    0x21, 0x41, 0xF0, 0x41, 0xF0, 0xA0, /*"(", 8*/
+    0xF0, 0xB1, 0xF0, 0x41, 0x41, 0xF0, 0x21, 0x62, 0xD2, 0x84, 0x74, 0xBB, 0xF7, 0xF0, 0xF0, 0xF0,
+    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x80, /*")", 9*/
+    0xF0, 0xF0, 0x31, 0x41, 0xF0, 0x32, 0x22, 0xF0, 0x32, 0x22, 0xF0, 0x44, 0xF0, 0x62, 0xF0, 0x2C,
+    0xF0, 0x22, 0xF0, 0x64, 0xF0, 0x42, 0x22, 0xF0, 0x32, 0x22, 0xF0, 0x31, 0x41, 0x90, /*"*", 10*/
+    0xF0, 0xF0, 0x61, 0xF0, 0x81, 0xF0, 0x81, 0xF0, 0x81, 0xF0, 0x81, 0xF0, 0x3B, 0xF0, 0x31, 0xF0,
+    0x81, 0xF0, 0x81, 0xF0, 0x81, 0xF0, 0x81, 0xB0, /*"+", 11*/
+    0xF0, 0xF0, 0xF0, 0x21, 0xF0, 0x32, 0x31, 0xF0, 0x32, 0x21, 0xF0, 0x53, 0xF0, 0xF0, 0xF0, 0xF0,
+    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x50, /*", ", 12*/
+    0xF0, 0xF0, 0x61, 0xF0, 0x81, 0xF0, 0x81, 0xF0, 0x81, 0xF0, 0x81, 0xF0, 0x81, 0xF0, 0x81, 0xF0,
+    0x81, 0xF0, 0x81, 0xF0, 0x81, 0xF0, 0xF0, 0x50, /*"-", 13*/
+    0xF0, 0xF0, 0xF0, 0xF0, 0x63, 0xF0, 0x63, 0xF0, 0x63, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+    0xF0, 0xF0, 0xF0, 0xF0, 0x60, /*".", 14*/
+    0xF0, 0xF0, 0xF2, 0xF0, 0x53, 0xF0, 0x43, 0xF0, 0x42, 0xF0, 0x43, 0xF0, 0x43, 0xF0, 0x42, 0xF0,
+    0x43, 0xF0, 0x43, 0xF0, 0x52, 0xF0, 0xF0, 0xE0, /*"/", 15*/
+    0xF0, 0xF0, 0x38, 0xEC, 0xB3, 0x83, 0x92, 0xC2, 0x81, 0xE1, 0x81, 0xE1, 0x82, 0xC2, 0x93, 0x83,
+    0xBC, 0xE8, 0xF0, 0xF0, 0x10, /*"0", 16*/
+    0xF0, 0xF0, 0xF0, 0xA1, 0xC1, 0xA1, 0xC1, 0xA1, 0xC1, 0x9F, 0x8F, 0x01, 0xF0, 0x81, 0xF0, 0x81,
+    0xF0, 0x81, 0xF0, 0xF0, 0xF0, 0x60, /*"1", 17*/
+    0xF0, 0xF0, 0x13, 0x83, 0x91, 0x12, 0x71, 0x12, 0x81, 0xA1, 0x22, 0x81, 0x91, 0x32, 0x81, 0x81,
+    0x42, 0x81, 0x71, 0x52, 0x82, 0x43, 0x52, 0x97, 0x62, 0xA4, 0x55, 0xF0, 0xF0, 0xF0, 0x60, /*"2", 18*/
+    0xF0, 0xF0, 0x13, 0x63, 0xB4, 0x64, 0x91, 0xE1, 0x81, 0x61, 0x71, 0x81, 0x61, 0x71, 0x82, 0x42,
+    0x71, 0x96, 0x11, 0x52, 0xA4, 0x27, 0xF0, 0x44, 0xF0, 0xF0, 0xF0, 0x80, /*"3", 19*/
+    0xF0, 0xF0, 0x82, 0xF0, 0x52, 0x11, 0xF0, 0x41, 0x31, 0xF0, 0x22, 0x41, 0xF0, 0x11, 0x61, 0x41,
+    0x92, 0x71, 0x41, 0x8F, 0x01, 0x7F, 0x02, 0xF0, 0x31, 0x41, 0xF0, 0x31, 0x41, 0xF0, 0xC0, /*"4", 20*/
+    0xF0, 0xF0, 0xA3, 0xA9, 0x22, 0x11, 0x92, 0x51, 0x71, 0x82, 0x41, 0x81, 0x82, 0x41, 0x81, 0x82,
+    0x41, 0x81, 0x82, 0x42, 0x53, 0x82, 0x58, 0x92, 0x65, 0xF0, 0xF0, 0xF0, 0x90, /*"5", 21*/
+    0xF0, 0xF0, 0x47, 0xEC, 0xB3, 0x41, 0x42, 0xA1, 0x51, 0x62, 0x81, 0x51, 0x81, 0x81, 0x51, 0x81,
+    0x81, 0x51, 0x81, 0x83, 0x32, 0x61, 0xA2, 0x48, 0xF0, 0x25, 0xF0, 0xF0, /*"6", 22*/
+    0xF0, 0xF0, 0xF0, 0x94, 0xF0, 0x43, 0xF0, 0x62, 0xF0, 0x72, 0x95, 0x82, 0x68, 0x82, 0x42, 0xF0,
+    0x12, 0x13, 0xF0, 0x33, 0xF0, 0x62, 0xF0, 0xF0, 0xB0, /*"7", 23*/
+    0xF0, 0xF0, 0x14, 0x44, 0xB6, 0x17, 0x92, 0x32, 0x11, 0x51, 0x91, 0x52, 0x71, 0x81, 0x52, 0x71,
+    0x81, 0x62, 0x61, 0x81, 0x62, 0x61, 0x82, 0x41, 0x12, 0x42, 0x96, 0x26, 0xB3, 0x54, 0xF0, 0xE0, /*"8", 24*/
+    0xF0, 0xF0, 0x25, 0xF0, 0x28, 0x42, 0xA2, 0x52, 0x33, 0x81, 0x81, 0x51, 0x81, 0x81, 0x51, 0x81,
+    0x81, 0x51, 0x81, 0x71, 0x51, 0xA2, 0x41, 0x34, 0xBB, 0xF7, 0xF0, 0xF0, 0x20, /*"9", 25*/
+    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x93, 0x63, 0xC3, 0x63, 0xC3, 0x63, 0xF0, 0xF0,
+    0xF0, 0xF0, 0xF0, 0xF0, 0x90, /*":", 26*/
+    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xA2, 0x72, 0x11, 0xB2, 0x73, 0xF0, 0xF0, 0xF0,
+    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x20, /*";", 27*/
+    0xF0, 0xF0, 0xF0, 0xF1, 0xF0, 0x71, 0x11, 0xF0, 0x51, 0x31, 0xF0, 0x31, 0x51, 0xF0, 0x11, 0x71,
+    0xE1, 0x91, 0xC1, 0xB1, 0xA1, 0xD1, 0x81, 0xF1, 0xF0, 0xC0, /*"<", 28*/
+    0xF0, 0xF0, 0x41, 0x41, 0xF0, 0x31, 0x41, 0xF0, 0x31, 0x41, 0xF0, 0x31, 0x41, 0xF0, 0x31, 0x41,
+    0xF0, 0x31, 0x41, 0xF0, 0x31, 0x41, 0xF0, 0x31, 0x41, 0xF0, 0x31, 0x41, 0xF0, 0x31, 0x41, 0xF0,
+    0xF0, 0x20, /*"=", 29*/
+    0xF0, 0xF0, 0xF0, 0x71, 0xF1, 0x81, 0xD1, 0xA1, 0xB1, 0xC1, 0x91, 0xE1, 0x71, 0xF0, 0x11, 0x51,
+    0xF0, 0x31, 0x31, 0xF0, 0x51, 0x11, 0xF0, 0x71, 0xF0, 0xF0, 0x50, /*">", 30*/
+    0xF0, 0xF4, 0xF0, 0x41, 0x22, 0xF0, 0x41, 0xF0, 0x71, 0xD3, 0x71, 0x74, 0x23, 0x71, 0x71, 0x53,
+    0x71, 0x61, 0xF0, 0x12, 0x42, 0xF0, 0x26, 0xF0, 0x44, 0xF0, 0xF0, 0x80, /*"?", 31*/
+    0xF0, 0xF0, 0x47, 0xFB, 0xB3, 0x83, 0xA1, 0x54, 0x31, 0x92, 0x23, 0x41, 0x31, 0x81, 0x22, 0x61,
+    0x31, 0x81, 0x21, 0x52, 0x41, 0x81, 0x38, 0x31, 0x91, 0x12, 0x61, 0x21, 0xA2, 0x71, 0x21, 0xD7,
+    0x21, 0x60, /*"@", 32*/
+    0xF0, 0x51, 0xF0, 0x72, 0xF0, 0x36, 0xD5, 0x51, 0xA3, 0x41, 0xE3, 0x61, 0xE6, 0x31, 0xF0, 0x27,
+    0xF0, 0x57, 0x21, 0xF0, 0x36, 0xF0, 0x63, 0xF0, 0x81, 0x30, /*"A", 33*/
+    0x51, 0xE1, 0x8F, 0x01, 0x8F, 0x01, 0x81, 0x61, 0x71, 0x81, 0x61, 0x71, 0x81, 0x61, 0x71, 0x81,
+    0x61, 0x71, 0x82, 0x42, 0x71, 0x96, 0x11, 0x52, 0xA4, 0x27, 0xF0, 0x44, 0xF0, 0xE0, /*"B", 34*/
+    0xF0, 0xF0, 0x47, 0xEC, 0xB3, 0x83, 0xA1, 0xC2, 0x81, 0xE1, 0x81, 0xE1, 0x81, 0xE1, 0x81, 0xD1,
+    0x92, 0xB1, 0xA4, 0x72, 0xF0, 0xF0, /*"C", 35*/
+    0x51, 0xE1, 0x8F, 0x01, 0x8F, 0x01, 0x81, 0xE1, 0x81, 0xE1, 0x81, 0xE1, 0x81, 0xD2, 0x91, 0xC1,
+    0xA3, 0x83, 0xBC, 0xE8, 0xF0, 0xF0, 0x10, /*"D", 36*/
+    0x51, 0xE1, 0x8F, 0x01, 0x8F, 0x01, 0x81, 0x61, 0x71, 0x81, 0x61, 0x71, 0x81, 0x61, 0x71, 0x81,
+    0x61, 0x71, 0x81, 0x45, 0x51, 0x81, 0xE1, 0x82, 0xC2, 0xA1, 0x92, 0xF0, 0xE0, /*"E", 37*/
+    0x51, 0xE1, 0x8F, 0x01, 0x8F, 0x01, 0x81, 0x61, 0x71, 0x81, 0x61, 0xF0, 0x11, 0x61, 0xF0, 0x11,
+    0x61, 0xF0, 0x11, 0x45, 0xE2, 0xF0, 0x72, 0xF0, 0x92, 0xF0, 0xF0, 0x90, /*"F", 38*/
+    0xF0, 0xF0, 0x47, 0xEC, 0xB3, 0x83, 0x92, 0xC2, 0x81, 0xE1, 0x81, 0x81, 0x51, 0x81, 0x81, 0x51,
+    0x91, 0x76, 0x94, 0x56, 0xF0, 0x31, 0xF0, 0x81, 0x90, /*"G", 39*/
+    0x51, 0xE1, 0x8F, 0x01, 0x8F, 0x01, 0x81, 0x61, 0x71, 0xF1, 0xF0, 0x81, 0xF0, 0x81, 0xF0, 0x81,
+    0xF0, 0x11, 0x61, 0x71, 0x8F, 0x01, 0x8F, 0x01, 0x81, 0xE1, 0x30, /*"H", 40*/
+    0xF0, 0xF0, 0xF0, 0x81, 0xE1, 0x81, 0xE1, 0x81, 0xE1, 0x8F, 0x01, 0x8F, 0x01, 0x81, 0xE1, 0x81,
+    0xE1, 0x81, 0xE1, 0xF0, 0xF0, 0xF0, 0x60, /*"I", 41*/
+    0xF0, 0xF0, 0xF2, 0xF0, 0x73, 0xF0, 0x81, 0x51, 0xF0, 0x21, 0x51, 0xF0, 0x21, 0x51, 0xF0, 0x12,
+    0x5F, 0x03, 0x6F, 0x02, 0x71, 0xF0, 0x81, 0xF0, 0x81, 0xF0, 0x30, /*"J", 42*/
+    0x51, 0xE1, 0x8F, 0x01, 0x8F, 0x01, 0x81, 0x62, 0x61, 0xE2, 0xF0, 0x65, 0xE1, 0x22, 0x34, 0xC1,
+    0x11, 0x64, 0x21, 0x82, 0x95, 0x81, 0xC3, 0x81, 0xD2, 0xF0, 0x81, 0x30, /*"K", 43*/
+    0x51, 0xE1, 0x8F, 0x01, 0x8F, 0x01, 0x81, 0xE1, 0xF0, 0x81, 0xF0, 0x81, 0xF0, 0x81, 0xF0, 0x81,
+    0xF0, 0x81, 0xF0, 0x72, 0xF0, 0x52, 0xF0, 0xE0, /*"L", 44*/
+    0x51, 0xE1, 0x8F, 0x01, 0x84, 0xB1, 0x89, 0xF0, 0x49, 0xF0, 0x57, 0xF0, 0x15, 0xF4, 0xF0, 0x14,
+    0xB1, 0x8F, 0x01, 0x8F, 0x01, 0x81, 0xE1, 0x30, /*"M", 45*/
+    0x51, 0xE1, 0x8F, 0x01, 0x83, 0xC1, 0x94, 0xF0, 0x73, 0xF0, 0x83, 0xF0, 0x74, 0xF0, 0x73, 0xF0,
+    0x83, 0xB1, 0xA4, 0x9F, 0x01, 0x81, 0xF0, 0x30, /*"N", 46*/
+    0xF0, 0xF0, 0x38, 0xEC, 0xB3, 0x83, 0x92, 0xC2, 0x81, 0xE1, 0x81, 0xE1, 0x82, 0xC2, 0x92, 0xA2,
+    0xBC, 0xE8, 0xF0, 0xF0, 0x10, /*"O", 47*/
+    0x51, 0xE1, 0x8F, 0x01, 0x8F, 0x01, 0x81, 0x71, 0x61, 0x81, 0x71, 0xF1, 0x71, 0xF1, 0x71, 0xF1,
+    0x71, 0xF2, 0x52, 0xF0, 0x17, 0xF0, 0x35, 0xF0, 0xF0, 0x60, /*"P", 48*/
+    0xF0, 0xF0, 0x38, 0xEC, 0xB3, 0x83, 0x92, 0x91, 0x31, 0x81, 0xA1, 0x31, 0x81, 0xA2, 0x21, 0x82,
+    0xB4, 0x82, 0xA5, 0x8C, 0x22, 0xA8, 0x41, 0xF0, 0xB0, /*"Q", 49*/
+    0x51, 0xE1, 0x8F, 0x01, 0x8F, 0x01, 0x81, 0x61, 0x71, 0x81, 0x61, 0xF0, 0x11, 0x62, 0xF1, 0x64,
+    0xD1, 0x61, 0x14, 0xB2, 0x41, 0x44, 0xA6, 0x63, 0xA4, 0x91, 0xF0, 0x81, 0x30, /*"R", 50*/
+    0xF0, 0xF0, 0x14, 0x55, 0x96, 0x62, 0x92, 0x32, 0x71, 0x91, 0x52, 0x71, 0x81, 0x52, 0x71, 0x81,
+    0x62, 0x61, 0x81, 0x62, 0x61, 0x91, 0x62, 0x42, 0x91, 0x67, 0x94, 0x64, 0xF0, 0xE0, /*"S", 51*/
+    0x72, 0xF0, 0x52, 0xF0, 0x71, 0xF0, 0x81, 0xF0, 0x81, 0xE1, 0x8F, 0x01, 0x8F, 0x01, 0x81, 0xE1,
+    0x81, 0xF0, 0x81, 0xF0, 0x82, 0xF0, 0x92, 0xF0, /*"T", 52*/
+    0x51, 0xF0, 0x8E, 0xAF, 0x91, 0xD2, 0xF0, 0x81, 0xF0, 0x81, 0xF0, 0x81, 0xF0, 0x81, 0xF0, 0x81,
+    0x81, 0xD1, 0x9E, 0xA1, 0xF0, 0x30, /*"U", 53*/
+    0x51, 0xF0, 0x82, 0xF0, 0x76, 0xF0, 0x3A, 0xE1, 0x58, 0xF0, 0x56, 0xF0, 0x63, 0xF0, 0x34, 0xA1,
+    0x45, 0xE5, 0xF0, 0x42, 0xF0, 0x71, 0xF0, 0x30, /*"V", 54*/
+    0x51, 0xF0, 0x86, 0xF0, 0x3D, 0xB1, 0x5A, 0xF0, 0x15, 0xB8, 0xF0, 0x1C, 0xC1, 0x4B, 0xF0, 0x15,
+    0xB1, 0x25, 0xF0, 0x13, 0xF0, 0x61, 0xF0, 0x30, /*"W", 55*/
+    0xF0, 0xE1, 0xE1, 0x82, 0xC2, 0x85, 0x74, 0x81, 0x15, 0x33, 0x21, 0xD5, 0xF0, 0x56, 0xC1, 0x32,
+    0x35, 0x11, 0x84, 0x75, 0x82, 0xC2, 0x81, 0xE1, 0xF0, 0xC0, /*"X", 56*/
+    0x51, 0xF0, 0x82, 0xF0, 0x74, 0xF0, 0x56, 0x91, 0x81, 0x35, 0x61, 0xEA, 0xF0, 0x18, 0xE2, 0x71,
+    0x81, 0x23, 0x91, 0x83, 0xF0, 0x62, 0xF0, 0x71, 0xF0, 0x30, /*"Y", 57*/
+    0xF0, 0xF0, 0x11, 0xC1, 0x82, 0xB3, 0x81, 0xA5, 0x81, 0x85, 0x11, 0x81, 0x64, 0x41, 0x81, 0x35,
+    0x61, 0x81, 0x15, 0x81, 0x85, 0xA1, 0x83, 0xB2, 0x81, 0xB2, 0xF0, 0xE0, /*"Z", 58*/
+    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x2F, 0x06, 0x31, 0xF0, 0x41, 0x31, 0xF0, 0x41,
+    0x31, 0xF0, 0x41, 0x31, 0xF0, 0x41, 0x31, 0xF0, 0x41, 0xF0, 0xA0, /*"[", 59*/
+    0xF0, 0xF0, 0xF0, 0x71, 0xF0, 0x93, 0xF0, 0x92, 0xF0, 0x93, 0xF0, 0x92, 0xF0, 0x93, 0xF0, 0x92,
+    0xF0, 0x93, 0xF0, 0x91, 0xF0, 0x90, /*"\", 60*/
+    0xF0, 0xF0, 0xF0, 0x51, 0xF0, 0x41, 0x31, 0xF0, 0x41, 0x31, 0xF0, 0x41, 0x31, 0xF0, 0x41, 0x31,
+    0xF0, 0x41, 0x3F, 0x06, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x70, /*"]", 61*/
+    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x11, 0xF0, 0x71, 0xF0, 0x72, 0xF0, 0x71, 0xF0, 0x82, 0xF0, 0x81,
+    0xF0, 0x91, 0xF0, 0xF0, 0xF0, 0xF0, 0x70, /*"^", 62*/
+    0xF0, 0x81, 0xF0, 0x81, 0xF0, 0x81, 0xF0, 0x81, 0xF0, 0x81, 0xF0, 0x81, 0xF0, 0x81, 0xF0, 0x81,
+    0xF0, 0x81, 0xF0, 0x81, 0xF0, 0x81, 0xF0, 0x81, /*"_", 63*/
+    0xF0, 0xF0, 0xF0, 0xF0, 0xE1, 0xF0, 0x81, 0xF0, 0x91, 0xF0, 0x81, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+    0xF0, 0xF0, 0xF0, 0xF0, 0x50, /*"`", 64*/
+    0xF0, 0xF0, 0xA4, 0xF2, 0x26, 0xE2, 0x12, 0x32, 0xD1, 0x31, 0x51, 0xD1, 0x22, 0x51, 0xD1, 0x21,
+    0x61, 0xD1, 0x21, 0x51, 0xEB, 0xEA, 0xF0, 0x81, 0xF0, 0x72, 0x30, /*"a", 65*/
+    0xF0, 0xE1, 0xF0, 0x8F, 0x01, 0x7F, 0x01, 0xF2, 0x62, 0xE1, 0x81, 0xD1, 0x91, 0xD1, 0x91, 0xD2,
+    0x72, 0xE9, 0xF0, 0x16, 0xF0, 0xF0, /*"b", 66*/
+    0xF0, 0xF0, 0x75, 0xF0, 0x29, 0xF2, 0x52, 0xE1, 0x91, 0xD1, 0x91, 0xD1, 0x91, 0xD4, 0x61, 0xE3,
+    0x51, 0xF0, 0x62, 0xF0, 0xF0, 0xF0, 0x80, /*"c", 67*/
+    0xF0, 0xF0, 0x75, 0xF0, 0x29, 0xE3, 0x62, 0xD1, 0x91, 0xD1, 0x91, 0xD1, 0x91, 0x81, 0x51, 0x71,
+    0x9F, 0x01, 0x7F, 0x01, 0xF0, 0x81, 0xF0, 0xD0, /*"d", 68*/
+    0xF0, 0xF0, 0xF0, 0xF0, 0x15, 0xF0, 0x29, 0xF1, 0x21, 0x32, 0xE1, 0x31, 0x42, 0xD1, 0x31, 0x51,
+    0xD1, 0x31, 0x51, 0xD2, 0x21, 0x51, 0xE4, 0x41, 0xF0, 0x13, 0x31, 0xF0, 0xE0, /*"e", 69*/
+    0xF0, 0xF0, 0x41, 0xF0, 0x81, 0x91, 0xD1, 0x91, 0xAE, 0x9F, 0x82, 0x31, 0x91, 0x81, 0x41, 0x91,
+    0x81, 0x41, 0x91, 0x83, 0x21, 0xF0, 0x42, 0xF0, 0xF0, 0xA0, /*"f", 70*/
+    0xF0, 0xF0, 0xE3, 0xD3, 0x22, 0x13, 0xC9, 0x22, 0xA2, 0x32, 0x12, 0x31, 0xA1, 0x51, 0x12, 0x31,
+    0xA1, 0x51, 0x12, 0x31, 0xA2, 0x32, 0x21, 0x31, 0xB5, 0x31, 0x22, 0xA1, 0x13, 0x44, 0xB1, 0x93,
+    0xB2, 0xC0, /*"g", 71*/
+    0xF0, 0xE1, 0xE1, 0x8F, 0x01, 0x7F, 0x02, 0xE1, 0x81, 0xD1, 0xF0, 0x81, 0xF0, 0x81, 0x91, 0xDB,
+    0xEA, 0xF0, 0x81, 0xF0, 0xC0, /*"h", 72*/
+    0xF0, 0xF0, 0xF0, 0xD1, 0x91, 0xD1, 0x91, 0xD1, 0x91, 0x82, 0x3B, 0x82, 0x3B, 0xF0, 0x81, 0xF0,
+    0x81, 0xF0, 0x81, 0xF0, 0xF0, 0xF0, 0x60, /*"i", 73*/
+    0xF0, 0xF0, 0xF0, 0xF0, 0xA2, 0xF0, 0x72, 0xA1, 0xC1, 0xA1, 0xC1, 0xA1, 0xB2, 0x52, 0x3D, 0x62,
+    0x3C, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, /*"j", 74*/
+    0xF0, 0xE1, 0xE1, 0x8F, 0x01, 0x7F, 0x02, 0xF0, 0x32, 0x31, 0xF0, 0x22, 0xF0, 0x31, 0x16, 0xF0,
+    0x13, 0x35, 0xD1, 0x73, 0xD1, 0x91, 0xF0, 0x81, 0xF0, 0xC0, /*"k", 75*/
+    0xF0, 0xF0, 0xF0, 0x81, 0xE1, 0x81, 0xE1, 0x81, 0xE1, 0x8F, 0x01, 0x7F, 0x02, 0xF0, 0x81, 0xF0,
+    0x81, 0xF0, 0x81, 0xF0, 0xF0, 0xF0, 0x60, /*"l", 76*/
+    0xA1, 0x91, 0xDB, 0xDB, 0xE1, 0x81, 0xD1, 0xF0, 0x8B, 0xDB, 0xE1, 0x81, 0xD1, 0xF0, 0x8B, 0xDB,
+    0xF0, 0x81, 0x30, /*"m", 77*/
+    0xF0, 0xF0, 0x41, 0x91, 0xDB, 0xDB, 0xE1, 0x81, 0xE1, 0xF0, 0x71, 0xF0, 0x81, 0x91, 0xDB, 0xEA,
+    0xF0, 0x81, 0xF0, 0xC0, /*"n", 78*/
+    0xF0, 0xF0, 0x75, 0xF0, 0x38, 0xF2, 0x52, 0xE2, 0x81, 0xD1, 0x91, 0xD1, 0x91, 0xD2, 0x81, 0xE2,
+    0x52, 0xF0, 0x18, 0xF0, 0x25, 0xF0, 0xF0, /*"o", 79*/
+    0xF0, 0xF0, 0x41, 0xC1, 0xAE, 0xAE, 0xB1, 0x71, 0x31, 0xA1, 0x91, 0x21, 0xA1, 0x91, 0xD1, 0x91,
+    0xD2, 0x63, 0xE9, 0xF0, 0x16, 0xF0, 0xF0, /*"p", 80*/
+    0xF0, 0xF0, 0x75, 0xF0, 0x29, 0xE3, 0x62, 0xD1, 0x91, 0xD1, 0x91, 0xD1, 0x91, 0x21, 0xB1, 0x71,
+    0x31, 0xBD, 0xAE, 0xF0, 0x81, 0xF0, 0x90, /*"q", 81*/
+    0xA1, 0x91, 0xD1, 0x91, 0xD1, 0x91, 0xDB, 0xDB, 0xF1, 0x71, 0xE1, 0x81, 0xD1, 0x91, 0xD1, 0xF0,
+    0x82, 0xF0, 0x72, 0xF0, 0xF0, 0x60, /*"r", 82*/
+    0xF0, 0xF0, 0xF0, 0xF2, 0x34, 0xE4, 0x42, 0xD2, 0x22, 0x41, 0xD1, 0x32, 0x41, 0xD1, 0x41, 0x41,
+    0xD1, 0x42, 0x31, 0xD1, 0x42, 0x22, 0xD2, 0x44, 0xE3, 0x42, 0xF0, 0xE0, /*"s", 83*/
+    0xF0, 0xF0, 0x41, 0xF0, 0x81, 0xF0, 0x81, 0xF0, 0x6C, 0xAF, 0xD1, 0x91, 0xD1, 0x91, 0xD1, 0x91,
+    0xF0, 0x62, 0xF0, 0xF0, 0xF0, 0x70, /*"t", 84*/
+    0xF0, 0xF0, 0x41, 0xF0, 0x8A, 0xDC, 0xF0, 0x72, 0xF0, 0x81, 0xF0, 0x81, 0xD1, 0x81, 0xEB, 0xCB,
+    0xF0, 0x81, 0xF0, 0xD0, /*"u", 85*/
+    0xF0, 0xF0, 0x41, 0xF0, 0x82, 0xF0, 0x74, 0xF0, 0x57, 0xF0, 0x21, 0x36, 0xF0, 0x64, 0xF0, 0x53,
+    0xE1, 0x33, 0xF0, 0x24, 0xF0, 0x52, 0xF0, 0x71, 0xD0, /*"v", 86*/
+    0xA1, 0xF0, 0x84, 0xF0, 0x59, 0xF1, 0x37, 0xF0, 0x43, 0xF1, 0x23, 0xF0, 0x35, 0xF0, 0x49, 0xF1,
+    0x46, 0xF0, 0x34, 0xF5, 0xF0, 0x41, 0xD0, /*"w", 87*/
+    0xF0, 0xF0, 0x41, 0x91, 0xD1, 0x91, 0xD3, 0x53, 0xD5, 0x22, 0x11, 0xD1, 0x24, 0xF0, 0x64, 0x21,
+    0xD1, 0x12, 0x25, 0xD3, 0x53, 0xD1, 0x82, 0xD1, 0x91, 0xF0, 0xC0, /*"x", 88*/
+    0xF0, 0xF0, 0x41, 0xF0, 0x82, 0xA2, 0xA4, 0x91, 0xA7, 0x52, 0xA1, 0x35, 0x12, 0xF0, 0x43, 0xE1,
+    0x33, 0xF0, 0x24, 0xF0, 0x51, 0xF0, 0x81, 0xF0, 0xF0, 0x70, /*"y", 89*/
+    0xF0, 0xF0, 0xF0, 0xD3, 0x71, 0xD1, 0x73, 0xD1, 0x55, 0xD1, 0x35, 0x11, 0xD1, 0x15, 0x31, 0xD5,
+    0x51, 0xD3, 0x71, 0xD1, 0x82, 0xF0, 0x53, 0xF0, 0xD0, /*"z", 90*/
+    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xC1, 0xF0, 0x71, 0x11, 0xD9, 0x19, 0x42, 0xF0,
+    0x22, 0x31, 0xF0, 0x41, 0xF0, 0xF0, 0xF0, 0x40, /*"{", 91*/
+    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x9F, 0x09, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+    0xF0, 0xF0, 0xF0, /*"|", 92*/
+    0xF0, 0xF0, 0xF0, 0x51, 0xF0, 0x41, 0x32, 0xF0, 0x22, 0x49, 0x19, 0xD1, 0x11, 0xF0, 0x71, 0xF0,
+    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xB0, /*"}", 93*/
+    0xF0, 0xC2, 0xF0, 0x52, 0xF0, 0x71, 0xF0, 0x81, 0xF0, 0x91, 0xF0, 0x91, 0xF0, 0x91, 0xF0, 0x91,
+    0xF0, 0x81, 0xF0, 0x72, 0xF0, 0x61, 0xF0, 0x50, /*"~", 94*/
+};
+
+/**
+ * @brief packed ascii 2412 index definition
+ */
+static const uint16_t gsc_ssd1351_packed_2412_index[96] =
+{
+    0, 20, 41, 65, 97, 123, 153, 181, 205, 227, 249, 279,
+    303, 327, 351, 372, 396, 417, 439, 470, 498, 529, 558, 586,
+    611, 643, 672, 693, 715, 741, 775, 802, 830, 864, 890, 920,
+    942, 965, 994, 1022, 1047, 1074, 1097, 1124, 1152, 1176, 1200, 1224,
+    1245, 1271, 1296, 1325, 1355, 1379, 1401, 1425, 1449, 1475, 1501, 1529,
+    1556, 1578, 1605, 1628, 1652, 1673, 1700, 1722, 1745, 1769, 1798, 1824,
+    1858, 1879, 1902, 1924, 1950, 1973, 1992, 2012, 2035, 2058, 2081, 2103,
+    2131, 2153, 2173, 2198, 2221, 2248, 2274, 2299, 2323, 2342, 2366, 2390,
+};
+
+/**
+ * @brief packed ascii 2412 definition
+ */
+static const ssd1351_packed_font_t gsc_ssd1351_packed_2412 =
+{
+    12,                                 /* width */
+    24,                                 /* height */
+    ' ',                                /* first char */
+    95,                                 /* glyph number */
+    NULL,                               /* chars from first */
+    gsc_ssd1351_packed_2412_index,      /* index */
+    gsc_ssd1351_packed_2412_data,       /* data */
+};
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -56,6 +56,75 @@ static uint8_t gs_gamma[64] = { 0x02, 0x03, 0x04, 0x05,
                                 0x82, 0x87, 0x8C, 0x91,
                                 0x96, 0x9B, 0xA0, 0xA5,
                                 0xAA, 0xAF, 0xB4, 0x00 };
+static uint8_t gs_framebuffer[128 * 128 * 2];                    /**< framebuffer buffer */
+static uint8_t gs_framebuffer_back[128 * 128 * 2];               /**< back framebuffer buffer */
+static uint16_t gs_dirty[16];                                    /**< dirty tile buffer */
+static uint32_t gs_picture[32 * 32];                             /**< picture buffer */
+static uint8_t gs_raw[32 * 32 * 2];                              /**< raw picture buffer */
+static uint8_t gs_rgb888[32 * 32 * 4];                           /**< rgb888 picture buffer */
+static uint8_t gs_glyph_cache[4 * (sizeof(ssd1351_glyph_entry_t) +
+                              SSD1351_GLYPH_CACHE_SLOT_SIZE)];   /**< glyph cache buffer */
+static uint8_t gs_band[128 * 2 * 16];                            /**< band buffer */
+static uint8_t gs_arena[1024];                                   /**< display list arena buffer */
+static uint16_t gs_sprite_image[16 * 16];                        /**< sprite image buffer */
+static const uint8_t gsc_packed_chars[2] = {'O', 'X'};           /**< packed font chars */
+static const uint16_t gsc_packed_index[3] = {0, 8, 16};          /**< packed font index */
+static const uint8_t gsc_packed_data[16] =
+{
+    0x3C, 0x42, 0x81, 0x81, 0x81, 0x81, 0x42, 0x3C,             /*"O", 0*/
+    0x81, 0x42, 0x24, 0x18, 0x18, 0x24, 0x42, 0x81,             /*"X", 1*/
+};
+static const ssd1351_packed_font_t gsc_packed_font =
+{
+    8,                        /* width */
+    8,                        /* height */
+    0,                        /* first char */
+    2,                        /* glyph number */
+    gsc_packed_chars,         /* chars */
+    gsc_packed_index,         /* index */
+    gsc_packed_data,          /* data */
+};
+
+/**
+ * @brief     display test async irq
+ * @param[in] res transfer result
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      none
+ */
+uint8_t ssd1351_display_test_async_irq_handler(uint8_t res)
+{
+    return ssd1351_async_irq_handler(&gs_handle, res);
+}
+
+/**
+ * @brief  wait until the async draw is done
+ * @return status code
+ *         - 0 success
+ *         - 1 async transfer failed
+ * @note   none
+ */
+static uint8_t a_ssd1351_display_test_async_wait(void)
+{
+    uint16_t timeout;
+    ssd1351_async_status_t status;
+    
+    for (timeout = 0; timeout < 1000; timeout++)
+    {
+        if (ssd1351_get_async_status(&gs_handle, &status) != 0)
+        {
+            return 1;
+        }
+        if (status != SSD1351_ASYNC_STATUS_BUSY)
+        {
+            return (status == SSD1351_ASYNC_STATUS_IDLE) ? 0 : 1;
+        }
+        ssd1351_interface_delay_ms(1);
+    }
+    
+    return 1;
+}
 
 /**
  * @brief  display test
@@ -73,12 +142,21 @@ uint8_t ssd1351_display_test(void)
     char test_str2[] ="ssd1306";
     char test_str3[] ="ABCabc";
     char test_str4[] ="123?!#$%";
+    char test_str5[] ="OXXO";
+    uint16_t k;
+    ssd1351_flush_stats_t stats;
+    ssd1351_async_status_t status;
+    ssd1351_point_t point[5];
+    ssd1351_draw_item_t list[4];
+    ssd1351_sprite_t sprite;
     
     /* link functions */
     DRIVER_SSD1351_LINK_INIT(&gs_handle, ssd1351_handle_t);
     DRIVER_SSD1351_LINK_SPI_INIT(&gs_handle, ssd1351_interface_spi_init);
     DRIVER_SSD1351_LINK_SPI_DEINIT(&gs_handle, ssd1351_interface_spi_deinit);
     DRIVER_SSD1351_LINK_SPI_WRITE_COMMAND(&gs_handle, ssd1351_interface_spi_write_cmd);
+    DRIVER_SSD1351_LINK_SPI_WRITE_COMMAND_VECTOR(&gs_handle, ssd1351_interface_spi_write_cmd_vector);
+    DRIVER_SSD1351_LINK_SPI_WRITE_COMMAND_ASYNC(&gs_handle, ssd1351_interface_spi_write_cmd_async);
     DRIVER_SSD1351_LINK_COMMAND_DATA_GPIO_INIT(&gs_handle, ssd1351_interface_cmd_data_gpio_init);
     DRIVER_SSD1351_LINK_COMMAND_DATA_GPIO_DEINIT(&gs_handle, ssd1351_interface_cmd_data_gpio_deinit);
     DRIVER_SSD1351_LINK_COMMAND_DATA_GPIO_WRITE(&gs_handle, ssd1351_interface_cmd_data_gpio_write);
@@ -625,9 +703,772 @@ uint8_t ssd1351_display_test(void)
         return 1;
     }
     
+    /* write combine test */
+    ssd1351_interface_debug_print("ssd1351: write combine test.\n");
+    res = ssd1351_set_write_combine(&gs_handle, SSD1351_BOOL_TRUE);
+    if (res != 0)
+    {
+        ssd1351_interface_debug_print("ssd1351: set write combine failed.\n");
+        (void)ssd1351_deinit(&gs_handle);
+        
+        return 1;
+    }
+    for (i = 0; i < 128; i++)
+    {
+        for (j = 60; j < 68; j++)
+        {
+            res = ssd1351_draw_point(&gs_handle, i, j, rand()%0xFFFFU);
+            if (res != 0)
+            {
+                ssd1351_interface_debug_print("ssd1351: draw point failed.\n");
+                (void)ssd1351_deinit(&gs_handle);
+                
+                return 1;
+            }
+        }
+    }
+    res = ssd1351_flush(&gs_handle);
+    if (res != 0)
+    {
+        ssd1351_interface_debug_print("ssd1351: flush failed.\n");
+        (void)ssd1351_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = ssd1351_set_write_combine(&gs_handle, SSD1351_BOOL_FALSE);
+    if (res != 0)
+    {
+        ssd1351_interface_debug_print("ssd1351: set write combine failed.\n");
+        (void)ssd1351_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* delay 3s */
+    ssd1351_interface_delay_ms(3000);
+    
+    /* clear screen */
+    res = ssd1351_clear(&gs_handle);
+    if (res != 0)
+    {
+        ssd1351_interface_debug_print("ssd1351: clear failed.\n");
+        (void)ssd1351_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* framebuffer test */
+    ssd1351_interface_debug_print("ssd1351: framebuffer test.\n");
+    res = ssd1351_set_framebuffer(&gs_handle, gs_framebuffer, sizeof(gs_framebuffer));
+    if (res != 0)
+    {
+        ssd1351_interface_debug_print("ssd1351: set framebuffer failed.\n");
+        (void)ssd1351_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = ssd1351_clear(&gs_handle);
+    if (res != 0)
+    {
+        ssd1351_interface_debug_print("ssd1351: clear failed.\n");
+        (void)ssd1351_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = ssd1351_fill_rect(&gs_handle, 0, 0, 63, 63, 0xF800U);
+    if (res != 0)
+    {
+        ssd1351_interface_debug_print("ssd1351: fill rect failed.\n");
+        (void)ssd1351_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = ssd1351_write_string(&gs_handle, 0, 64, (char *)test_str1, (uint16_t)strlen(test_str1), 0xFFFFU, SSD1351_FONT_16);
+    if (res != 0)
+    {
+        ssd1351_interface_debug_print("ssd1351: write string failed.\n");
+        (void)ssd1351_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = ssd1351_flush(&gs_handle);
+    if (res != 0)
+    {
+        ssd1351_interface_debug_print("ssd1351: flush failed.\n");
+        (void)ssd1351_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = ssd1351_get_flush_stats(&gs_handle, &stats);
+    if (res != 0)
+    {
+        ssd1351_interface_debug_print("ssd1351: get flush stats failed.\n");
+        (void)ssd1351_deinit(&gs_handle);
+        
+        return 1;
+    }
+    ssd1351_interface_debug_print("ssd1351: flush sent %d bytes of %d bytes.\n", stats.bytes, stats.full_frame_bytes);
+    res = ssd1351_fill_rect(&gs_handle, 64, 64, 127, 127, 0x07E0U);
+    if (res != 0)
+    {
+        ssd1351_interface_debug_print("ssd1351: fill rect failed.\n");
+        (void)ssd1351_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = ssd1351_swap_framebuffer(&gs_handle, gs_framebuffer_back, gs_dirty);
+    if (res != 0)
+    {
+        ssd1351_interface_debug_print("ssd1351: swap framebuffer failed.\n");
+        (void)ssd1351_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = ssd1351_flush_framebuffer(&gs_handle, gs_framebuffer, gs_dirty);
+    if (res != 0)
+    {
+        ssd1351_interface_debug_print("ssd1351: flush framebuffer failed.\n");
+        (void)ssd1351_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = ssd1351_fill_circle(&gs_handle, 96, 32, 24, 0x001FU);
+    if (res != 0)
+    {
+        ssd1351_interface_debug_print("ssd1351: fill circle failed.\n");
+        (void)ssd1351_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = ssd1351_swap_framebuffer(&gs_handle, gs_framebuffer, gs_dirty);
+    if (res != 0)
+    {
+        ssd1351_interface_debug_print("ssd1351: swap framebuffer failed.\n");
+        (void)ssd1351_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = ssd1351_flush_framebuffer(&gs_handle, gs_framebuffer_back, gs_dirty);
+    if (res != 0)
+    {
+        ssd1351_interface_debug_print("ssd1351: flush framebuffer failed.\n");
+        (void)ssd1351_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = ssd1351_set_framebuffer(&gs_handle, NULL, 0);
+    if (res != 0)
+    {
+        ssd1351_interface_debug_print("ssd1351: set framebuffer failed.\n");
+        (void)ssd1351_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* delay 3s */
+    ssd1351_interface_delay_ms(3000);
+    
+    /* clear screen */
+    res = ssd1351_clear(&gs_handle);
+    if (res != 0)
+    {
+        ssd1351_interface_debug_print("ssd1351: clear failed.\n");
+        (void)ssd1351_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* async test */
+    ssd1351_interface_debug_print("ssd1351: async test.\n");
+    for (k = 0; k < 32 * 32; k++)
+    {
+        gs_picture[k] = ((uint32_t)(k % 32) << 19) | ((uint32_t)(k / 32) << 11) | 0x80U;
+    }
+    res = ssd1351_fill_rect_async(&gs_handle, 0, 0, 63, 127, 0xF800U);
+    if (res != 0)
+    {
+        ssd1351_interface_debug_print("ssd1351: fill rect async failed.\n");
+        (void)ssd1351_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = a_ssd1351_display_test_async_wait();
+    if (res != 0)
+    {
+        ssd1351_interface_debug_print("ssd1351: async wait failed.\n");
+        (void)ssd1351_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = ssd1351_draw_picture_async(&gs_handle, 64, 0, 95, 31, gs_picture);
+    if (res != 0)
+    {
+        ssd1351_interface_debug_print("ssd1351: draw picture async failed.\n");
+        (void)ssd1351_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = a_ssd1351_display_test_async_wait();
+    if (res != 0)
+    {
+        ssd1351_interface_debug_print("ssd1351: async wait failed.\n");
+        (void)ssd1351_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = ssd1351_get_async_status(&gs_handle, &status);
+    if (res != 0)
+    {
+        ssd1351_interface_debug_print("ssd1351: get async status failed.\n");
+        (void)ssd1351_deinit(&gs_handle);
+        
+        return 1;
+    }
+    if (status != SSD1351_ASYNC_STATUS_IDLE)
+    {
+        ssd1351_interface_debug_print("ssd1351: async status is not idle.\n");
+        (void)ssd1351_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* delay 3s */
+    ssd1351_interface_delay_ms(3000);
+    
+    /* clear screen */
+    res = ssd1351_clear(&gs_handle);
+    if (res != 0)
+    {
+        ssd1351_interface_debug_print("ssd1351: clear failed.\n");
+        (void)ssd1351_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* raw picture test */
+    ssd1351_interface_debug_print("ssd1351: raw picture test.\n");
+    for (k = 0; k < 32 * 32; k++)
+    {
+        gs_raw[k * 2 + 0] = (uint8_t)((k % 32) << 3);
+        gs_raw[k * 2 + 1] = (uint8_t)(k / 32);
+    }
+    res = ssd1351_draw_raw(&gs_handle, 96, 0, 127, 31, gs_raw, sizeof(gs_raw));
+    if (res != 0)
+    {
+        ssd1351_interface_debug_print("ssd1351: draw raw failed.\n");
+        (void)ssd1351_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* delay 3s */
+    ssd1351_interface_delay_ms(3000);
+    
+    /* clear screen */
+    res = ssd1351_clear(&gs_handle);
+    if (res != 0)
+    {
+        ssd1351_interface_debug_print("ssd1351: clear failed.\n");
+        (void)ssd1351_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* picture 32bits test */
+    ssd1351_interface_debug_print("ssd1351: picture 32bits test.\n");
+    res = ssd1351_draw_picture(&gs_handle, 0, 0, 31, 31, gs_picture);
+    if (res != 0)
+    {
+        ssd1351_interface_debug_print("ssd1351: draw picture failed.\n");
+        (void)ssd1351_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = ssd1351_draw_picture(&gs_handle, 32, 32, 63, 63, gs_picture);
+    if (res != 0)
+    {
+        ssd1351_interface_debug_print("ssd1351: draw picture failed.\n");
+        (void)ssd1351_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* delay 3s */
+    ssd1351_interface_delay_ms(3000);
+    
+    /* clear screen */
+    res = ssd1351_clear(&gs_handle);
+    if (res != 0)
+    {
+        ssd1351_interface_debug_print("ssd1351: clear failed.\n");
+        (void)ssd1351_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* rgb888 picture test */
+    ssd1351_interface_debug_print("ssd1351: rgb888 picture test.\n");
+    for (k = 0; k < 32 * 32; k++)
+    {
+        gs_rgb888[k * 4 + 0] = (uint8_t)((k % 32) << 3);
+        gs_rgb888[k * 4 + 1] = (uint8_t)((k / 32) << 3);
+        gs_rgb888[k * 4 + 2] = 0x80U;
+        gs_rgb888[k * 4 + 3] = 0xFFU;
+    }
+    res = ssd1351_draw_picture_rgb888(&gs_handle, 32, 0, 63, 31, gs_rgb888, SSD1351_COLOR_FORMAT_RGBA8888);
+    if (res != 0)
+    {
+        ssd1351_interface_debug_print("ssd1351: draw picture rgb888 failed.\n");
+        (void)ssd1351_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = ssd1351_draw_picture_rgb888(&gs_handle, 64, 0, 95, 23, gs_rgb888, SSD1351_COLOR_FORMAT_RGB888);
+    if (res != 0)
+    {
+        ssd1351_interface_debug_print("ssd1351: draw picture rgb888 failed.\n");
+        (void)ssd1351_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* delay 3s */
+    ssd1351_interface_delay_ms(3000);
+    
+    /* clear screen */
+    res = ssd1351_clear(&gs_handle);
+    if (res != 0)
+    {
+        ssd1351_interface_debug_print("ssd1351: clear failed.\n");
+        (void)ssd1351_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* opaque string test */
+    ssd1351_interface_debug_print("ssd1351: opaque string test.\n");
+    res = ssd1351_set_glyph_cache(&gs_handle, gs_glyph_cache, sizeof(gs_glyph_cache));
+    if (res != 0)
+    {
+        ssd1351_interface_debug_print("ssd1351: set glyph cache failed.\n");
+        (void)ssd1351_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = ssd1351_write_string_opaque(&gs_handle, 0, 0, (char *)test_str1, (uint16_t)strlen(test_str1), 0xFFFFU, 0xF800U, SSD1351_FONT_16);
+    if (res != 0)
+    {
+        ssd1351_interface_debug_print("ssd1351: write string opaque failed.\n");
+        (void)ssd1351_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = ssd1351_write_string_opaque(&gs_handle, 0, 32, (char *)test_str1, (uint16_t)strlen(test_str1), 0xFFFFU, 0xF800U, SSD1351_FONT_16);
+    if (res != 0)
+    {
+        ssd1351_interface_debug_print("ssd1351: write string opaque failed.\n");
+        (void)ssd1351_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = ssd1351_write_string_opaque(&gs_handle, 0, 64, (char *)test_str3, (uint16_t)strlen(test_str3), 0x0000U, 0x07E0U, SSD1351_FONT_24);
+    if (res != 0)
+    {
+        ssd1351_interface_debug_print("ssd1351: write string opaque failed.\n");
+        (void)ssd1351_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = ssd1351_set_glyph_cache(&gs_handle, NULL, 0);
+    if (res != 0)
+    {
+        ssd1351_interface_debug_print("ssd1351: set glyph cache failed.\n");
+        (void)ssd1351_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* delay 3s */
+    ssd1351_interface_delay_ms(3000);
+    
+    /* clear screen */
+    res = ssd1351_clear(&gs_handle);
+    if (res != 0)
+    {
+        ssd1351_interface_debug_print("ssd1351: clear failed.\n");
+        (void)ssd1351_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* packed string test */
+    ssd1351_interface_debug_print("ssd1351: packed string test.\n");
+    res = ssd1351_write_string_packed(&gs_handle, 0, 0, (char *)test_str5, (uint16_t)strlen(test_str5), 0xF800U, &gsc_packed_font);
+    if (res != 0)
+    {
+        ssd1351_interface_debug_print("ssd1351: write string packed failed.\n");
+        (void)ssd1351_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = ssd1351_write_string_packed_opaque(&gs_handle, 0, 32, (char *)test_str5, (uint16_t)strlen(test_str5), 0x001FU, 0xFFFFU, &gsc_packed_font);
+    if (res != 0)
+    {
+        ssd1351_interface_debug_print("ssd1351: write string packed opaque failed.\n");
+        (void)ssd1351_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* delay 3s */
+    ssd1351_interface_delay_ms(3000);
+    
+    /* clear screen */
+    res = ssd1351_clear(&gs_handle);
+    if (res != 0)
+    {
+        ssd1351_interface_debug_print("ssd1351: clear failed.\n");
+        (void)ssd1351_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* shape test */
+    ssd1351_interface_debug_print("ssd1351: shape test.\n");
+    res = ssd1351_draw_line(&gs_handle, 0, 0, 127, 127, 0xF800U);
+    if (res != 0)
+    {
+        ssd1351_interface_debug_print("ssd1351: draw line failed.\n");
+        (void)ssd1351_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = ssd1351_draw_line(&gs_handle, 127, 0, 0, 127, 0x07E0U);
+    if (res != 0)
+    {
+        ssd1351_interface_debug_print("ssd1351: draw line failed.\n");
+        (void)ssd1351_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = ssd1351_draw_circle(&gs_handle, 32, 32, 24, 0x001FU);
+    if (res != 0)
+    {
+        ssd1351_interface_debug_print("ssd1351: draw circle failed.\n");
+        (void)ssd1351_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = ssd1351_fill_circle(&gs_handle, 96, 32, 24, 0xFFE0U);
+    if (res != 0)
+    {
+        ssd1351_interface_debug_print("ssd1351: fill circle failed.\n");
+        (void)ssd1351_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = ssd1351_draw_arc(&gs_handle, 64, 64, 20, 0, 270, 0xF81FU);
+    if (res != 0)
+    {
+        ssd1351_interface_debug_print("ssd1351: draw arc failed.\n");
+        (void)ssd1351_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = ssd1351_fill_triangle(&gs_handle, 64, 80, 40, 120, 88, 120, 0x07FFU);
+    if (res != 0)
+    {
+        ssd1351_interface_debug_print("ssd1351: fill triangle failed.\n");
+        (void)ssd1351_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = ssd1351_draw_round_rect(&gs_handle, 4, 72, 36, 124, 8, 0xFFFFU);
+    if (res != 0)
+    {
+        ssd1351_interface_debug_print("ssd1351: draw round rect failed.\n");
+        (void)ssd1351_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = ssd1351_fill_round_rect(&gs_handle, 92, 72, 124, 124, 8, 0xF800U);
+    if (res != 0)
+    {
+        ssd1351_interface_debug_print("ssd1351: fill round rect failed.\n");
+        (void)ssd1351_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* delay 3s */
+    ssd1351_interface_delay_ms(3000);
+    
+    /* clear screen */
+    res = ssd1351_clear(&gs_handle);
+    if (res != 0)
+    {
+        ssd1351_interface_debug_print("ssd1351: clear failed.\n");
+        (void)ssd1351_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* polygon test */
+    ssd1351_interface_debug_print("ssd1351: polygon test.\n");
+    res = ssd1351_set_band_buffer(&gs_handle, gs_band, sizeof(gs_band));
+    if (res != 0)
+    {
+        ssd1351_interface_debug_print("ssd1351: set band buffer failed.\n");
+        (void)ssd1351_deinit(&gs_handle);
+        
+        return 1;
+    }
+    point[0].x = 64 * 16;
+    point[0].y = 16 * 16;
+    point[1].x = 92 * 16;
+    point[1].y = 103 * 16;
+    point[2].x = 18 * 16;
+    point[2].y = 49 * 16;
+    point[3].x = 110 * 16;
+    point[3].y = 49 * 16;
+    point[4].x = 36 * 16;
+    point[4].y = 103 * 16;
+    res = ssd1351_fill_polygon(&gs_handle, point, 5, 0xFFE0U, 0x0000U);
+    if (res != 0)
+    {
+        ssd1351_interface_debug_print("ssd1351: fill polygon failed.\n");
+        (void)ssd1351_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = ssd1351_draw_thick_line(&gs_handle, 8 * 16, 120 * 16, 120 * 16, 112 * 16, 3 * 16, 0x07FFU, 0x0000U);
+    if (res != 0)
+    {
+        ssd1351_interface_debug_print("ssd1351: draw thick line failed.\n");
+        (void)ssd1351_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = ssd1351_set_band_buffer(&gs_handle, NULL, 0);
+    if (res != 0)
+    {
+        ssd1351_interface_debug_print("ssd1351: set band buffer failed.\n");
+        (void)ssd1351_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* delay 3s */
+    ssd1351_interface_delay_ms(3000);
+    
+    /* clear screen */
+    res = ssd1351_clear(&gs_handle);
+    if (res != 0)
+    {
+        ssd1351_interface_debug_print("ssd1351: clear failed.\n");
+        (void)ssd1351_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* render list test */
+    ssd1351_interface_debug_print("ssd1351: render list test.\n");
+    memset(list, 0, sizeof(list));
+    list[0].type = SSD1351_DRAW_FILL_RECT;
+    list[0].x0 = 8;
+    list[0].y0 = 8;
+    list[0].x1 = 119;
+    list[0].y1 = 119;
+    list[0].color = 0x001FU;
+    list[1].type = SSD1351_DRAW_FILL_CIRCLE;
+    list[1].x0 = 64;
+    list[1].y0 = 64;
+    list[1].param = 40;
+    list[1].color = 0xFFE0U;
+    list[2].type = SSD1351_DRAW_ARC;
+    list[2].x0 = 64;
+    list[2].y0 = 64;
+    list[2].param = 50;
+    list[2].start_angle = 90;
+    list[2].end_angle = 360;
+    list[2].color = 0xF800U;
+    list[3].type = SSD1351_DRAW_STRING;
+    list[3].x0 = 28;
+    list[3].y0 = 56;
+    list[3].param = SSD1351_FONT_16;
+    list[3].len = (uint16_t)strlen(test_str1);
+    list[3].data = test_str1;
+    list[3].color = 0x0000U;
+    res = ssd1351_render_list(&gs_handle, list, 4, 0x07E0U);
+    if (res != 0)
+    {
+        ssd1351_interface_debug_print("ssd1351: render list failed.\n");
+        (void)ssd1351_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* delay 3s */
+    ssd1351_interface_delay_ms(3000);
+    
+    /* clear screen */
+    res = ssd1351_clear(&gs_handle);
+    if (res != 0)
+    {
+        ssd1351_interface_debug_print("ssd1351: clear failed.\n");
+        (void)ssd1351_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* display list test */
+    ssd1351_interface_debug_print("ssd1351: display list test.\n");
+    res = ssd1351_set_display_list(&gs_handle, gs_arena, sizeof(gs_arena));
+    if (res != 0)
+    {
+        ssd1351_interface_debug_print("ssd1351: set display list failed.\n");
+        (void)ssd1351_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = ssd1351_fill_rect(&gs_handle, 0, 0, 127, 127, 0x0000U);
+    if (res != 0)
+    {
+        ssd1351_interface_debug_print("ssd1351: fill rect failed.\n");
+        (void)ssd1351_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = ssd1351_fill_rect(&gs_handle, 0, 0, 63, 63, 0xF800U);
+    if (res != 0)
+    {
+        ssd1351_interface_debug_print("ssd1351: fill rect failed.\n");
+        (void)ssd1351_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = ssd1351_fill_circle(&gs_handle, 96, 96, 24, 0x07E0U);
+    if (res != 0)
+    {
+        ssd1351_interface_debug_print("ssd1351: fill circle failed.\n");
+        (void)ssd1351_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = ssd1351_write_string(&gs_handle, 0, 96, (char *)test_str2, (uint16_t)strlen(test_str2), 0xFFFFU, SSD1351_FONT_16);
+    if (res != 0)
+    {
+        ssd1351_interface_debug_print("ssd1351: write string failed.\n");
+        (void)ssd1351_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = ssd1351_submit_display_list(&gs_handle);
+    if (res != 0)
+    {
+        ssd1351_interface_debug_print("ssd1351: submit display list failed.\n");
+        (void)ssd1351_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = ssd1351_set_display_list(&gs_handle, NULL, 0);
+    if (res != 0)
+    {
+        ssd1351_interface_debug_print("ssd1351: set display list failed.\n");
+        (void)ssd1351_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* delay 3s */
+    ssd1351_interface_delay_ms(3000);
+    
+    /* clear screen */
+    res = ssd1351_clear(&gs_handle);
+    if (res != 0)
+    {
+        ssd1351_interface_debug_print("ssd1351: clear failed.\n");
+        (void)ssd1351_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* sprite test */
+    ssd1351_interface_debug_print("ssd1351: sprite test.\n");
+    for (k = 0; k < 16 * 16; k++)
+    {
+        if ((((k % 16) - 8) * ((k % 16) - 8) + ((k / 16) - 8) * ((k / 16) - 8)) < 49)
+        {
+            gs_sprite_image[k] = 0xF800U;
+        }
+        else
+        {
+            gs_sprite_image[k] = 0x0000U;
+        }
+    }
+    res = ssd1351_set_sprite_background(&gs_handle, (const uint16_t *)gs_image);
+    if (res != 0)
+    {
+        ssd1351_interface_debug_print("ssd1351: set sprite background failed.\n");
+        (void)ssd1351_deinit(&gs_handle);
+        
+        return 1;
+    }
+    memset(&sprite, 0, sizeof(sprite));
+    sprite.width = 16;
+    sprite.height = 16;
+    sprite.visible = 1;
+    sprite.key = 0x0000U;
+    sprite.image = gs_sprite_image;
+    sprite.mask = NULL;
+    for (i = 0; i < 112; i++)
+    {
+        sprite.x = i;
+        sprite.y = i;
+        res = ssd1351_update_sprites(&gs_handle, &sprite, 1);
+        if (res != 0)
+        {
+            ssd1351_interface_debug_print("ssd1351: update sprites failed.\n");
+            (void)ssd1351_deinit(&gs_handle);
+            
+            return 1;
+        }
+        ssd1351_interface_delay_ms(20);
+    }
+    sprite.visible = 0;
+    res = ssd1351_update_sprites(&gs_handle, &sprite, 1);
+    if (res != 0)
+    {
+        ssd1351_interface_debug_print("ssd1351: update sprites failed.\n");
+        (void)ssd1351_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = ssd1351_set_sprite_background(&gs_handle, NULL);
+    if (res != 0)
+    {
+        ssd1351_interface_debug_print("ssd1351: set sprite background failed.\n");
+        (void)ssd1351_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* delay 3s */
+    ssd1351_interface_delay_ms(3000);
+    
+    /* clear screen */
+    res = ssd1351_clear(&gs_handle);
+    if (res != 0)
+    {
+        ssd1351_interface_debug_print("ssd1351: clear failed.\n");
+        (void)ssd1351_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
     /* picture test */
     ssd1351_interface_debug_print("ssd1351: picture test.\n");
-    res = ssd1351_draw_picture_16bits(&gs_handle, 0, 0, 127, 127, (uint16_t *)gs_image);
+    res = ssd1351_draw_picture_16bits(&gs_handle, 0, 0, 127, 127, (const uint16_t *)gs_image);
     if (res != 0)
     {
         ssd1351_interface_debug_print("ssd1351: draw picture 16bits failed.\n");
@@ -60,6 +60,16 @@ extern "C"{
  */
 uint8_t ssd1351_display_test(void);
 
+/**
+ * @brief     display test async irq
+ * @param[in] res transfer result
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      call it from the async transfer complete irq
+ */
+uint8_t ssd1351_display_test_async_irq_handler(uint8_t res);
+
 /**
  * @}
  */